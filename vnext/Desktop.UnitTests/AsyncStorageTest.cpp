@@ -1,6 +1,7 @@
 // Copyright (c) Microsoft Corporation.
 // Licensed under the MIT License.
 
+#include <chrono>
 #include <future>
 #include <map>
 #include <memory>
@@ -10,6 +11,7 @@
 
 #include <AsyncStorage/KeyValueStorage.h>
 #include <AsyncStorage/StorageFileIO.h>
+#include <folly/json.h>
 
 #include "AsyncStorageTestClass.h"
 
@@ -9849,6 +9851,185 @@ TEST_CLASS (AsyncStorageTest) {
 
     kvStorage->clear();
   }
+
+  TEST_METHOD(AsyncStorageTest_CompactionPersistance) {
+    auto kvStorage = make_shared<KeyValueStorage>(this->m_storageFileName);
+    kvStorage->clear();
+
+    // Overwrite and remove the same keys until the log is big enough to be compacted.
+    string SAMPLE_VAL_1(std::get<1>(TestData::LongKV[0]));
+    vector<tuple<string, string>> expected;
+    uint64_t writtenSize = 0;
+    for (int i = 0; i < 256; i++) {
+      expected.clear();
+      for (auto const &key : TestKeys::BasicRW) {
+        expected.push_back(make_tuple(key, SAMPLE_VAL_1 + std::to_string(i)));
+        writtenSize += key.size() + std::get<1>(expected.back()).size();
+      }
+
+      kvStorage->multiSet(expected);
+      kvStorage->multiRemove({TestKeys::BasicRW[0]});
+    }
+
+    expected.erase(expected.begin());
+    vector<string> expectedKeys(TestKeys::BasicRW.begin() + 1, TestKeys::BasicRW.end());
+
+    auto results = kvStorage->multiGet(TestKeys::BasicRW);
+    Assert::IsTrue(results == expected, L"results were not correct before the persistance portion");
+
+    kvStorage = nullptr; // kill object, it waits for the compaction to complete
+
+    // Without the compaction the log would keep all written records.
+    uint64_t fileSize = StorageFileIO{this->m_storageFileName}.size();
+    Assert::IsTrue(fileSize < writtenSize / 4, L"the storage file was not compacted");
+
+    kvStorage = make_shared<KeyValueStorage>(this->m_storageFileName); // should load from file now
+
+    auto resultsAfterLoad = kvStorage->multiGet(TestKeys::BasicRW);
+    Assert::IsTrue(resultsAfterLoad == expected, L"results were not correct after the persistance portion");
+    Assert::IsTrue(kvStorage->getAllKeys() == expectedKeys, L"removed key was restored");
+
+    kvStorage->clear();
+  }
+
+  // Measures the small write throughput for different store sizes.
+  // The log-structured storage file makes it independent from the store size.
+  TEST_METHOD(AsyncStorageTest_WriteThroughputBenchmark) {
+    string SAMPLE_KEY_1(std::get<0>(TestData::LongKV[0]));
+    string SAMPLE_VAL_1(std::get<1>(TestData::LongKV[0]));
+
+    const int numWrites = 256;
+    for (int storeSize : {0, 1024, 8192}) {
+      auto kvStorage = make_shared<KeyValueStorage>(this->m_storageFileName);
+      kvStorage->clear();
+
+      vector<tuple<string, string>> setArgs;
+      for (int i = 0; i < storeSize; i++) {
+        setArgs.push_back(make_tuple(SAMPLE_KEY_1 + std::to_string(i), SAMPLE_VAL_1));
+      }
+      kvStorage->multiSet(setArgs);
+
+      auto start = std::chrono::steady_clock::now();
+      for (int i = 0; i < numWrites; i++) {
+        kvStorage->multiSet({make_tuple("benchmarkKey", SAMPLE_VAL_1 + std::to_string(i))});
+      }
+      auto duration = std::chrono::steady_clock::now() - start;
+
+      auto microseconds = std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+      auto message = L"Store size: " + std::to_wstring(storeSize) + L" entries, " + std::to_wstring(numWrites) +
+          L" writes: " + std::to_wstring(microseconds) + L"us";
+      Logger::WriteMessage(message.c_str());
+
+      kvStorage->clear();
+    }
+  }
+
+  // Measures the time to the first read after the storage is created for different store sizes.
+  TEST_METHOD(AsyncStorageTest_LoadLatencyBenchmark) {
+    string SAMPLE_KEY_1(std::get<0>(TestData::LongKV[0]));
+    string SAMPLE_VAL_1(std::get<1>(TestData::LongKV[0]));
+
+    for (int storeSize : {1024, 8192, 32768}) {
+      auto kvStorage = make_shared<KeyValueStorage>(this->m_storageFileName);
+      kvStorage->clear();
+
+      vector<tuple<string, string>> setArgs;
+      for (int i = 0; i < storeSize; i++) {
+        setArgs.push_back(make_tuple(SAMPLE_KEY_1 + std::to_string(i), SAMPLE_VAL_1));
+      }
+      kvStorage->multiSet(setArgs);
+
+      // The most recently written key is indexed first.
+      vector<string> getArgs = {std::get<0>(setArgs.back())};
+      kvStorage = nullptr;
+
+      auto start = std::chrono::steady_clock::now();
+      kvStorage = make_shared<KeyValueStorage>(this->m_storageFileName);
+      auto results = kvStorage->multiGet(getArgs);
+      auto firstReadDuration = std::chrono::steady_clock::now() - start;
+      kvStorage->getAllKeys();
+      auto loadDuration = std::chrono::steady_clock::now() - start;
+
+      Assert::IsTrue(results.size() == 1 && std::get<1>(results[0]) == SAMPLE_VAL_1, L"Read does not match write");
+
+      auto firstReadMicroseconds = std::chrono::duration_cast<std::chrono::microseconds>(firstReadDuration).count();
+      auto loadMicroseconds = std::chrono::duration_cast<std::chrono::microseconds>(loadDuration).count();
+      auto message = L"Store size: " + std::to_wstring(storeSize) + L" entries, first read: " +
+          std::to_wstring(firstReadMicroseconds) + L"us, full load: " + std::to_wstring(loadMicroseconds) + L"us";
+      Logger::WriteMessage(message.c_str());
+
+      kvStorage->clear();
+    }
+  }
+
+  TEST_METHOD(AsyncStorageTest_Merge) {
+    auto kvStorage = make_shared<KeyValueStorage>(this->m_storageFileName);
+    kvStorage->clear();
+
+    kvStorage->multiSet({make_tuple("key0", R"({"a":1,"b":{"c":2,"d":[1,2]}})")});
+    kvStorage->multiMerge({make_tuple("key0", R"({"b":{"c":3,"d":[3]},"e":"x"})"), make_tuple("key1", R"({"f":4})")});
+
+    auto expected = folly::parseJson(R"({"a":1,"b":{"c":3,"d":[3]},"e":"x"})");
+    auto results = kvStorage->multiGet({"key0", "key1"});
+    Assert::IsTrue(results.size() == 2, L"Merge failed");
+    Assert::IsTrue(folly::parseJson(std::get<1>(results[0])) == expected, L"Merge does not match");
+    Assert::IsTrue(std::get<1>(results[1]) == R"({"f":4})", L"Merge into a missing key does not match");
+
+    kvStorage = nullptr; // kill object
+    kvStorage = make_shared<KeyValueStorage>(this->m_storageFileName); // should load from file now
+
+    results = kvStorage->multiGet({"key0"});
+    Assert::IsTrue(folly::parseJson(std::get<1>(results[0])) == expected, L"Merge was not persisted");
+
+    kvStorage->clear();
+  }
+
+  TEST_METHOD(AsyncStorageTest_SyncEveryWrite) {
+    auto kvStorage = make_shared<KeyValueStorage>(this->m_storageFileName, std::chrono::milliseconds{0});
+    kvStorage->clear();
+
+    kvStorage->multiSet({make_tuple("key0", "value0"), make_tuple("key1", "value1")});
+    kvStorage->multiRemove({"key1"});
+
+    kvStorage = nullptr; // kill object
+    kvStorage = make_shared<KeyValueStorage>(this->m_storageFileName); // should load from file now
+
+    auto results = kvStorage->multiGet({"key0", "key1"});
+    Assert::IsTrue(results.size() == 1 && std::get<1>(results[0]) == "value0", L"Synced writes were not persisted");
+
+    kvStorage->clear();
+  }
+
+  // Measures merging small patches into a large document.
+  TEST_METHOD(AsyncStorageTest_MergeLargeDocumentBenchmark) {
+    auto kvStorage = make_shared<KeyValueStorage>(this->m_storageFileName);
+    kvStorage->clear();
+
+    folly::dynamic document = folly::dynamic::object;
+    for (int i = 0; i < 4096; i++) {
+      document[std::to_string(i)] = folly::dynamic::object("value", i)("text", std::get<1>(TestData::BasicRW[i % 10]));
+    }
+    kvStorage->multiSet({make_tuple("document", folly::toJson(document))});
+
+    const int numMerges = 64;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < numMerges; i++) {
+      auto patch = folly::dynamic::object(std::to_string(i), folly::dynamic::object("value", -i));
+      kvStorage->multiMerge({make_tuple("document", folly::toJson(patch))});
+    }
+    auto duration = std::chrono::steady_clock::now() - start;
+
+    auto results = kvStorage->multiGet({"document"});
+    auto merged = folly::parseJson(std::get<1>(results[0]));
+    Assert::IsTrue(merged["1"]["value"] == -1 && merged["1"]["text"] == "value1", L"Merge does not match");
+
+    auto microseconds = std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+    auto message = L"Document size: " + std::to_wstring(std::get<1>(results[0]).size()) + L" bytes, " +
+        std::to_wstring(numMerges) + L" merges: " + std::to_wstring(microseconds) + L"us";
+    Logger::WriteMessage(message.c_str());
+
+    kvStorage->clear();
+  }
 };
 
 } // namespace Microsoft::React::Test
@@ -6,17 +6,24 @@
 #include <CppUnitTest.h>
 #pragma pack(pop)
 
+#include <psapi.h>
 #include <shlwapi.h>
 #include <windows.h>
 
+#include <chrono>
 #include <cstring>
+#include <fstream>
 #include <memory>
+#include <string>
 
 using facebook::jsi::Buffer;
 using facebook::jsi::JSINativeException;
+using facebook::react::JSBigString;
 using Microsoft::Common::Utilities::CheckedReinterpretCast;
+using Microsoft::JSI::MakeMemoryMappedBigString;
 using Microsoft::JSI::MakeMemoryMappedBuffer;
 using Microsoft::VisualStudio::CppUnitTestFramework::Assert;
+using Microsoft::VisualStudio::CppUnitTestFramework::Logger;
 
 namespace {
 
@@ -40,6 +47,46 @@ uint32_t GetPageSize() noexcept {
   return systemInfo.dwPageSize;
 }
 
+size_t GetPrivateUsage() noexcept {
+  PROCESS_MEMORY_COUNTERS_EX counters{};
+  GetProcessMemoryInfo(GetCurrentProcess(), reinterpret_cast<PROCESS_MEMORY_COUNTERS *>(&counters), sizeof(counters));
+  return counters.PrivateUsage;
+}
+
+// Stands in for the script evaluation, which reads the whole script once.
+size_t CountLines(const JSBigString &script) noexcept {
+  size_t count = 0;
+  const char *data = script.c_str();
+  for (size_t i = 0; i < script.size(); ++i) {
+    count += data[i] == '\n';
+  }
+  return count;
+}
+
+// Reads the file to the heap as the bundle loaders did before the bundles were memory mapped.
+class CopiedBigString : public JSBigString {
+ public:
+  CopiedBigString(const std::wstring &filename) {
+    std::ifstream file{filename, std::ios::binary};
+    m_string.assign(std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{});
+  }
+
+  bool isAscii() const override {
+    return false;
+  }
+
+  const char *c_str() const override {
+    return m_string.c_str();
+  }
+
+  size_t size() const override {
+    return m_string.size();
+  }
+
+ private:
+  std::string m_string;
+};
+
 } // anonymous namespace
 
 namespace Microsoft::JSI::Test {
@@ -147,6 +194,69 @@ TEST_CLASS (MemoryMappedBufferUnitTests) {
       std::shared_ptr<Buffer> buffer = MakeMemoryMappedBuffer(m_testFileName.c_str(), badOffset);
     });
   }
+
+  TEST_METHOD(BigStringTest) {
+    constexpr const char *const content = "var message = 'This is a very interesting script.';";
+    const size_t size = strlen(content);
+    WriteTestFile(content, size);
+
+    std::unique_ptr<const JSBigString> bigString = MakeMemoryMappedBigString(m_testFileName.c_str());
+
+    Assert::IsTrue(bigString->size() == size);
+    Assert::IsTrue(strcmp(bigString->c_str(), content) == 0);
+  }
+
+  TEST_METHOD(BigStringTest_PageSizedFileIsNullTerminated) {
+    std::string content(GetPageSize(), 'a');
+    WriteTestFile(content.c_str(), content.length());
+
+    std::unique_ptr<const JSBigString> bigString = MakeMemoryMappedBigString(m_testFileName.c_str());
+
+    Assert::IsTrue(bigString->size() == content.length());
+    Assert::IsTrue(strcmp(bigString->c_str(), content.c_str()) == 0);
+  }
+
+  TEST_METHOD(BigStringTest_EmptyFile) {
+    WriteTestFile("", 0);
+
+    Assert::ExpectException<JSINativeException>(
+        [this] { std::unique_ptr<const JSBigString> bigString = MakeMemoryMappedBigString(m_testFileName.c_str()); });
+  }
+
+  TEST_METHOD(BigStringBenchmark_MappedVersusCopied) {
+    // A bundle of a large app, not a multiple of the page size.
+    std::string line = "__d(function(g,r,i,a,m,e,d){'use strict';m.exports=function(){return 42;};},0,[]);\n";
+    std::string content;
+    content.reserve(32 * 1024 * 1024);
+    while (content.size() + line.size() < content.capacity()) {
+      content += line;
+    }
+    WriteTestFile(content.c_str(), content.length());
+    size_t expectedLineCount = content.size() / line.size();
+    content = std::string{};
+
+    auto measure = [&](const char *name, auto &&loadScript) {
+      size_t privateUsageBefore = GetPrivateUsage();
+      auto start = std::chrono::steady_clock::now();
+      std::unique_ptr<const JSBigString> script = loadScript();
+      Assert::IsTrue(CountLines(*script) == expectedLineCount);
+      auto duration = std::chrono::steady_clock::now() - start;
+      size_t privateUsageAfter = GetPrivateUsage();
+      size_t privateUsageGrowth = privateUsageAfter > privateUsageBefore ? privateUsageAfter - privateUsageBefore : 0;
+
+      auto microseconds = std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+      std::string message = std::string{name} + ": first evaluate after " + std::to_string(microseconds) +
+          "us, private bytes grew by " + std::to_string(privateUsageGrowth / 1024) + "KB\n";
+      Logger::WriteMessage(message.c_str());
+      return privateUsageGrowth;
+    };
+
+    size_t copiedGrowth = measure("Copied", [this]() { return std::make_unique<CopiedBigString>(m_testFileName); });
+    size_t mappedGrowth = measure("Mapped", [this]() { return MakeMemoryMappedBigString(m_testFileName.c_str()); });
+
+    // The mapped script pages are backed by the file instead of the page file.
+    Assert::IsTrue(mappedGrowth < copiedGrowth);
+  }
 };
 
 } // namespace Microsoft::JSI::Test
@@ -0,0 +1,127 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <BaseScriptStoreImpl.h>
+#include <CppUnitTest.h>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+
+using namespace facebook::react;
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace fs = std::filesystem;
+
+using facebook::jsi::Buffer;
+using facebook::jsi::JSRuntimeSignature;
+using facebook::jsi::ScriptSignature;
+using facebook::jsi::StringBuffer;
+
+namespace {
+
+std::string ToString(const Buffer &buffer) {
+  return std::string(reinterpret_cast<const char *>(buffer.data()), buffer.size());
+}
+
+uint64_t HashOf(const std::string &text) {
+  return ComputeContentHash(reinterpret_cast<const uint8_t *>(text.data()), text.size());
+}
+
+size_t CountEntries(const fs::path &directory) {
+  size_t count = 0;
+  for (auto &entry : fs::directory_iterator(directory)) {
+    if (entry.path().extension() == ".prep") {
+      ++count;
+    }
+  }
+  return count;
+}
+
+} // namespace
+
+TEST_CLASS (PreparedScriptStoreTests) {
+  fs::path m_storeDirectory{fs::temp_directory_path() / "PreparedScriptStoreTests"};
+  JSRuntimeSignature m_runtimeSignature{"Chakra", 42};
+
+  TEST_METHOD_INITIALIZE(Initialize) {
+    fs::remove_all(m_storeDirectory);
+    fs::create_directories(m_storeDirectory);
+  }
+
+  TEST_METHOD_CLEANUP(CleanUp) {
+    fs::remove_all(m_storeDirectory);
+  }
+
+  TEST_METHOD(PreparedScriptStore_ComputeContentHash) {
+    // Reference values of xxHash64 with zero seed.
+    Assert::IsTrue(0xef46db3751d8e999ULL == HashOf(""));
+    Assert::IsTrue(0x44bc2cf5ad770999ULL == HashOf("abc"));
+    Assert::IsTrue(0xfbcea83c8a378bf1ULL == HashOf("Nobody inspects the spammish repetition"));
+
+    // Scripts of the same size get different versions.
+    Assert::IsTrue(HashOf("var a = 1;") != HashOf("var b = 2;"));
+  }
+
+  TEST_METHOD(PreparedScriptStore_PersistAndGet) {
+    ContentAddressedPreparedScriptStore store{m_storeDirectory.u8string()};
+    ScriptSignature scriptSignature{"index.bundle", HashOf("var a = 1;")};
+
+    Assert::IsTrue(nullptr == store.tryGetPreparedScript(scriptSignature, m_runtimeSignature, nullptr));
+
+    store.persistPreparedScript(
+        std::make_shared<StringBuffer>("prepared script"), scriptSignature, m_runtimeSignature, nullptr);
+    auto preparedScript = store.tryGetPreparedScript(scriptSignature, m_runtimeSignature, nullptr);
+    Assert::IsTrue(preparedScript != nullptr);
+    Assert::AreEqual(std::string{"prepared script"}, ToString(*preparedScript));
+
+    // The entries are addressed by the script content, runtime, and prepare tag.
+    ScriptSignature otherScriptSignature{"index.bundle", HashOf("var b = 2;")};
+    Assert::IsTrue(nullptr == store.tryGetPreparedScript(otherScriptSignature, m_runtimeSignature, nullptr));
+    Assert::IsTrue(nullptr == store.tryGetPreparedScript(scriptSignature, {"Chakra", 43}, nullptr));
+    Assert::IsTrue(nullptr == store.tryGetPreparedScript(scriptSignature, m_runtimeSignature, "lazy"));
+  }
+
+  TEST_METHOD(PreparedScriptStore_RejectsCorruptedEntry) {
+    ContentAddressedPreparedScriptStore store{m_storeDirectory.u8string()};
+    ScriptSignature scriptSignature{"index.bundle", HashOf("var a = 1;")};
+    store.persistPreparedScript(
+        std::make_shared<StringBuffer>("prepared script"), scriptSignature, m_runtimeSignature, nullptr);
+
+    fs::path entriesDirectory = m_storeDirectory / "PreparedScripts";
+    fs::path entryPath = fs::directory_iterator(entriesDirectory)->path();
+    {
+      std::fstream file{entryPath, std::ios::binary | std::ios::in | std::ios::out};
+      file.seekp(-1, std::ios::end);
+      file.put('X');
+    }
+
+    Assert::IsTrue(nullptr == store.tryGetPreparedScript(scriptSignature, m_runtimeSignature, nullptr));
+    Assert::IsFalse(fs::exists(entryPath));
+  }
+
+  TEST_METHOD(PreparedScriptStore_EvictsLeastRecentlyUsedEntries) {
+    std::string preparedScript(1024, 'p');
+    ContentAddressedPreparedScriptStore store{m_storeDirectory.u8string(), /*diskBudget:*/ 2500};
+    ScriptSignature first{"first.bundle", HashOf("first")};
+    ScriptSignature second{"second.bundle", HashOf("second")};
+    ScriptSignature third{"third.bundle", HashOf("third")};
+
+    store.persistPreparedScript(std::make_shared<StringBuffer>(preparedScript), first, m_runtimeSignature, nullptr);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    store.persistPreparedScript(std::make_shared<StringBuffer>(preparedScript), second, m_runtimeSignature, nullptr);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    // Using the first entry makes the second one the least recently used.
+    Assert::IsTrue(store.tryGetPreparedScript(first, m_runtimeSignature, nullptr) != nullptr);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    store.persistPreparedScript(std::make_shared<StringBuffer>(preparedScript), third, m_runtimeSignature, nullptr);
+
+    Assert::IsTrue(2 == CountEntries(m_storeDirectory / "PreparedScripts"));
+    Assert::IsTrue(store.tryGetPreparedScript(first, m_runtimeSignature, nullptr) != nullptr);
+    Assert::IsTrue(nullptr == store.tryGetPreparedScript(second, m_runtimeSignature, nullptr));
+    Assert::IsTrue(store.tryGetPreparedScript(third, m_runtimeSignature, nullptr) != nullptr);
+  }
+};
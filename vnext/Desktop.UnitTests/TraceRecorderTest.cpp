@@ -0,0 +1,188 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+#include <tracing/traceRecorder.h>
+
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace facebook::react::tracing;
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace {
+
+size_t CountOccurrences(const std::string &text, const std::string &pattern) {
+  size_t count = 0;
+  for (size_t pos = text.find(pattern); pos != std::string::npos; pos = text.find(pattern, pos + pattern.size())) {
+    ++count;
+  }
+  return count;
+}
+
+} // namespace
+
+TEST_CLASS (TraceRecorderTest) {
+  TEST_METHOD_INITIALIZE(Initialize) {
+    stopTraceRecording();
+    flushTraceEventsAsJson();
+  }
+
+  TEST_METHOD_CLEANUP(CleanUp) {
+    stopTraceRecording();
+    flushTraceEventsAsJson();
+  }
+
+  TEST_METHOD(TraceRecorderTest_InternTraceName) {
+    TraceNameId first = internTraceName("TraceRecorderTest_First");
+    TraceNameId second = internTraceName("TraceRecorderTest_Second");
+    Assert::IsTrue(first != second);
+    Assert::IsTrue(first == internTraceName(std::string{"TraceRecorderTest_First"}));
+
+    TraceNameId otherThreadId = 0;
+    std::thread{[&otherThreadId]() { otherThreadId = internTraceName("TraceRecorderTest_Second"); }}.join();
+    Assert::IsTrue(second == otherThreadId);
+  }
+
+  TEST_METHOD(TraceRecorderTest_RecordsOnlyWhenStarted) {
+    TraceNameId nameId = internTraceName("TraceRecorderTest_Section");
+    recordTraceEvent(TracePhase::Begin, 1 << 10, nameId);
+    Assert::IsTrue(std::string::npos == flushTraceEventsAsJson().find("TraceRecorderTest_Section"));
+
+    startTraceRecording();
+    std::string_view args[] = {"key", "value \"quoted\""};
+    recordTraceEvent(TracePhase::Begin, 1 << 10, nameId, 0, 0, args, 2);
+    recordTraceEvent(TracePhase::End, 1 << 10, nameId);
+    recordTraceEvent(TracePhase::AsyncBegin, 1 << 11, nameId, 42);
+    recordTraceEvent(TracePhase::Counter, 1 << 11, nameId, 0, 7);
+    stopTraceRecording();
+
+    std::string json = flushTraceEventsAsJson();
+    Assert::IsTrue(size_t{4} == CountOccurrences(json, "\"name\":\"TraceRecorderTest_Section\""));
+    Assert::IsTrue(std::string::npos != json.find("\"ph\":\"B\""));
+    Assert::IsTrue(std::string::npos != json.find("\"ph\":\"E\""));
+    Assert::IsTrue(std::string::npos != json.find("\"cat\":\"react_cxx_bridge\""));
+    Assert::IsTrue(std::string::npos != json.find("\"args\":{\"key\":\"value \\\"quoted\\\"\"}"));
+    Assert::IsTrue(std::string::npos != json.find("\"id\":\"0x2a\""));
+    Assert::IsTrue(std::string::npos != json.find("\"args\":{\"value\":7}"));
+    Assert::IsTrue(size_t{2} == CountOccurrences(json, "\"args\""));
+
+    // The flush moves the events out of the buffers.
+    Assert::IsTrue(size_t{0} == CountOccurrences(flushTraceEventsAsJson(), "TraceRecorderTest_Section"));
+  }
+
+  TEST_METHOD(TraceRecorderTest_CounterArgsInOneObject) {
+    TraceNameId nameId = internTraceName("TraceRecorderTest_Counter");
+    startTraceRecording();
+    std::string_view args[] = {"unit", "ms"};
+    recordTraceEvent(TracePhase::Counter, 1 << 11, nameId, 0, 7, args, 2);
+    stopTraceRecording();
+
+    std::string json = flushTraceEventsAsJson();
+    Assert::IsTrue(size_t{1} == CountOccurrences(json, "\"args\""));
+    Assert::IsTrue(std::string::npos != json.find("\"args\":{\"value\":7,\"unit\":\"ms\"}"));
+  }
+
+  TEST_METHOD(TraceRecorderTest_RecordsOnlyEnabledCategories) {
+    TraceNameId bridgeNameId = internTraceName("TraceRecorderTest_Bridge");
+    TraceNameId appsNameId = internTraceName("TraceRecorderTest_Apps");
+
+    startTraceRecording(1 << 10);
+    Assert::IsTrue(isTraceCategoryEnabled(1 << 10));
+    Assert::IsFalse(isTraceCategoryEnabled(1 << 11));
+    recordTraceEvent(TracePhase::Begin, 1 << 10, bridgeNameId);
+    recordTraceEvent(TracePhase::Begin, 1 << 11, appsNameId);
+    stopTraceRecording();
+    Assert::IsFalse(isTraceCategoryEnabled(1 << 10));
+
+    std::string json = flushTraceEventsAsJson();
+    Assert::IsTrue(std::string::npos != json.find("TraceRecorderTest_Bridge"));
+    Assert::IsTrue(std::string::npos == json.find("TraceRecorderTest_Apps"));
+  }
+
+  TEST_METHOD(TraceRecorderTest_NotifiesCategoriesListeners) {
+    std::vector<uint64_t> notifications;
+    uint32_t listenerId = addTraceCategoriesListener(
+        [&notifications](uint64_t enabledCategories) noexcept { notifications.push_back(enabledCategories); });
+
+    startTraceRecording(JSTraceCategory);
+    startTraceRecording(JSTraceCategory); // Not changed
+    stopTraceRecording();
+    removeTraceCategoriesListener(listenerId);
+    startTraceRecording();
+
+    // The listener gets the current categories when it is added.
+    Assert::IsTrue(3 == notifications.size());
+    Assert::IsTrue(0 == (notifications[0] & JSTraceCategory));
+    Assert::IsTrue(JSTraceCategory == (notifications[1] & JSTraceCategory));
+    Assert::IsTrue(0 == (notifications[2] & JSTraceCategory));
+  }
+
+  TEST_METHOD(TraceRecorderTest_ListenerCanRemoveItself) {
+    size_t notificationCount = 0;
+    uint32_t listenerId = 0;
+    listenerId = addTraceCategoriesListener([&notificationCount, &listenerId](uint64_t enabledCategories) noexcept {
+      ++notificationCount;
+      if ((enabledCategories & JSTraceCategory) != 0) {
+        removeTraceCategoriesListener(listenerId);
+      }
+    });
+
+    startTraceRecording(JSTraceCategory);
+    stopTraceRecording();
+
+    Assert::IsTrue(2 == notificationCount);
+  }
+
+  TEST_METHOD(TraceRecorderTest_DropsEventsWhenBufferIsFull) {
+    TraceNameId nameId = internTraceName("TraceRecorderTest_Overflow");
+    TraceRecorderStats before = getTraceRecorderStats();
+
+    startTraceRecording();
+    std::thread{[nameId]() {
+      for (size_t i = 0; i < TraceBufferCapacity + 10; ++i) {
+        recordTraceEvent(TracePhase::Counter, 1 << 11, nameId, 0, static_cast<int64_t>(i));
+      }
+    }}.join();
+    stopTraceRecording();
+
+    TraceRecorderStats after = getTraceRecorderStats();
+    Assert::IsTrue(uint64_t{TraceBufferCapacity} == after.RecordedCount - before.RecordedCount);
+    Assert::IsTrue(uint64_t{10} == after.DroppedCount - before.DroppedCount);
+    Assert::IsTrue(TraceBufferCapacity == CountOccurrences(flushTraceEventsAsJson(), "TraceRecorderTest_Overflow"));
+  }
+
+  TEST_METHOD(TraceRecorderTest_RecordingBenchmark) {
+    constexpr size_t threadCount = 4;
+    constexpr size_t eventCount = TraceBufferCapacity / 2;
+    TraceNameId nameId = internTraceName("TraceRecorderTest_Benchmark");
+
+    startTraceRecording();
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < threadCount; ++i) {
+      threads.emplace_back([nameId]() {
+        std::string_view args[] = {"index", "value"};
+        for (size_t j = 0; j < eventCount / 2; ++j) {
+          recordTraceEvent(TracePhase::Begin, 1 << 10, nameId, 0, 0, args, 2);
+          recordTraceEvent(TracePhase::End, 1 << 10, nameId);
+        }
+      });
+    }
+    for (auto &thread : threads) {
+      thread.join();
+    }
+    auto duration = std::chrono::steady_clock::now() - start;
+    stopTraceRecording();
+
+    auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+    std::string message = "Recorded " + std::to_string(threadCount * eventCount) + " events on " +
+        std::to_string(threadCount) + " threads in " + std::to_string(nanoseconds / 1000) + "us\n";
+    Logger::WriteMessage(message.c_str());
+
+    std::string json = flushTraceEventsAsJson();
+    Assert::IsTrue(threadCount * eventCount == CountOccurrences(json, "TraceRecorderTest_Benchmark"));
+  }
+};
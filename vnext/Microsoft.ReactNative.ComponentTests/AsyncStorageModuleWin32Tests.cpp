@@ -0,0 +1,328 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include <AsyncStorageModuleWin32Config.h>
+#include <Modules/AsyncStorageModuleWin32.h>
+#include <folly/json.h>
+
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <string>
+#include <vector>
+
+using facebook::react::AsyncStorageModuleWin32;
+
+namespace {
+
+constexpr size_t DefaultValueCacheBudget = 1024 * 1024;
+
+// Each module opens its own in-memory database, so the tests do not share the data.
+std::unique_ptr<AsyncStorageModuleWin32> MakeModule(size_t valueCacheBudget = DefaultValueCacheBudget) {
+  static bool isDBPathSet = (react::windows::SetAsyncStorageDBPath(":memory:"), true);
+  (void)isDBPathSet;
+  react::windows::SetAsyncStorageValueCacheBudget(valueCacheBudget);
+  auto module = std::make_unique<AsyncStorageModuleWin32>();
+  react::windows::SetAsyncStorageValueCacheBudget(DefaultValueCacheBudget);
+  return module;
+}
+
+// Records the callback arguments of the module method calls.
+struct CallResults {
+  facebook::xplat::module::CxxModule::Callback Add() {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    size_t index = m_results.size();
+    m_results.emplace_back();
+    ++m_pendingCount;
+    return [this, index](std::vector<folly::dynamic> args) {
+      std::lock_guard<std::mutex> lock{m_mutex};
+      m_results[index] = std::move(args);
+      if (--m_pendingCount == 0) {
+        m_completed.notify_all();
+      }
+    };
+  }
+
+  bool Wait() {
+    std::unique_lock<std::mutex> lock{m_mutex};
+    return m_completed.wait_for(lock, std::chrono::seconds(10), [this]() { return m_pendingCount == 0; });
+  }
+
+  // A write succeeded if its callback had no arguments.
+  bool Succeeded(size_t index) {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    return m_results[index].empty();
+  }
+
+  bool Failed(size_t index) {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    return !m_results[index].empty() && m_results[index][0].isObject();
+  }
+
+  // Returns the multiGet key-value pairs.
+  folly::dynamic Values(size_t index) {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    return m_results[index].size() == 2 ? m_results[index][1] : folly::dynamic{};
+  }
+
+ private:
+  std::mutex m_mutex;
+  std::condition_variable m_completed;
+  std::vector<std::vector<folly::dynamic>> m_results;
+  size_t m_pendingCount{0};
+};
+
+// Holds the module task queue while the tasks for the next batch are added.
+// The first task callback blocks the background thread until Release is called.
+struct TaskQueueBlocker {
+  explicit TaskQueueBlocker(AsyncStorageModuleWin32 &module) {
+    auto released = m_released.get_future().share();
+    Call(module, "getAllKeys", folly::dynamic::array(), [this, released](std::vector<folly::dynamic>) {
+      m_blocked.set_value();
+      released.wait();
+    });
+    m_blocked.get_future().wait();
+  }
+
+  void Release() {
+    m_released.set_value();
+  }
+
+  static void Call(
+      AsyncStorageModuleWin32 &module,
+      std::string_view methodName,
+      folly::dynamic &&args,
+      facebook::xplat::module::CxxModule::Callback &&callback) {
+    for (auto &method : module.getMethods()) {
+      if (method.name == methodName) {
+        method.func(std::move(args), std::move(callback), [](std::vector<folly::dynamic>) {});
+        return;
+      }
+    }
+    TestCheckFail("Unknown method");
+  }
+
+ private:
+  std::promise<void> m_blocked;
+  std::promise<void> m_released;
+};
+
+void Call(AsyncStorageModuleWin32 &module, std::string_view methodName, folly::dynamic &&args, CallResults &results) {
+  TaskQueueBlocker::Call(module, methodName, folly::dynamic::array(std::move(args)), results.Add());
+}
+
+folly::dynamic KeyValue(const std::string &key, const std::string &value) {
+  return folly::dynamic::array(key, value);
+}
+
+// Returns the value of the key in the multiGet result, or null if it is missing.
+folly::dynamic FindValue(const folly::dynamic &values, const std::string &key) {
+  for (auto &pair : values) {
+    if (pair[0] == key) {
+      return pair[1];
+    }
+  }
+  return nullptr;
+}
+
+} // namespace
+
+namespace facebook::react::test {
+
+TEST_CLASS (AsyncStorageModuleWin32Tests) {
+  TEST_METHOD(GroupCommit_AppliesAllWritesOfBatch) {
+    auto module = MakeModule();
+    CallResults results;
+    constexpr size_t writeCount = 100;
+
+    // The writes and the read wait behind the blocker, so they are run as one batch.
+    TaskQueueBlocker blocker{*module};
+    for (size_t i = 0; i < writeCount; ++i) {
+      Call(*module, "multiSet", folly::dynamic::array(KeyValue("key" + std::to_string(i), std::to_string(i))), results);
+    }
+    Call(*module, "multiRemove", folly::dynamic::array("key0"), results);
+    folly::dynamic keys = folly::dynamic::array;
+    for (size_t i = 0; i < writeCount; ++i) {
+      keys.push_back("key" + std::to_string(i));
+    }
+    Call(*module, "multiGet", std::move(keys), results);
+    blocker.Release();
+    TestCheck(results.Wait());
+
+    for (size_t i = 0; i <= writeCount; ++i) {
+      TestCheck(results.Succeeded(i));
+    }
+
+    // The read after the batch observes all committed writes.
+    auto values = results.Values(writeCount + 1);
+    TestCheckEqual(writeCount - 1, values.size());
+    TestCheck(FindValue(values, "key0").isNull());
+    TestCheck(FindValue(values, "key1") == "1");
+    TestCheck(FindValue(values, "key99") == "99");
+  }
+
+  TEST_METHOD(GroupCommit_RollsBackOnlyFailedTask) {
+    auto module = MakeModule();
+    CallResults setupResults;
+    Call(
+        *module,
+        "multiSet",
+        folly::dynamic::array(KeyValue("json", R"({"x":1})"), KeyValue("text", "abc")),
+        setupResults);
+    TestCheck(setupResults.Wait());
+
+    CallResults results;
+    TaskQueueBlocker blocker{*module};
+    Call(*module, "multiSet", folly::dynamic::array(KeyValue("before", "1")), results);
+    // The first pair is merged before the second one fails, because the text value is not JSON.
+    Call(
+        *module,
+        "multiMerge",
+        folly::dynamic::array(KeyValue("json", R"({"y":2})"), KeyValue("text", R"({"z":3})")),
+        results);
+    Call(*module, "multiSet", folly::dynamic::array(KeyValue("after", "2")), results);
+    Call(*module, "multiGet", folly::dynamic::array("json", "text", "before", "after"), results);
+    blocker.Release();
+    TestCheck(results.Wait());
+
+    TestCheck(results.Succeeded(0));
+    TestCheck(results.Failed(1));
+    TestCheck(results.Succeeded(2));
+
+    // The savepoint of the failed merge is rolled back, and the other tasks of the batch are committed.
+    auto values = results.Values(3);
+    TestCheck(folly::parseJson(FindValue(values, "json").getString()) == folly::parseJson(R"({"x":1})"));
+    TestCheck(FindValue(values, "text") == "abc");
+    TestCheck(FindValue(values, "before") == "1");
+    TestCheck(FindValue(values, "after") == "2");
+  }
+
+  TEST_METHOD(StatementCache_ReadsMoreArgCountsThanCached) {
+    // The value cache is disabled, so every read runs a statement.
+    auto module = MakeModule(/*valueCacheBudget:*/ 0);
+    constexpr size_t keyCount = 100;
+    folly::dynamic pairs = folly::dynamic::array;
+    for (size_t i = 0; i < keyCount; ++i) {
+      pairs.push_back(KeyValue("key" + std::to_string(i), std::to_string(i)));
+    }
+    CallResults setupResults;
+    Call(*module, "multiSet", std::move(pairs), setupResults);
+    TestCheck(setupResults.Wait());
+
+    // Each key count needs its own statement. The cache keeps only some of them, and the rest are finalized.
+    CallResults results;
+    for (size_t count = 1; count <= keyCount; ++count) {
+      folly::dynamic keys = folly::dynamic::array;
+      for (size_t i = 0; i < count; ++i) {
+        keys.push_back("key" + std::to_string(i));
+      }
+      Call(*module, "multiGet", std::move(keys), results);
+    }
+    TestCheck(results.Wait());
+
+    for (size_t count = 1; count <= keyCount; ++count) {
+      auto values = results.Values(count - 1);
+      TestCheckEqual(count, values.size());
+      TestCheck(FindValue(values, "key" + std::to_string(count - 1)) == std::to_string(count - 1));
+    }
+  }
+
+  TEST_METHOD(StatementCache_ResetsStatementBetweenTasks) {
+    auto module = MakeModule(/*valueCacheBudget:*/ 0);
+    CallResults setupResults;
+    Call(*module, "multiSet", folly::dynamic::array(KeyValue("a", "1"), KeyValue("b", "2")), setupResults);
+    TestCheck(setupResults.Wait());
+
+    // The cached statement for one key is reused with new bindings.
+    CallResults results;
+    Call(*module, "multiGet", folly::dynamic::array("a"), results);
+    Call(*module, "multiGet", folly::dynamic::array("b"), results);
+    Call(*module, "multiGet", folly::dynamic::array("c"), results);
+    Call(*module, "multiRemove", folly::dynamic::array("a"), results);
+    Call(*module, "multiGet", folly::dynamic::array("a"), results);
+    Call(*module, "multiGet", folly::dynamic::array("b"), results);
+    TestCheck(results.Wait());
+
+    TestCheck(results.Values(0) == folly::dynamic::array(KeyValue("a", "1")));
+    TestCheck(results.Values(1) == folly::dynamic::array(KeyValue("b", "2")));
+    TestCheckEqual(size_t{0}, results.Values(2).size());
+    TestCheck(results.Succeeded(3));
+    TestCheckEqual(size_t{0}, results.Values(4).size());
+    TestCheck(results.Values(5) == folly::dynamic::array(KeyValue("b", "2")));
+  }
+
+  TEST_METHOD(ValueCache_EvictsLeastRecentlyUsed) {
+    // The budget fits only a few entries.
+    auto module = MakeModule(/*valueCacheBudget:*/ 4096);
+    const std::string value(100, 'v');
+    constexpr size_t keyCount = 100;
+    folly::dynamic pairs = folly::dynamic::array;
+    for (size_t i = 0; i < keyCount; ++i) {
+      pairs.push_back(KeyValue("key" + std::to_string(i), value));
+    }
+    CallResults setupResults;
+    Call(*module, "multiSet", std::move(pairs), setupResults);
+    TestCheck(setupResults.Wait());
+    auto stats = module->GetValueCacheStats();
+    TestCheck(stats.EvictionCount > 0);
+
+    // The last written key is cached, and the first one is evicted.
+    CallResults results;
+    Call(*module, "multiGet", folly::dynamic::array("key99"), results);
+    TestCheck(results.Wait());
+    TestCheckEqual(stats.HitCount + 1, module->GetValueCacheStats().HitCount);
+    TestCheckEqual(stats.MissCount, module->GetValueCacheStats().MissCount);
+
+    Call(*module, "multiGet", folly::dynamic::array("key0"), results);
+    TestCheck(results.Wait());
+    TestCheckEqual(stats.MissCount + 1, module->GetValueCacheStats().MissCount);
+
+    // The read puts the key back to the cache.
+    Call(*module, "multiGet", folly::dynamic::array("key0"), results);
+    TestCheck(results.Wait());
+    TestCheckEqual(stats.HitCount + 2, module->GetValueCacheStats().HitCount);
+    TestCheck(results.Values(2) == folly::dynamic::array(KeyValue("key0", value)));
+  }
+
+  TEST_METHOD(ValueCache_IsUpdatedByWrites) {
+    auto module = MakeModule();
+    CallResults results;
+    Call(*module, "multiSet", folly::dynamic::array(KeyValue("key", R"({"x":1})")), results);
+    Call(*module, "multiGet", folly::dynamic::array("key"), results);
+    TestCheck(results.Wait());
+    auto stats = module->GetValueCacheStats();
+    TestCheckEqual(uint64_t{1}, stats.HitCount);
+    TestCheckEqual(uint64_t{0}, stats.MissCount);
+
+    // The set updates the cached value.
+    Call(*module, "multiSet", folly::dynamic::array(KeyValue("key", R"({"x":2})")), results);
+    Call(*module, "multiGet", folly::dynamic::array("key"), results);
+    TestCheck(results.Wait());
+    TestCheck(results.Values(3) == folly::dynamic::array(KeyValue("key", R"({"x":2})")));
+    TestCheckEqual(uint64_t{2}, module->GetValueCacheStats().HitCount);
+
+    // The merge invalidates the cached value, so it is read from the database.
+    Call(*module, "multiMerge", folly::dynamic::array(KeyValue("key", R"({"y":3})")), results);
+    Call(*module, "multiGet", folly::dynamic::array("key"), results);
+    TestCheck(results.Wait());
+    TestCheck(
+        folly::parseJson(FindValue(results.Values(5), "key").getString()) == folly::parseJson(R"({"x":2,"y":3})"));
+    TestCheckEqual(uint64_t{1}, module->GetValueCacheStats().MissCount);
+
+    // The remove caches the key as missing.
+    Call(*module, "multiRemove", folly::dynamic::array("key"), results);
+    Call(*module, "multiGet", folly::dynamic::array("key"), results);
+    TestCheck(results.Wait());
+    TestCheckEqual(size_t{0}, results.Values(7).size());
+    TestCheckEqual(uint64_t{3}, module->GetValueCacheStats().HitCount);
+
+    // The clear empties the cache.
+    Call(*module, "clear", folly::dynamic::array(), results);
+    Call(*module, "multiGet", folly::dynamic::array("key"), results);
+    TestCheck(results.Wait());
+    TestCheckEqual(uint64_t{2}, module->GetValueCacheStats().MissCount);
+  }
+};
+
+} // namespace facebook::react::test
@@ -0,0 +1,107 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include <JSI/ChakraRuntimeArgs.h>
+#include <JSI/ChakraRuntimeFactory.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+using namespace Microsoft::JSI;
+
+namespace {
+
+struct TestScriptStore : facebook::jsi::ScriptStore {
+  facebook::jsi::VersionedBuffer getVersionedScript(const std::string & /*url*/) noexcept override {
+    return {nullptr, 0};
+  }
+
+  facebook::jsi::ScriptVersion_t getScriptVersion(const std::string & /*url*/) noexcept override {
+    return 1;
+  }
+};
+
+struct TestPreparedScriptStore : facebook::jsi::PreparedScriptStore {
+  std::shared_ptr<const facebook::jsi::Buffer> tryGetPreparedScript(
+      const facebook::jsi::ScriptSignature & /*scriptSignature*/,
+      const facebook::jsi::JSRuntimeSignature & /*runtimeSignature*/,
+      const char * /*prepareTag*/) noexcept override {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    return m_preparedScript;
+  }
+
+  void persistPreparedScript(
+      std::shared_ptr<const facebook::jsi::Buffer> preparedScript,
+      const facebook::jsi::ScriptSignature & /*scriptMetadata*/,
+      const facebook::jsi::JSRuntimeSignature & /*runtimeMetadata*/,
+      const char * /*prepareTag*/) noexcept override {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    m_preparedScript = std::move(preparedScript);
+    m_persisted.notify_all();
+  }
+
+  bool WaitForPreparedScript() {
+    std::unique_lock<std::mutex> lock{m_mutex};
+    return m_persisted.wait_for(lock, std::chrono::seconds(10), [this]() { return m_preparedScript != nullptr; });
+  }
+
+ private:
+  std::mutex m_mutex;
+  std::condition_variable m_persisted;
+  std::shared_ptr<const facebook::jsi::Buffer> m_preparedScript;
+};
+
+} // namespace
+
+namespace Microsoft::JSI::Test {
+
+TEST_CLASS (ChakraPreparedScriptTests) {
+  std::shared_ptr<TestPreparedScriptStore> m_preparedScriptStore{std::make_shared<TestPreparedScriptStore>()};
+  std::shared_ptr<const facebook::jsi::Buffer> m_script{
+      std::make_shared<facebook::jsi::StringBuffer>("(function() { return 6 * 7; })()")};
+
+  std::unique_ptr<facebook::jsi::Runtime> MakeRuntime(bool enableBackgroundScriptPreparation) {
+    ChakraRuntimeArgs args{};
+    args.scriptStore = std::make_unique<TestScriptStore>();
+    args.preparedScriptStore = m_preparedScriptStore;
+    args.enableBackgroundScriptPreparation = enableBackgroundScriptPreparation;
+    return makeChakraRuntime(std::move(args));
+  }
+
+  TEST_METHOD(GeneratesPreparedScriptBeforeEvaluation) {
+    PreparedScriptStats before = getPreparedScriptStats();
+    auto runtime = MakeRuntime(/*enableBackgroundScriptPreparation:*/ false);
+    TestCheck(runtime->evaluateJavaScript(m_script, "test.js").getNumber() == 42);
+
+    // The prepared script is persisted before the evaluation returns.
+    TestCheck(m_preparedScriptStore->tryGetPreparedScript({"test.js", 1}, {"ChakraRuntime", 0}, nullptr) != nullptr);
+    PreparedScriptStats after = getPreparedScriptStats();
+    TestCheck(after.missCount - before.missCount == 1);
+    TestCheck(after.generatedCount - before.generatedCount == 0);
+  }
+
+  TEST_METHOD(GeneratesPreparedScriptInBackground) {
+    PreparedScriptStats before = getPreparedScriptStats();
+    {
+      auto runtime = MakeRuntime(/*enableBackgroundScriptPreparation:*/ true);
+      TestCheck(runtime->evaluateJavaScript(m_script, "test.js").getNumber() == 42);
+    }
+
+    TestCheck(m_preparedScriptStore->WaitForPreparedScript());
+    {
+      // The next run evaluates the prepared script.
+      auto runtime = MakeRuntime(/*enableBackgroundScriptPreparation:*/ true);
+      TestCheck(runtime->evaluateJavaScript(m_script, "test.js").getNumber() == 42);
+    }
+
+    PreparedScriptStats after = getPreparedScriptStats();
+    TestCheck(after.missCount - before.missCount == 1);
+    TestCheck(after.hitCount - before.hitCount == 1);
+    TestCheck(after.generatedCount - before.generatedCount == 1);
+    TestCheck(after.failedCount - before.failedCount == 0);
+  }
+};
+
+} // namespace Microsoft::JSI::Test
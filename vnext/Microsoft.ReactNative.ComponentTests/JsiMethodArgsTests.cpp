@@ -0,0 +1,301 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include <JSI/ChakraRuntime.h>
+#include <JsiReader.h>
+#include <JsiWriter.h>
+#include <JSValueWriter.h>
+#include <ModuleMethodInvoker.h>
+
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <tuple>
+#include <vector>
+
+namespace winrt::Microsoft::ReactNative {
+
+namespace {
+
+// Forwards the calls to a JsiReader, but does not expose its JsiMethodArgs.
+// The method invokers use the IJSValueReader calls with it as they do for a JSI runtime in another binary.
+struct ForwardingReader : implements<ForwardingReader, IJSValueReader> {
+  ForwardingReader(IJSValueReader const &reader) noexcept : m_reader{reader} {}
+
+  JSValueType ValueType() noexcept {
+    return m_reader.ValueType();
+  }
+
+  bool GetNextObjectProperty(hstring &propertyName) noexcept {
+    return m_reader.GetNextObjectProperty(propertyName);
+  }
+
+  bool GetNextArrayItem() noexcept {
+    return m_reader.GetNextArrayItem();
+  }
+
+  hstring GetString() noexcept {
+    return m_reader.GetString();
+  }
+
+  bool GetBoolean() noexcept {
+    return m_reader.GetBoolean();
+  }
+
+  int64_t GetInt64() noexcept {
+    return m_reader.GetInt64();
+  }
+
+  double GetDouble() noexcept {
+    return m_reader.GetDouble();
+  }
+
+ private:
+  IJSValueReader m_reader;
+};
+
+// Forwards the calls to a JsiWriter, but does not expose its JsiMethodArgs.
+struct ForwardingWriter : implements<ForwardingWriter, IJSValueWriter> {
+  ForwardingWriter(IJSValueWriter const &writer) noexcept : m_writer{writer} {}
+
+  void WriteNull() noexcept {
+    m_writer.WriteNull();
+  }
+
+  void WriteBoolean(bool value) noexcept {
+    m_writer.WriteBoolean(value);
+  }
+
+  void WriteInt64(int64_t value) noexcept {
+    m_writer.WriteInt64(value);
+  }
+
+  void WriteDouble(double value) noexcept {
+    m_writer.WriteDouble(value);
+  }
+
+  void WriteString(const winrt::hstring &value) noexcept {
+    m_writer.WriteString(value);
+  }
+
+  void WriteObjectBegin() noexcept {
+    m_writer.WriteObjectBegin();
+  }
+
+  void WritePropertyName(const winrt::hstring &name) noexcept {
+    m_writer.WritePropertyName(name);
+  }
+
+  void WriteObjectEnd() noexcept {
+    m_writer.WriteObjectEnd();
+  }
+
+  void WriteArrayBegin() noexcept {
+    m_writer.WriteArrayBegin();
+  }
+
+  void WriteArrayEnd() noexcept {
+    m_writer.WriteArrayEnd();
+  }
+
+ private:
+  IJSValueWriter m_writer;
+};
+
+using MethodInvoker = std::function<void(IJSValueReader const &, IJSValueWriter const &)>;
+
+// Wraps the method into the invokers that NativeModules.h uses for the synchronous and void asynchronous methods.
+// NativeModules.h cannot be included here because it needs the full Microsoft.ReactNative projection.
+template <class TResult, class... TArgs>
+MethodInvoker MakeInvoker(TResult (*method)(TArgs...) noexcept) noexcept {
+  return [method](IJSValueReader const &argReader, IJSValueWriter const &argWriter) noexcept {
+    if constexpr (std::is_void_v<TResult>) {
+      std::tuple<std::remove_const_t<std::remove_reference_t<TArgs>>...> inputArgs{};
+      ReadMethodArgs(argReader, inputArgs, std::index_sequence_for<TArgs...>{});
+      std::apply(method, std::move(inputArgs));
+    } else {
+      InvokeSyncMethod<TResult, TArgs...>(argReader, argWriter, method);
+    }
+  };
+}
+
+int Add(int x, int y) noexcept {
+  return x + y;
+}
+
+std::string Concat(std::string a, std::string b) noexcept {
+  return a + b;
+}
+
+std::optional<double> Scale(std::optional<double> value, float factor) noexcept {
+  return value ? std::optional<double>{*value * factor} : std::nullopt;
+}
+
+std::wstring Describe(bool flag, uint8_t count, std::wstring name) noexcept {
+  return name + (flag ? L":" : L"!") + std::to_wstring(count);
+}
+
+size_t s_logLength{0};
+
+void Log(std::string message, int level) noexcept {
+  s_logLength += message.size() + level;
+}
+
+} // namespace
+
+TEST_CLASS (JsiMethodArgsTests) {
+  ::Microsoft::JSI::ChakraRuntime m_runtime;
+
+  JsiMethodArgsTests() : m_runtime({}) {}
+
+  // jsi::Value cannot be copied from an initializer list.
+  template <class... TValues>
+  static std::vector<facebook::jsi::Value> Args(TValues &&... values) {
+    std::vector<facebook::jsi::Value> args;
+    args.reserve(sizeof...(TValues));
+    (args.emplace_back(std::forward<TValues>(values)), ...);
+    return args;
+  }
+
+  // Calls the method as TurboModules do it, with or without the direct access to the JSI values.
+  facebook::jsi::Value
+  CallSync(MethodInvoker const &method, std::vector<facebook::jsi::Value> const &args, bool direct) {
+    IJSValueReader reader = winrt::make<JsiReader>(m_runtime, args.data(), args.size());
+    IJSValueWriter writer = winrt::make<JsiWriter>(m_runtime);
+    if (direct) {
+      method(reader, writer);
+    } else {
+      method(winrt::make<ForwardingReader>(reader), winrt::make<ForwardingWriter>(writer));
+    }
+
+    return writer.as<JsiWriter>()->MoveResult();
+  }
+
+  void CheckSameResult(MethodInvoker const &method, std::vector<facebook::jsi::Value> const &args) {
+    auto directResult = CallSync(method, args, /*direct:*/ true);
+    auto abiResult = CallSync(method, args, /*direct:*/ false);
+    TestCheck(facebook::jsi::Value::strictEquals(m_runtime, directResult, abiResult));
+  }
+
+  facebook::jsi::Value Str(const char *value) {
+    return facebook::jsi::String::createFromUtf8(m_runtime, value);
+  }
+
+  template <class TCallMethod>
+  void RunBenchmark(const char *signature, TCallMethod &&callMethod) {
+    constexpr size_t callCount = 100000;
+    double callsPerSecond[2];
+    for (bool direct : {true, false}) {
+      auto start = std::chrono::steady_clock::now();
+      for (size_t i = 0; i < callCount; ++i) {
+        callMethod(direct);
+      }
+      std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+      callsPerSecond[direct ? 0 : 1] = callCount / duration.count();
+    }
+
+    std::cout << signature << ": " << static_cast<int64_t>(callsPerSecond[0]) << " calls/s with JSI values, "
+              << static_cast<int64_t>(callsPerSecond[1]) << " calls/s with IJSValueReader/IJSValueWriter\n";
+  }
+
+  TEST_METHOD(ReadsAndWritesJsiValuesDirectly) {
+    auto add = MakeInvoker(&Add);
+    auto result = CallSync(add, Args(facebook::jsi::Value{2}, facebook::jsi::Value{3.7}), /*direct:*/ true);
+    TestCheckEqual(5.0, result.getNumber());
+
+    auto concat = MakeInvoker(&Concat);
+    result = CallSync(concat, Args(Str("Hello, "), Str("World")), /*direct:*/ true);
+    TestCheckEqual("Hello, World", result.getString(m_runtime).utf8(m_runtime));
+
+    auto scale = MakeInvoker(&Scale);
+    TestCheck(CallSync(scale, Args(facebook::jsi::Value::null(), facebook::jsi::Value{2}), /*direct:*/ true).isNull());
+  }
+
+  TEST_METHOD(ConvertsValuesAsJSValueReader) {
+    // The values of unexpected types and the missing values must give the same results on both paths.
+    auto add = MakeInvoker(&Add);
+    CheckSameResult(add, Args(Str("40"), facebook::jsi::Value{true}));
+    CheckSameResult(add, Args(Str("4x"), facebook::jsi::Value::null()));
+    CheckSameResult(add, Args(facebook::jsi::Object{m_runtime}, facebook::jsi::Value{-2.5}));
+    CheckSameResult(add, Args(facebook::jsi::Value{1}));
+
+    auto concat = MakeInvoker(&Concat);
+    CheckSameResult(concat, Args(facebook::jsi::Value{42}, facebook::jsi::Value{1.5}));
+    CheckSameResult(concat, Args(facebook::jsi::Value{false}, facebook::jsi::Value::undefined()));
+
+    auto scale = MakeInvoker(&Scale);
+    CheckSameResult(scale, Args(facebook::jsi::Value{1.5}, facebook::jsi::Value{2}));
+    CheckSameResult(scale, Args(facebook::jsi::Value::undefined(), facebook::jsi::Value{2}));
+    CheckSameResult(scale, Args(Str("0.5"), Str("3")));
+
+    auto describe = MakeInvoker(&Describe);
+    CheckSameResult(describe, Args(facebook::jsi::Value{true}, facebook::jsi::Value{300}, Str("\xD0\x96")));
+    CheckSameResult(describe, Args(facebook::jsi::Value{0}, Str("7"), facebook::jsi::Value{12}));
+  }
+
+  TEST_METHOD(WritesResultArgsAsWriteArgs) {
+    IJSValueWriter directWriter = winrt::make<JsiWriter>(m_runtime);
+    TestCheck(TryWriteJsiResultArgs(directWriter, std::string{"Hello"}, 42, std::optional<bool>{}));
+
+    IJSValueWriter abiWriter = winrt::make<JsiWriter>(m_runtime);
+    TestCheck(!TryWriteJsiResultArgs(winrt::make<ForwardingWriter>(abiWriter), std::string{"Hello"}));
+    WriteArgs(abiWriter, std::string{"Hello"}, 42, std::optional<bool>{});
+
+    const facebook::jsi::Value *directArgs = nullptr;
+    size_t directCount = 0;
+    directWriter.as<JsiWriter>()->AccessResultAsArgs(directArgs, directCount);
+    const facebook::jsi::Value *abiArgs = nullptr;
+    size_t abiCount = 0;
+    abiWriter.as<JsiWriter>()->AccessResultAsArgs(abiArgs, abiCount);
+    TestCheckEqual(size_t{3}, directCount);
+    TestCheckEqual(abiCount, directCount);
+    for (size_t i = 0; i < directCount; ++i) {
+      TestCheck(facebook::jsi::Value::strictEquals(m_runtime, directArgs[i], abiArgs[i]));
+    }
+  }
+
+  TEST_METHOD(ReadsVoidMethodArgs) {
+    auto log = MakeInvoker(&Log);
+    std::vector<facebook::jsi::Value> logArgs;
+    logArgs.push_back(Str("Message"));
+    logArgs.emplace_back(1);
+    for (bool direct : {true, false}) {
+      // The void methods do not write a result, so the writer is not read.
+      s_logLength = 0;
+      IJSValueReader reader = winrt::make<JsiReader>(m_runtime, logArgs.data(), logArgs.size());
+      IJSValueWriter writer = winrt::make<JsiWriter>(m_runtime);
+      log(direct ? reader : winrt::make<ForwardingReader>(reader), writer);
+      TestCheckEqual(size_t{8}, s_logLength);
+    }
+  }
+
+  // The benchmark is disabled to keep the timing output out of the regular test runs.
+  // Run it with the --gtest_also_run_disabled_tests option.
+  TEST_METHOD(DISABLED_MethodCallBenchmark) {
+    auto add = MakeInvoker(&Add);
+    std::vector<facebook::jsi::Value> addArgs;
+    addArgs.emplace_back(2);
+    addArgs.emplace_back(3);
+    RunBenchmark("int Add(int, int)", [&](bool direct) { CallSync(add, addArgs, direct); });
+
+    auto concat = MakeInvoker(&Concat);
+    std::vector<facebook::jsi::Value> concatArgs;
+    concatArgs.push_back(Str("The quick brown fox "));
+    concatArgs.push_back(Str("jumps over the lazy dog"));
+    RunBenchmark("string Concat(string, string)", [&](bool direct) { CallSync(concat, concatArgs, direct); });
+
+    auto log = MakeInvoker(&Log);
+    std::vector<facebook::jsi::Value> logArgs;
+    logArgs.push_back(Str("Message"));
+    logArgs.emplace_back(1);
+    IJSValueWriter noOpWriter = winrt::make<JsiWriter>(m_runtime);
+    RunBenchmark("void Log(string, int)", [&](bool direct) {
+      IJSValueReader reader = winrt::make<JsiReader>(m_runtime, logArgs.data(), logArgs.size());
+      log(direct ? reader : winrt::make<ForwardingReader>(reader), noOpWriter);
+    });
+    TestCheck(s_logLength > 0);
+  }
+};
+
+} // namespace winrt::Microsoft::ReactNative
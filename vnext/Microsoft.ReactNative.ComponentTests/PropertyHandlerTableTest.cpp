@@ -0,0 +1,209 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include <JSValue.h>
+#include <Utils/PropertyHandlerTable.h>
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace Microsoft::ReactNative {
+
+using winrt::Microsoft::ReactNative::JSValue;
+using winrt::Microsoft::ReactNative::JSValueObject;
+
+namespace {
+
+// Counts the property updates instead of changing a XAML element.
+struct TestNode {
+  size_t baseUpdates{0};
+  size_t elementUpdates{0};
+  size_t viewUpdates{0};
+  double checksum{0};
+};
+
+// The managers mirror the ViewManagerBase, FrameworkElementViewManager and ViewViewManager class hierarchy.
+struct TestBaseManager {
+  bool UpdateBaseProperty(TestNode &node, PropName /*propName*/, const JSValue &propertyValue) {
+    ++node.baseUpdates;
+    node.checksum += propertyValue.AsBoolean() ? 1 : 0;
+    return true;
+  }
+};
+
+struct TestElementManager : TestBaseManager {
+  bool UpdateElementProperty(TestNode &node, PropName /*propName*/, const JSValue &propertyValue) {
+    ++node.elementUpdates;
+    node.checksum += propertyValue.AsDouble();
+    return true;
+  }
+};
+
+struct TestViewManager : TestElementManager {
+  bool UpdateViewProperty(TestNode &node, PropName /*propName*/, const JSValue &propertyValue) {
+    ++node.viewUpdates;
+    node.checksum += propertyValue.AsDouble();
+    return true;
+  }
+};
+
+template <class TManager>
+using TestPropertyHandler = bool (TManager::*)(TestNode &node, PropName propName, const JSValue &propertyValue);
+template <class TManager>
+using TestPropertyHandlers = PropertyHandlerTable<TestPropertyHandler<TManager>>;
+
+const TestPropertyHandlers<TestBaseManager> &BaseHandlers() {
+  static const TestPropertyHandlers<TestBaseManager> handlers{
+      &TestBaseManager::UpdateBaseProperty, {PropName::onLayout, PropName::keyDownEvents}};
+  return handlers;
+}
+
+const TestPropertyHandlers<TestElementManager> &ElementHandlers() {
+  static const TestPropertyHandlers<TestElementManager> handlers{
+      BaseHandlers(),
+      &TestElementManager::UpdateElementProperty,
+      {PropName::opacity,
+       PropName::width,
+       PropName::height,
+       PropName::accessibilityLabel,
+       PropName::testID,
+       PropName::zIndex}};
+  return handlers;
+}
+
+const TestPropertyHandlers<TestViewManager> &ViewHandlers() {
+  static const TestPropertyHandlers<TestViewManager> handlers{
+      ElementHandlers(),
+      &TestViewManager::UpdateViewProperty,
+      {PropName::backgroundColor, PropName::borderWidth, PropName::borderRadius, PropName::tabIndex, PropName::zIndex}};
+  return handlers;
+}
+
+bool UpdateWithTable(TestViewManager &manager, TestNode &node, const JSValueObject &props) {
+  bool handledAll = true;
+  for (const auto &pair : props) {
+    PropName propName = GetPropName(pair.first);
+    if (TestPropertyHandler<TestViewManager> handler = ViewHandlers().Find(propName)) {
+      handledAll = (manager.*handler)(node, propName, pair.second) && handledAll;
+    } else {
+      handledAll = false;
+    }
+  }
+
+  return handledAll;
+}
+
+// Dispatches the properties as the UpdateProperty chains did before the tables:
+// every class compares the name with its property names and then calls the base class.
+bool UpdateWithChain(
+    TestViewManager &manager,
+    TestNode &node,
+    const std::string &propertyName,
+    const JSValue &propertyValue) {
+  if (propertyName == "backgroundColor" || propertyName == "borderWidth" || propertyName == "borderRadius" ||
+      propertyName == "tabIndex" || propertyName == "zIndex") {
+    return manager.UpdateViewProperty(node, PropName::Unknown, propertyValue);
+  } else if (
+      propertyName == "opacity" || propertyName == "width" || propertyName == "height" ||
+      propertyName == "accessibilityLabel" || propertyName == "testID") {
+    return manager.UpdateElementProperty(node, PropName::Unknown, propertyValue);
+  } else if (propertyName == "onLayout" || propertyName == "keyDownEvents") {
+    return manager.UpdateBaseProperty(node, PropName::Unknown, propertyValue);
+  }
+
+  return false;
+}
+
+// The props of one row in a large list: a few layout and accessibility props, a style and an unknown prop.
+JSValueObject MakeRowProps(int row) {
+  return JSValueObject{
+      {"accessibilityLabel", row},
+      {"backgroundColor", 0x00FF00},
+      {"borderRadius", 4},
+      {"borderWidth", 1},
+      {"height", 48},
+      {"onLayout", true},
+      {"opacity", 1},
+      {"tabIndex", row},
+      {"testID", row},
+      {"unknownProp", 1},
+      {"width", 320},
+  };
+}
+
+} // namespace
+
+TEST_CLASS (PropertyHandlerTableTest) {
+  TEST_METHOD(MergesBaseClassHandlers) {
+    TestCheck(ViewHandlers().Find(PropName::onLayout) == &TestBaseManager::UpdateBaseProperty);
+    TestCheck(ViewHandlers().Find(PropName::width) == &TestElementManager::UpdateElementProperty);
+    TestCheck(ViewHandlers().Find(PropName::backgroundColor) == &TestViewManager::UpdateViewProperty);
+    TestCheck(ViewHandlers().Find(PropName::keyUpEvents) == nullptr);
+    TestCheck(ViewHandlers().Find(PropName::Unknown) == nullptr);
+
+    // The base class tables are not changed by the derived class.
+    TestCheck(ElementHandlers().Find(PropName::backgroundColor) == nullptr);
+    TestCheck(BaseHandlers().Find(PropName::width) == nullptr);
+  }
+
+  TEST_METHOD(OverridesBaseClassHandlers) {
+    TestCheck(ElementHandlers().Find(PropName::zIndex) == &TestElementManager::UpdateElementProperty);
+    TestCheck(ViewHandlers().Find(PropName::zIndex) == &TestViewManager::UpdateViewProperty);
+  }
+
+  TEST_METHOD(UpdatesSameAsChain) {
+    TestViewManager manager;
+    JSValueObject props = MakeRowProps(7);
+    TestNode tableNode;
+    TestCheck(!UpdateWithTable(manager, tableNode, props));
+
+    TestNode chainNode;
+    for (const auto &pair : props) {
+      UpdateWithChain(manager, chainNode, pair.first, pair.second);
+    }
+
+    TestCheckEqual(chainNode.baseUpdates, tableNode.baseUpdates);
+    TestCheckEqual(chainNode.elementUpdates, tableNode.elementUpdates);
+    TestCheckEqual(chainNode.viewUpdates, tableNode.viewUpdates);
+    TestCheckEqual(chainNode.checksum, tableNode.checksum);
+  }
+
+  // The benchmark is disabled in regular test runs. Run it with --gtest_also_run_disabled_tests.
+  TEST_METHOD(DISABLED_ListUpdateBenchmark) {
+    constexpr int rowCount = 10000;
+    std::vector<JSValueObject> rows;
+    rows.reserve(rowCount);
+    size_t propCount = 0;
+    for (int row = 0; row < rowCount; ++row) {
+      rows.push_back(MakeRowProps(row));
+      propCount += rows.back().size();
+    }
+
+    TestViewManager manager;
+    TestNode tableNode;
+    auto start = std::chrono::steady_clock::now();
+    for (const auto &props : rows) {
+      UpdateWithTable(manager, tableNode, props);
+    }
+    std::chrono::duration<double> tableDuration = std::chrono::steady_clock::now() - start;
+
+    TestNode chainNode;
+    start = std::chrono::steady_clock::now();
+    for (const auto &props : rows) {
+      for (const auto &pair : props) {
+        UpdateWithChain(manager, chainNode, pair.first, pair.second);
+      }
+    }
+    std::chrono::duration<double> chainDuration = std::chrono::steady_clock::now() - start;
+
+    TestCheckEqual(chainNode.checksum, tableNode.checksum);
+    std::cout << rowCount << " list rows: " << static_cast<int64_t>(propCount / tableDuration.count())
+              << " prop updates/s with handler tables, " << static_cast<int64_t>(propCount / chainDuration.count())
+              << " prop updates/s with UpdateProperty chains\n";
+  }
+};
+
+} // namespace Microsoft::ReactNative
@@ -0,0 +1,27 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include <Utils/PropertyNames.h>
+
+namespace Microsoft::ReactNative {
+
+TEST_CLASS (PropertyNamesTest) {
+  TEST_METHOD(KnownNames) {
+#define CHECK_PROP_NAME(name)                                                 \
+  TestCheck(GetPropName(#name) == PropName::name);                            \
+  TestCheckEqual(std::string_view{#name}, GetPropNameString(PropName::name));
+    RNW_PROP_NAMES(CHECK_PROP_NAME)
+#undef CHECK_PROP_NAME
+  }
+
+  TEST_METHOD(UnknownNames) {
+    TestCheck(GetPropName("") == PropName::Unknown);
+    TestCheck(GetPropName("fontSize") == PropName::Unknown);
+    TestCheck(GetPropName("widths") == PropName::Unknown);
+    TestCheck(GetPropName("Width") == PropName::Unknown);
+    TestCheck(GetPropNameString(PropName::Unknown).empty());
+  }
+};
+
+} // namespace Microsoft::ReactNative
@@ -0,0 +1,108 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "FlatMap.h"
+#include "JSValue.h"
+
+namespace winrt::Microsoft::ReactNative {
+
+TEST_CLASS (FlatMapTest) {
+  TEST_METHOD(TestKeepsKeysSorted) {
+    FlatMap<std::string, int> map;
+    TestCheck(map.try_emplace("b", 2).second);
+    TestCheck(map.try_emplace("d", 4).second);
+    TestCheck(map.try_emplace("a", 1).second);
+    TestCheck(map.try_emplace(std::string_view{"c"}, 3).second);
+
+    // The existing values are not replaced.
+    auto result = map.try_emplace("b", 20);
+    TestCheck(!result.second);
+    TestCheckEqual(2, result.first->second);
+    TestCheck(!map.emplace("d", 40).second);
+    TestCheckEqual(4, map.at("d"));
+
+    TestCheckEqual(4u, map.size());
+    std::string keys;
+    for (auto const &pair : map) {
+      keys += pair.first;
+    }
+    TestCheckEqual("abcd", keys);
+  }
+
+  TEST_METHOD(TestLookup) {
+    FlatMap<std::string, int> map;
+    map.try_emplace("width", 1);
+    map.try_emplace("height", 2);
+    map.try_emplace("opacity", 3);
+
+    TestCheck(map.find(std::string_view{"height"}) != map.end());
+    TestCheckEqual(2, map.find("height")->second);
+    TestCheck(map.find("margin") == map.end());
+    TestCheckEqual(1u, map.count("opacity"));
+    TestCheckEqual(0u, map.count("zIndex"));
+    TestCheck(map.contains(std::string{"width"}));
+    TestCheckEqual("opacity", map.lower_bound("margin")->first);
+    TestCheckEqual("width", map.upper_bound("opacity")->first);
+  }
+
+  TEST_METHOD(TestInsertAndErase) {
+    FlatMap<std::string, int> map;
+    auto it = map.lower_bound("b");
+    TestCheckEqual(2, map.emplace_hint(it, "b", 2)->second);
+    // The wrong hint is ignored.
+    TestCheckEqual(1, map.emplace_hint(map.end(), "a", 1)->second);
+    TestCheck(map.insert({"c", 3}).second);
+    TestCheck(!map.insert_or_assign("c", 30).second);
+    TestCheckEqual(30, map.at("c"));
+    TestCheck(map.insert_or_assign("e", 5).second);
+    TestCheckEqual("a", map.begin()->first);
+    TestCheckEqual("e", map.rbegin()->first);
+
+    TestCheckEqual(1u, map.erase("b"));
+    TestCheckEqual(0u, map.erase("b"));
+    TestCheckEqual("c", map.erase(map.begin())->first);
+    TestCheckEqual(2u, map.size());
+
+    map.clear();
+    TestCheck(map.empty());
+  }
+
+  TEST_METHOD(TestKeepsReferencesOnInsertAndErase) {
+    FlatMap<std::string, int> map;
+    int &middle = map.try_emplace("m", 13).first->second;
+    auto &middlePair = *map.find("m");
+    for (char key = 'a'; key <= 'z'; ++key) {
+      map.try_emplace(std::string(1, key), key - 'a');
+    }
+
+    map.erase("a");
+    map.erase("z");
+    map.insert_or_assign("b", 100);
+    TestCheckEqual(13, middle);
+    TestCheckEqual(&middle, &map.at("m"));
+    TestCheckEqual(&middlePair, &*map.find("m"));
+    TestCheckEqual(24u, map.size());
+
+    // The erased slots are reused.
+    map.try_emplace("a", 0);
+    map.reserve(100);
+    TestCheckEqual(&middle, &map.at("m"));
+    TestCheckEqual(13, middle);
+  }
+
+  TEST_METHOD(TestMoveOnlyValues) {
+    FlatMap<std::string, JSValue> map;
+    map.try_emplace("str", "Hello");
+    map.try_emplace("obj", JSValueObject{{"x", 1}});
+    map.try_emplace("arr", JSValueArray{1, 2});
+
+    FlatMap<std::string, JSValue> movedMap = std::move(map);
+    TestCheckEqual(3u, movedMap.size());
+    TestCheckEqual("Hello", movedMap.at("str").AsString());
+    TestCheckEqual(1, movedMap.at("obj")["x"].AsInt32());
+    TestCheckEqual(2u, movedMap.at("arr").ItemCount());
+  }
+};
+
+} // namespace winrt::Microsoft::ReactNative
@@ -4,6 +4,7 @@
 #include "pch.h"
 #include "JSValueReader.h"
 #include <variant>
+#include "JSValueTreeReader.h"
 #include "JSValueWriter.h"
 #include "JsonJSValueReader.h"
 
@@ -276,6 +277,72 @@ TEST_CLASS (JSValueReaderTest) {
     TestCheck(jsValue["Extra"]["MovieSeries"] == "Episode 2");
   }
 
+  TEST_METHOD(TestReadBorrowedJSValueObject) {
+    JSValueObject props{
+        {"Name", "Bob"},
+        {"Age", 42},
+        {"Steps", JSValueArray{1, 2, 3}},
+        {"Dimensions", JSValueObject{{"Width", 24}, {"Height", 78}}},
+        {"Extra", nullptr}};
+
+    IJSValueReader reader = MakeBorrowedJSValueTreeReader(props);
+    TestCheck(reader.ValueType() == JSValueType::Object);
+    TestCheck(JSValue::ReadObjectFrom(reader).Equals(props));
+
+    // The reader does not own a copy of the props.
+    props["Age"] = 43;
+    IJSValueReader changedReader = MakeBorrowedJSValueTreeReader(props);
+    TestCheck(JSValue::ReadFrom(changedReader)["Age"] == 43);
+
+    JSValueObject emptyProps;
+    IJSValueReader emptyReader = MakeBorrowedJSValueTreeReader(emptyProps);
+    hstring propertyName;
+    TestCheck(emptyReader.ValueType() == JSValueType::Object);
+    TestCheck(!emptyReader.GetNextObjectProperty(propertyName));
+    TestCheck(propertyName.empty());
+  }
+
+  TEST_METHOD(TestReadBorrowedJSValueArray) {
+    JSValueArray args{42, "Hello", JSValueArray{1, 2}, JSValueObject{{"X", 5}, {"Y", 6}}};
+
+    IJSValueReader reader = MakeBorrowedJSValueTreeReader(args);
+    int number{};
+    std::string text;
+    std::vector<int> steps;
+    RobotPoint point{};
+    ReadArgs(reader, number, text, steps, point);
+    TestCheckEqual(42, number);
+    TestCheckEqual("Hello", text);
+    TestCheck(steps == std::vector<int>{1, 2});
+    TestCheckEqual(5, point.X);
+    TestCheckEqual(6, point.Y);
+    TestCheck(reader.ValueType() == JSValueType::Array);
+
+    IJSValueReader arrayReader = MakeBorrowedJSValueTreeReader(args);
+    TestCheck(JSValue::ReadArrayFrom(arrayReader).Equals(args));
+  }
+
+  TEST_METHOD(TestReadInvalidatedBorrowedValue) {
+    JSValueObject props{{"Name", "Bob"}, {"Steps", JSValueArray{1, 2, 3}}};
+    auto readerImpl = make_self<JSValueTreeReader>(props);
+    IJSValueReader reader = *readerImpl;
+
+    // Stop in the middle of the nested array to check that the invalidated reader drops its stack.
+    hstring propertyName;
+    TestCheck(reader.GetNextObjectProperty(propertyName));
+    TestCheck(reader.GetNextObjectProperty(propertyName));
+    TestCheck(reader.GetNextArrayItem());
+    TestCheckEqual(1, reader.GetInt64());
+
+    readerImpl->Invalidate();
+    TestCheck(reader.ValueType() == JSValueType::Null);
+    TestCheck(!reader.GetNextArrayItem());
+    TestCheck(!reader.GetNextObjectProperty(propertyName));
+    TestCheck(propertyName.empty());
+    TestCheckEqual(0, reader.GetInt64());
+    TestCheck(reader.GetString().empty());
+  }
+
   TEST_METHOD(TestReadValueDefaultExtensions) {
     const wchar_t *json =
         LR"JSON({
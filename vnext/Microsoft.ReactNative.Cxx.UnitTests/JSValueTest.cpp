@@ -697,6 +697,21 @@ TEST_CLASS (JSValueTest) {
     TestCheck(value["prop10"] == 10);
   }
 
+  TEST_METHOD(TestJSValueObjectReferenceStability) {
+    // The references returned by operator[] stay valid while other properties are added.
+    JSValueObject obj;
+    JSValue &style = obj["style"];
+    JSValue &width = obj["width"];
+    for (int i = 0; i < 20; ++i) {
+      obj["prop" + std::to_string(i)] = i;
+    }
+    style = JSValueObject{{"color", "red"}};
+    width = 100;
+    TestCheck(obj.size() == 22);
+    TestCheck(obj["style"]["color"] == "red");
+    TestCheck(obj["width"] == 100);
+  }
+
   TEST_METHOD(TestJSValueArray1) {
     JSValue value = JSValueArray{1, "Two", 3.3, true, nullptr};
     TestCheck(value.Type() == JSValueType::Array);
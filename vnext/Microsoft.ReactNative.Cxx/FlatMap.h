@@ -0,0 +1,452 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+// IMPORTANT: Before updating this file
+// please read react-native-windows repo:
+// vnext/Microsoft.ReactNative.Cxx/README.md
+
+#pragma once
+#ifndef MICROSOFT_REACTNATIVE_FLATMAP
+#define MICROSOFT_REACTNATIVE_FLATMAP
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "Crash.h"
+
+namespace winrt::Microsoft::ReactNative {
+
+//! FlatMap is an ordered associative container that implements the subset of the std::map interface
+//! that is used with JSValueObject.
+//! The key-value pairs are allocated in blocks that grow geometrically, and a sorted std::vector of pair pointers
+//! is used for the lookup and ordered iteration. It needs a few allocations per map instead of one per pair.
+//! Like with std::map, the references to the pairs stay valid until the pairs are erased.
+//! Unlike std::map, inserting or erasing pairs invalidates iterators.
+//! The TCompare must be a stateless comparison type such as std::less<>.
+template <class TKey, class TValue, class TCompare = std::less<>>
+struct FlatMap {
+  using key_type = TKey;
+  using mapped_type = TValue;
+  using value_type = std::pair<const TKey, TValue>;
+  using key_compare = TCompare;
+  using size_type = size_t;
+  using difference_type = ptrdiff_t;
+  using reference = value_type &;
+  using const_reference = value_type const &;
+
+  template <class TPair>
+  struct Iterator {
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = std::remove_const_t<TPair>;
+    using difference_type = ptrdiff_t;
+    using pointer = TPair *;
+    using reference = TPair &;
+
+    Iterator() = default;
+
+    explicit Iterator(FlatMap::value_type *const *position) noexcept : m_position{position} {}
+
+    //! Allow conversion from iterator to const_iterator.
+    template <class TOtherPair, std::enable_if_t<std::is_convertible_v<TOtherPair *, TPair *>, int> = 1>
+    Iterator(Iterator<TOtherPair> const &other) noexcept : m_position{other.m_position} {}
+
+    reference operator*() const noexcept {
+      return **m_position;
+    }
+
+    pointer operator->() const noexcept {
+      return *m_position;
+    }
+
+    Iterator &operator++() noexcept {
+      ++m_position;
+      return *this;
+    }
+
+    Iterator operator++(int) noexcept {
+      return Iterator{m_position++};
+    }
+
+    Iterator &operator--() noexcept {
+      --m_position;
+      return *this;
+    }
+
+    Iterator operator--(int) noexcept {
+      return Iterator{m_position--};
+    }
+
+    friend bool operator==(Iterator const &left, Iterator const &right) noexcept {
+      return left.m_position == right.m_position;
+    }
+
+    friend bool operator!=(Iterator const &left, Iterator const &right) noexcept {
+      return left.m_position != right.m_position;
+    }
+
+   private:
+    friend struct FlatMap;
+    template <class TOtherPair>
+    friend struct Iterator;
+
+    FlatMap::value_type *const *m_position{nullptr};
+  };
+
+  using iterator = Iterator<value_type>;
+  using const_iterator = Iterator<value_type const>;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  FlatMap() = default;
+
+  FlatMap(FlatMap &&other) noexcept
+      : m_index{std::move(other.m_index)},
+        m_blocks{std::move(other.m_blocks)},
+        m_freeSlots{std::move(other.m_freeSlots)},
+        m_lastBlockSize{std::exchange(other.m_lastBlockSize, 0)},
+        m_lastBlockUsed{std::exchange(other.m_lastBlockUsed, 0)} {
+    other.m_index.clear();
+    other.m_blocks.clear();
+    other.m_freeSlots.clear();
+  }
+
+  FlatMap &operator=(FlatMap &&other) noexcept {
+    if (this != &other) {
+      FlatMap{std::move(other)}.swap(*this);
+    }
+
+    return *this;
+  }
+
+  FlatMap(FlatMap const &) = delete;
+  FlatMap &operator=(FlatMap const &) = delete;
+
+  ~FlatMap() noexcept {
+    DestroyPairs();
+  }
+
+  iterator begin() noexcept {
+    return iterator{m_index.data()};
+  }
+
+  const_iterator begin() const noexcept {
+    return const_iterator{m_index.data()};
+  }
+
+  const_iterator cbegin() const noexcept {
+    return begin();
+  }
+
+  iterator end() noexcept {
+    return iterator{m_index.data() + m_index.size()};
+  }
+
+  const_iterator end() const noexcept {
+    return const_iterator{m_index.data() + m_index.size()};
+  }
+
+  const_iterator cend() const noexcept {
+    return end();
+  }
+
+  reverse_iterator rbegin() noexcept {
+    return reverse_iterator{end()};
+  }
+
+  const_reverse_iterator rbegin() const noexcept {
+    return const_reverse_iterator{end()};
+  }
+
+  reverse_iterator rend() noexcept {
+    return reverse_iterator{begin()};
+  }
+
+  const_reverse_iterator rend() const noexcept {
+    return const_reverse_iterator{begin()};
+  }
+
+  bool empty() const noexcept {
+    return m_index.empty();
+  }
+
+  size_type size() const noexcept {
+    return m_index.size();
+  }
+
+  //! Allocate memory for count pairs to add them without further allocations.
+  void reserve(size_type count) noexcept {
+    m_index.reserve(count);
+    size_t available = m_freeSlots.size() + (m_lastBlockSize - m_lastBlockUsed);
+    if (count > m_index.size() + available) {
+      AddBlock(count - m_index.size() - available);
+    }
+  }
+
+  void clear() noexcept {
+    DestroyPairs();
+    m_index.clear();
+    m_blocks.clear();
+    m_freeSlots.clear();
+    m_lastBlockSize = 0;
+    m_lastBlockUsed = 0;
+  }
+
+  void swap(FlatMap &other) noexcept {
+    m_index.swap(other.m_index);
+    m_blocks.swap(other.m_blocks);
+    m_freeSlots.swap(other.m_freeSlots);
+    std::swap(m_lastBlockSize, other.m_lastBlockSize);
+    std::swap(m_lastBlockUsed, other.m_lastBlockUsed);
+  }
+
+  key_compare key_comp() const noexcept {
+    return key_compare{};
+  }
+
+  template <class TLookupKey>
+  iterator lower_bound(TLookupKey const &key) noexcept {
+    return MakeIterator(std::lower_bound(m_index.begin(), m_index.end(), key, KeyLess{}) - m_index.begin());
+  }
+
+  template <class TLookupKey>
+  const_iterator lower_bound(TLookupKey const &key) const noexcept {
+    return MakeIterator(std::lower_bound(m_index.begin(), m_index.end(), key, KeyLess{}) - m_index.begin());
+  }
+
+  template <class TLookupKey>
+  iterator upper_bound(TLookupKey const &key) noexcept {
+    return MakeIterator(std::upper_bound(m_index.begin(), m_index.end(), key, KeyLess{}) - m_index.begin());
+  }
+
+  template <class TLookupKey>
+  const_iterator upper_bound(TLookupKey const &key) const noexcept {
+    return MakeIterator(std::upper_bound(m_index.begin(), m_index.end(), key, KeyLess{}) - m_index.begin());
+  }
+
+  template <class TLookupKey>
+  iterator find(TLookupKey const &key) noexcept {
+    auto [position, isFound] = FindPosition(key);
+    return isFound ? MakeIterator(position) : end();
+  }
+
+  template <class TLookupKey>
+  const_iterator find(TLookupKey const &key) const noexcept {
+    auto [position, isFound] = FindPosition(key);
+    return isFound ? MakeIterator(position) : end();
+  }
+
+  template <class TLookupKey>
+  size_type count(TLookupKey const &key) const noexcept {
+    return FindPosition(key).second ? 1 : 0;
+  }
+
+  template <class TLookupKey>
+  bool contains(TLookupKey const &key) const noexcept {
+    return FindPosition(key).second;
+  }
+
+  //! Get a reference to the value for the key. Crash if the key is not found.
+  template <class TLookupKey>
+  TValue &at(TLookupKey const &key) noexcept {
+    auto it = find(key);
+    VerifyElseCrashSz(it != end(), "FlatMap key is not found");
+    return it->second;
+  }
+
+  //! Get a reference to the value for the key. Crash if the key is not found.
+  template <class TLookupKey>
+  TValue const &at(TLookupKey const &key) const noexcept {
+    auto it = find(key);
+    VerifyElseCrashSz(it != end(), "FlatMap key is not found");
+    return it->second;
+  }
+
+  //! Insert a new pair with the value constructed from args if the key is not found.
+  template <class TLookupKey, class... TArgs>
+  std::pair<iterator, bool> try_emplace(TLookupKey &&key, TArgs &&... args) noexcept {
+    auto [position, isFound] = FindPosition(key);
+    if (isFound) {
+      return {MakeIterator(position), false};
+    }
+
+    value_type *pair = new (AllocateSlot()) value_type(
+        std::piecewise_construct,
+        std::forward_as_tuple(std::forward<TLookupKey>(key)),
+        std::forward_as_tuple(std::forward<TArgs>(args)...));
+    return {LinkPair(position, pair), true};
+  }
+
+  //! Insert a new pair constructed from args if its key is not found.
+  template <class... TArgs>
+  std::pair<iterator, bool> emplace(TArgs &&... args) noexcept {
+    value_type *pair = new (AllocateSlot()) value_type(std::forward<TArgs>(args)...);
+    auto [position, isFound] = FindPosition(pair->first);
+    if (isFound) {
+      FreePair(pair);
+      return {MakeIterator(position), false};
+    }
+
+    return {LinkPair(position, pair), true};
+  }
+
+  //! Insert a new pair constructed from args if its key is not found.
+  //! The hint is used if the pair must be inserted right before it.
+  template <class... TArgs>
+  iterator emplace_hint(const_iterator hint, TArgs &&... args) noexcept {
+    value_type *pair = new (AllocateSlot()) value_type(std::forward<TArgs>(args)...);
+    size_t position = hint.m_position - m_index.data();
+    if ((position == 0 || key_compare{}(m_index[position - 1]->first, pair->first)) &&
+        (position == m_index.size() || key_compare{}(pair->first, m_index[position]->first))) {
+      return LinkPair(position, pair);
+    }
+
+    auto [foundPosition, isFound] = FindPosition(pair->first);
+    if (isFound) {
+      FreePair(pair);
+      return MakeIterator(foundPosition);
+    }
+
+    return LinkPair(foundPosition, pair);
+  }
+
+  std::pair<iterator, bool> insert(value_type &&pair) noexcept {
+    return emplace(std::move(pair));
+  }
+
+  //! Insert a new pair or assign the value if the key is found.
+  template <class TLookupKey, class TMappedValue>
+  std::pair<iterator, bool> insert_or_assign(TLookupKey &&key, TMappedValue &&value) noexcept {
+    auto [position, isFound] = FindPosition(key);
+    if (isFound) {
+      m_index[position]->second = std::forward<TMappedValue>(value);
+      return {MakeIterator(position), false};
+    }
+
+    return try_emplace(std::forward<TLookupKey>(key), std::forward<TMappedValue>(value));
+  }
+
+  iterator erase(const_iterator position) noexcept {
+    return erase(position, std::next(position));
+  }
+
+  iterator erase(const_iterator first, const_iterator last) noexcept {
+    size_t firstPosition = first.m_position - m_index.data();
+    size_t lastPosition = last.m_position - m_index.data();
+    for (size_t i = firstPosition; i < lastPosition; ++i) {
+      FreePair(m_index[i]);
+    }
+
+    m_index.erase(m_index.begin() + firstPosition, m_index.begin() + lastPosition);
+    return MakeIterator(firstPosition);
+  }
+
+  template <class TLookupKey, std::enable_if_t<!std::is_convertible_v<TLookupKey, const_iterator>, int> = 1>
+  size_type erase(TLookupKey const &key) noexcept {
+    auto it = find(key);
+    if (it != end()) {
+      erase(it);
+      return 1;
+    }
+
+    return 0;
+  }
+
+ private:
+  // Uninitialized memory for one pair.
+  struct Slot {
+    alignas(value_type) unsigned char Storage[sizeof(value_type)];
+  };
+
+  // The size of the first block if reserve is not called.
+  constexpr static size_t MinBlockSize{4};
+
+  struct KeyLess {
+    template <class TLookupKey>
+    bool operator()(value_type const *pair, TLookupKey const &key) const noexcept {
+      return key_compare{}(pair->first, key);
+    }
+
+    template <class TLookupKey>
+    bool operator()(TLookupKey const &key, value_type const *pair) const noexcept {
+      return key_compare{}(key, pair->first);
+    }
+  };
+
+  iterator MakeIterator(size_t position) noexcept {
+    return iterator{m_index.data() + position};
+  }
+
+  const_iterator MakeIterator(size_t position) const noexcept {
+    return const_iterator{m_index.data() + position};
+  }
+
+  // Returns the index position of the key, and whether the key is found there.
+  template <class TLookupKey>
+  std::pair<size_t, bool> FindPosition(TLookupKey const &key) const noexcept {
+    // The keys are often added in order when they are copied from another sorted container.
+    // Append them without the binary search.
+    if (m_index.empty() || key_compare{}(m_index.back()->first, key)) {
+      return {m_index.size(), false};
+    }
+
+    auto it = std::lower_bound(m_index.begin(), m_index.end(), key, KeyLess{});
+    return {static_cast<size_t>(it - m_index.begin()), !key_compare{}(key, (*it)->first)};
+  }
+
+  iterator LinkPair(size_t position, value_type *pair) noexcept {
+    m_index.insert(m_index.begin() + position, pair);
+    return MakeIterator(position);
+  }
+
+  void *AllocateSlot() noexcept {
+    if (!m_freeSlots.empty()) {
+      Slot *slot = m_freeSlots.back();
+      m_freeSlots.pop_back();
+      return slot;
+    }
+
+    if (m_lastBlockUsed == m_lastBlockSize) {
+      // Double the number of slots.
+      AddBlock((std::max)(MinBlockSize, m_index.size()));
+    }
+
+    return &m_blocks.back()[m_lastBlockUsed++];
+  }
+
+  void AddBlock(size_t size) noexcept {
+    // The unused slots of the current last block are reused after the free ones.
+    for (; m_lastBlockUsed < m_lastBlockSize; ++m_lastBlockUsed) {
+      m_freeSlots.push_back(&m_blocks.back()[m_lastBlockUsed]);
+    }
+
+    m_blocks.push_back(std::unique_ptr<Slot[]>{new Slot[size]});
+    m_lastBlockSize = size;
+    m_lastBlockUsed = 0;
+  }
+
+  void FreePair(value_type *pair) noexcept {
+    pair->~value_type();
+    m_freeSlots.push_back(reinterpret_cast<Slot *>(pair));
+  }
+
+  void DestroyPairs() noexcept {
+    for (value_type *pair : m_index) {
+      pair->~value_type();
+    }
+  }
+
+  std::vector<value_type *> m_index; // Sorted by key.
+  std::vector<std::unique_ptr<Slot[]>> m_blocks;
+  std::vector<Slot *> m_freeSlots;
+  size_t m_lastBlockSize{0};
+  size_t m_lastBlockUsed{0};
+};
+
+} // namespace winrt::Microsoft::ReactNative
+
+#endif // MICROSOFT_REACTNATIVE_FLATMAP
@@ -0,0 +1,239 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+// IMPORTANT: Before updating this file
+// please read react-native-windows repo:
+// vnext/Microsoft.ReactNative.Cxx/README.md
+
+#pragma once
+#ifndef MICROSOFT_REACTNATIVE_JSI_JSIMETHODARGS
+#define MICROSOFT_REACTNATIVE_JSI_JSIMETHODARGS
+
+#include <cmath>
+#include <optional>
+#include <string>
+#include <vector>
+#include <unknwn.h>
+#include "../JSValueReader.h"
+#include "jsi/jsi.h"
+
+namespace winrt::Microsoft::ReactNative {
+
+// Returns an address that is unique for each binary that includes this header.
+// Inline functions are not shared between binaries, so each binary has its own static variable.
+inline const void *GetJsiMethodArgsBinaryId() noexcept {
+  static const char binaryId{};
+  return &binaryId;
+}
+
+// The JSI values of a TurboModule method call.
+// The IJSValueReader and IJSValueWriter passed by TurboModules to the method delegates expose them through
+// the internal IJsiMethodArgsProvider interface. The method invokers compiled into the same binary as the JSI runtime
+// use them to read the arguments and write the results without the ABI-safe IJSValueReader and IJSValueWriter calls.
+// The method invokers use it only in the binaries that define RNW_JSI_METHOD_ARGS. See ModuleMethodInvoker.h.
+struct JsiMethodArgs {
+  JsiMethodArgs(facebook::jsi::Runtime &runtime, const facebook::jsi::Value *args = nullptr, size_t count = 0) noexcept
+      : Runtime{runtime}, Args{args}, Count{count} {}
+
+  const void *const BinaryId{GetJsiMethodArgsBinaryId()};
+  facebook::jsi::Runtime &Runtime;
+
+  // The method arguments. Only the IJSValueReader has them.
+  const facebook::jsi::Value *const Args;
+  const size_t Count;
+
+  // The result of a synchronous method.
+  std::optional<facebook::jsi::Value> Result;
+
+  // The arguments of the result callback of an asynchronous method.
+  std::optional<std::vector<facebook::jsi::Value>> ResultArgs;
+};
+
+// Implemented by the JsiReader and JsiWriter to give access to their JsiMethodArgs.
+// It is not a part of the Microsoft.ReactNative ABI and it must not be implemented outside of Microsoft.ReactNative.
+struct __declspec(uuid("8f6d5c1e-3b0a-4e7f-9a2d-6c4b1e0f7a53")) __declspec(novtable) IJsiMethodArgsProvider
+    : ::IUnknown {
+  // Returns nullptr if the object has no JsiMethodArgs.
+  virtual JsiMethodArgs *__stdcall GetJsiMethodArgs() noexcept = 0;
+};
+
+// Returns the JsiMethodArgs of the IJSValueReader or IJSValueWriter created by a JSI runtime in the same binary.
+// Returns nullptr otherwise.
+inline JsiMethodArgs *TryGetJsiMethodArgs(Windows::Foundation::IInspectable const &readerOrWriter) noexcept {
+  auto provider = readerOrWriter ? readerOrWriter.try_as<IJsiMethodArgsProvider>() : nullptr;
+  JsiMethodArgs *methodArgs = provider ? provider->GetJsiMethodArgs() : nullptr;
+  return methodArgs && methodArgs->BinaryId == GetJsiMethodArgsBinaryId() ? methodArgs : nullptr;
+}
+
+//==============================================================================
+// Types that can be read from and written to JSI values directly
+//==============================================================================
+
+template <class T>
+struct IsJsiDirectType : std::false_type {};
+template <>
+struct IsJsiDirectType<bool> : std::true_type {};
+template <>
+struct IsJsiDirectType<int8_t> : std::true_type {};
+template <>
+struct IsJsiDirectType<int16_t> : std::true_type {};
+template <>
+struct IsJsiDirectType<int32_t> : std::true_type {};
+template <>
+struct IsJsiDirectType<int64_t> : std::true_type {};
+template <>
+struct IsJsiDirectType<uint8_t> : std::true_type {};
+template <>
+struct IsJsiDirectType<uint16_t> : std::true_type {};
+template <>
+struct IsJsiDirectType<uint32_t> : std::true_type {};
+template <>
+struct IsJsiDirectType<uint64_t> : std::true_type {};
+template <>
+struct IsJsiDirectType<float> : std::true_type {};
+template <>
+struct IsJsiDirectType<double> : std::true_type {};
+template <>
+struct IsJsiDirectType<std::string> : std::true_type {};
+template <>
+struct IsJsiDirectType<std::wstring> : std::true_type {};
+template <>
+struct IsJsiDirectType<winrt::hstring> : std::true_type {};
+template <class T>
+struct IsJsiDirectType<std::optional<T>> : IsJsiDirectType<T> {};
+
+template <class T>
+constexpr bool IsJsiDirectTypeV = IsJsiDirectType<T>::value;
+
+// Converts a JSI value to JSValue the same way as JsiReader sees it when a primitive type is read.
+// The objects and arrays cannot be read as primitive types, and they are converted to Null.
+inline JSValue JsiToPrimitiveJSValue(facebook::jsi::Runtime &runtime, facebook::jsi::Value const &jsiValue) noexcept {
+  if (jsiValue.isString()) {
+    return JSValue{jsiValue.getString(runtime).utf8(runtime)};
+  } else if (jsiValue.isBool()) {
+    return JSValue{jsiValue.getBool()};
+  } else if (jsiValue.isNumber()) {
+    double number = jsiValue.getNumber();
+    return std::floor(number) == number ? JSValue{static_cast<int64_t>(number)} : JSValue{number};
+  } else {
+    return JSValue{nullptr};
+  }
+}
+
+// Reads the value with the same result as ReadValue(IJSValueReader const&, T&) gives for the JsiReader.
+// The values of the expected JS type are read directly, and the others are converted as the JSValue does it.
+template <class T, std::enable_if_t<IsJsiDirectTypeV<T>, int> = 1>
+void ReadJsiValue(facebook::jsi::Runtime &runtime, facebook::jsi::Value const &jsiValue, /*out*/ T &value) noexcept {
+  if constexpr (std::is_same_v<T, bool>) {
+    if (jsiValue.isBool()) {
+      value = jsiValue.getBool();
+      return;
+    }
+  } else if constexpr (std::is_integral_v<T>) {
+    if (jsiValue.isNumber()) {
+      value = static_cast<T>(static_cast<int64_t>(jsiValue.getNumber()));
+      return;
+    }
+  } else if constexpr (std::is_floating_point_v<T>) {
+    if (jsiValue.isNumber()) {
+      value = static_cast<T>(jsiValue.getNumber());
+      return;
+    }
+  } else if constexpr (std::is_same_v<T, std::string>) {
+    if (jsiValue.isString()) {
+      value = jsiValue.getString(runtime).utf8(runtime);
+      return;
+    }
+  } else if constexpr (std::is_same_v<T, std::wstring> || std::is_same_v<T, winrt::hstring>) {
+    if (jsiValue.isString()) {
+      value = T{winrt::to_hstring(jsiValue.getString(runtime).utf8(runtime))};
+      return;
+    }
+  } else {
+    // std::optional
+    if (jsiValue.isNull() || jsiValue.isUndefined()) {
+      value = std::nullopt;
+    } else {
+      ReadJsiValue(runtime, jsiValue, value.emplace());
+    }
+    return;
+  }
+
+  ReadValue(JsiToPrimitiveJSValue(runtime, jsiValue), /*out*/ value);
+}
+
+// Creates the JSI value that JsiWriter creates for WriteValue(IJSValueWriter const&, T const&).
+template <class T, std::enable_if_t<IsJsiDirectTypeV<T>, int> = 1>
+facebook::jsi::Value MakeJsiValue(facebook::jsi::Runtime &runtime, T const &value) noexcept {
+  if constexpr (std::is_same_v<T, bool>) {
+    return facebook::jsi::Value{value};
+  } else if constexpr (std::is_integral_v<T>) {
+    return facebook::jsi::Value{static_cast<double>(static_cast<int64_t>(value))};
+  } else if constexpr (std::is_floating_point_v<T>) {
+    return facebook::jsi::Value{static_cast<double>(value)};
+  } else if constexpr (std::is_same_v<T, std::string>) {
+    return facebook::jsi::String::createFromUtf8(runtime, value);
+  } else if constexpr (std::is_same_v<T, std::wstring> || std::is_same_v<T, winrt::hstring>) {
+    return facebook::jsi::String::createFromUtf8(runtime, winrt::to_string(value));
+  } else {
+    // std::optional
+    return value ? MakeJsiValue(runtime, *value) : facebook::jsi::Value::null();
+  }
+}
+
+//==============================================================================
+// Method invoker helpers
+//==============================================================================
+
+// Reads the method arguments directly from the JSI values if all argument types support it
+// and the reader is created by a JSI runtime in the same binary.
+// Returns false if the arguments must be read by ReadArgs.
+template <class TArgTuple, size_t... I>
+bool TryReadJsiArgs(IJSValueReader const &reader, /*out*/ TArgTuple &args, std::index_sequence<I...>) noexcept {
+  if constexpr ((IsJsiDirectTypeV<std::tuple_element_t<I, TArgTuple>> && ...)) {
+    JsiMethodArgs *methodArgs = TryGetJsiMethodArgs(reader);
+    if (methodArgs) {
+      // The missing arguments keep their default values as they do in ReadArgs.
+      ((I < methodArgs->Count ? ReadJsiValue(methodArgs->Runtime, methodArgs->Args[I], std::get<I>(args)) : void()),
+       ...);
+      return true;
+    }
+  }
+
+  return false;
+}
+
+// Writes the synchronous method result directly as a JSI value if its type supports it
+// and the writer is created by a JSI runtime in the same binary.
+// Returns false if the result must be written by WriteValue.
+template <class T>
+bool TryWriteJsiResult(IJSValueWriter const &writer, T const &value) noexcept {
+  if constexpr (IsJsiDirectTypeV<T>) {
+    if (JsiMethodArgs *methodArgs = TryGetJsiMethodArgs(writer)) {
+      methodArgs->Result = MakeJsiValue(methodArgs->Runtime, value);
+      return true;
+    }
+  }
+
+  return false;
+}
+
+// Writes the result callback arguments directly as JSI values if their types support it
+// and the writer is created by a JSI runtime in the same binary.
+// Returns false if the arguments must be written by WriteArgs.
+template <class... TArgs>
+bool TryWriteJsiResultArgs(IJSValueWriter const &writer, TArgs const &... args) noexcept {
+  if constexpr ((IsJsiDirectTypeV<TArgs> && ...)) {
+    if (JsiMethodArgs *methodArgs = TryGetJsiMethodArgs(writer)) {
+      auto &resultArgs = methodArgs->ResultArgs.emplace();
+      resultArgs.reserve(sizeof...(TArgs));
+      (resultArgs.push_back(MakeJsiValue(methodArgs->Runtime, args)), ...);
+      return true;
+    }
+  }
+
+  return false;
+}
+
+} // namespace winrt::Microsoft::ReactNative
+
+#endif // MICROSOFT_REACTNATIVE_JSI_JSIMETHODARGS
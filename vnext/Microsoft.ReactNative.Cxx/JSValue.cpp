@@ -251,10 +251,18 @@ JSValueObject::JSValueObject(std::initializer_list<JSValueObjectKeyValue> initOb
   }
 }
 
-JSValueObject::JSValueObject(std::map<std::string, JSValue, std::less<>> &&other) noexcept : map{std::move(other)} {}
+JSValueObject::JSValueObject(std::map<std::string, JSValue, std::less<>> &&other) noexcept {
+  // The std::map keys are sorted and they are appended to the end.
+  reserve(other.size());
+  while (!other.empty()) {
+    auto node = other.extract(other.begin());
+    try_emplace(std::move(node.key()), std::move(node.mapped()));
+  }
+}
 
 JSValueObject JSValueObject::Copy() const noexcept {
   JSValueObject object;
+  object.reserve(size());
   for (auto const &property : *this) {
     object.try_emplace(property.first, property.second.Copy());
   }
@@ -286,7 +294,7 @@ bool JSValueObject::Equals(JSValueObject const &other) const noexcept {
     return false;
   }
 
-  // std::map keeps key-values in an ordered sequence.
+  // JSValueObjectStorage keeps key-values in an ordered sequence.
   // Make sure that pairs are matching at the same position.
   auto otherIt = other.begin();
   for (auto const &property : *this) {
@@ -304,7 +312,7 @@ bool JSValueObject::JSEquals(JSValueObject const &other) const noexcept {
     return false;
   }
 
-  // std::map keeps key-values in an ordered sequence.
+  // JSValueObjectStorage keeps key-values in an ordered sequence.
   // Make sure that pairs are matching at the same position.
   auto otherIt = other.begin();
   for (auto const &property : *this) {
@@ -9,6 +9,7 @@
 #define MICROSOFT_REACTNATIVE_JSVALUE
 
 #include "Crash.h"
+#include "FlatMap.h"
 #include "winrt/Microsoft.ReactNative.h"
 
 namespace winrt::Microsoft::ReactNative {
@@ -18,10 +19,14 @@ namespace winrt::Microsoft::ReactNative {
 //==============================================================================
 
 struct JSValue;
+struct JSValueObject;
+struct JSValueArray;
 struct JSValueObjectKeyValue;
 struct JSValueArrayItem;
 IJSValueReader MakeJSValueTreeReader(JSValue const &root) noexcept;
 IJSValueReader MakeJSValueTreeReader(JSValue &&root) noexcept;
+IJSValueReader MakeBorrowedJSValueTreeReader(JSValueObject const &root) noexcept;
+IJSValueReader MakeBorrowedJSValueTreeReader(JSValueArray const &root) noexcept;
 IJSValueWriter MakeJSValueTreeWriter() noexcept;
 JSValue TakeJSValue(IJSValueWriter const &writer) noexcept;
 
@@ -29,11 +34,18 @@ JSValue TakeJSValue(IJSValueWriter const &writer) noexcept;
 // JSValueObject declaration.
 //==============================================================================
 
-//! JSValueObject is based on std::map and has a custom constructor with std::intializer_list.
+//! The JSValueObject storage type.
+//! FlatMap allocates the properties of an object in a few blocks instead of one node per property:
+//! it needs fewer allocations and has a better locality for the small objects such as UI props and event payloads.
+//! As with std::map, adding or removing properties does not invalidate the references to other property values,
+//! but it invalidates iterators.
+using JSValueObjectStorage = FlatMap<std::string, JSValue, std::less<>>;
+
+//! JSValueObject is based on JSValueObjectStorage and has a custom constructor with std::intializer_list.
 //! It is possible to write: JSValueObject{{"X", 4}, {"Y", 5}} and assign it to JSValue.
 //! It uses the std::less<> comparison algorithm that allows an efficient
 //! key lookup using std::string_view that does not allocate memory for the std::string key.
-struct JSValueObject : std::map<std::string, JSValue, std::less<>> {
+struct JSValueObject : JSValueObjectStorage {
   //! Default constructor.
   JSValueObject() = default;
 
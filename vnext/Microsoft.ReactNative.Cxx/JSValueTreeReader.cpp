@@ -13,28 +13,54 @@ namespace winrt::Microsoft::ReactNative {
 // JSValueTreeReader implementation
 //===========================================================================
 
-JSValueTreeReader::StackEntry::StackEntry(const JSValue &value, const JSValueObject::const_iterator &property) noexcept
-    : Value{value}, Property{property} {}
+JSValueTreeReader::StackEntry::StackEntry(
+    const JSValue *value,
+    const JSValueObject &object,
+    const JSValueObject::const_iterator &property) noexcept
+    : Value{value}, Object{&object}, Property{property} {}
 
-JSValueTreeReader::StackEntry::StackEntry(const JSValue &value, const JSValueArray::const_iterator &item) noexcept
-    : Value{value}, Item{item} {}
+JSValueTreeReader::StackEntry::StackEntry(
+    const JSValue *value,
+    const JSValueArray &array,
+    const JSValueArray::const_iterator &item) noexcept
+    : Value{value}, Array{&array}, Item{item} {}
 
-JSValueTreeReader::JSValueTreeReader(const JSValue &value) noexcept : m_root{value}, m_current{&value} {}
+JSValueTreeReader::JSValueTreeReader(const JSValue &value) noexcept : m_current{&value} {}
 
 JSValueTreeReader::JSValueTreeReader(JSValue &&value) noexcept
-    : m_ownedValue{std::move(value)}, m_root{m_ownedValue}, m_current{&m_ownedValue} {}
+    : m_ownedValue{std::move(value)}, m_current{&m_ownedValue} {}
+
+JSValueTreeReader::JSValueTreeReader(const JSValueObject &value) noexcept : m_rootObject{&value}, m_current{nullptr} {}
+
+JSValueTreeReader::JSValueTreeReader(const JSValueArray &value) noexcept : m_rootArray{&value}, m_current{nullptr} {}
+
+void JSValueTreeReader::Invalidate() noexcept {
+  m_rootObject = nullptr;
+  m_rootArray = nullptr;
+  m_current = nullptr;
+  m_isInContainer = false;
+  m_stack.clear();
+}
 
 JSValueType JSValueTreeReader::ValueType() noexcept {
-  return m_current->Type();
+  if (m_current) {
+    return m_current->Type();
+  }
+
+  if (m_rootObject) {
+    return JSValueType::Object;
+  }
+
+  return m_rootArray ? JSValueType::Array : JSValueType::Null;
 }
 
 bool JSValueTreeReader::GetNextObjectProperty(hstring &propertyName) noexcept {
   if (!m_isInContainer) {
-    if (auto obj = m_current->TryGetObject()) {
+    if (auto obj = TryGetCurrentObject()) {
       const auto &properties = *obj;
       const auto &property = properties.begin();
       if (property != properties.end()) {
-        m_stack.emplace_back(*m_current, property);
+        m_stack.emplace_back(m_current, properties, property);
         SetCurrentValue(property->second);
         propertyName = to_hstring(property->first);
         return true;
@@ -44,14 +70,14 @@ bool JSValueTreeReader::GetNextObjectProperty(hstring &propertyName) noexcept {
     }
   } else if (!m_stack.empty()) {
     auto &entry = m_stack.back();
-    if (auto obj = entry.Value.TryGetObject()) {
+    if (auto obj = entry.Object) {
       auto &property = entry.Property;
       if (++property != obj->end()) {
         SetCurrentValue(property->second);
         propertyName = to_hstring(property->first);
         return true;
       } else {
-        m_current = &entry.Value;
+        m_current = entry.Value;
         m_stack.pop_back();
         m_isInContainer = !m_stack.empty();
       }
@@ -64,10 +90,10 @@ bool JSValueTreeReader::GetNextObjectProperty(hstring &propertyName) noexcept {
 
 bool JSValueTreeReader::GetNextArrayItem() noexcept {
   if (!m_isInContainer) {
-    if (auto arr = m_current->TryGetArray()) {
+    if (auto arr = TryGetCurrentArray()) {
       const auto &item = arr->begin();
       if (item != arr->end()) {
-        m_stack.emplace_back(*m_current, item);
+        m_stack.emplace_back(m_current, *arr, item);
         SetCurrentValue(*item);
         return true;
       } else {
@@ -76,12 +102,12 @@ bool JSValueTreeReader::GetNextArrayItem() noexcept {
     }
   } else if (!m_stack.empty()) {
     auto &entry = m_stack.back();
-    if (auto arr = entry.Value.TryGetArray()) {
+    if (auto arr = entry.Array) {
       if (++entry.Item != arr->end()) {
         SetCurrentValue(*entry.Item);
         return true;
       } else {
-        m_current = &entry.Value;
+        m_current = entry.Value;
         m_stack.pop_back();
         m_isInContainer = !m_stack.empty();
       }
@@ -104,23 +130,31 @@ void JSValueTreeReader::SetCurrentValue(const JSValue &value) noexcept {
   }
 }
 
+const JSValueObject *JSValueTreeReader::TryGetCurrentObject() const noexcept {
+  return m_current ? m_current->TryGetObject() : m_rootObject;
+}
+
+const JSValueArray *JSValueTreeReader::TryGetCurrentArray() const noexcept {
+  return m_current ? m_current->TryGetArray() : m_rootArray;
+}
+
 hstring JSValueTreeReader::GetString() noexcept {
-  auto s = m_current->TryGetString();
+  auto s = m_current ? m_current->TryGetString() : nullptr;
   return to_hstring(s ? *s : "");
 }
 
 bool JSValueTreeReader::GetBoolean() noexcept {
-  auto b = m_current->TryGetBoolean();
+  auto b = m_current ? m_current->TryGetBoolean() : nullptr;
   return b ? *b : false;
 }
 
 int64_t JSValueTreeReader::GetInt64() noexcept {
-  auto i = m_current->TryGetInt64();
+  auto i = m_current ? m_current->TryGetInt64() : nullptr;
   return i ? *i : 0;
 }
 
 double JSValueTreeReader::GetDouble() noexcept {
-  auto d = m_current->TryGetDouble();
+  auto d = m_current ? m_current->TryGetDouble() : nullptr;
   return d ? *d : 0;
 }
 
@@ -132,4 +166,12 @@ IJSValueReader MakeJSValueTreeReader(JSValue &&root) noexcept {
   return make<JSValueTreeReader>(std::move(root));
 }
 
+IJSValueReader MakeBorrowedJSValueTreeReader(JSValueObject const &root) noexcept {
+  return make<JSValueTreeReader>(root);
+}
+
+IJSValueReader MakeBorrowedJSValueTreeReader(JSValueArray const &root) noexcept {
+  return make<JSValueTreeReader>(root);
+}
+
 } // namespace winrt::Microsoft::ReactNative
@@ -16,6 +16,15 @@ struct JSValueTreeReader : implements<JSValueTreeReader, IJSValueReader> {
   JSValueTreeReader(const JSValue &value) noexcept;
   JSValueTreeReader(JSValue &&value) noexcept;
 
+  // Borrow the object or array without wrapping it into a JSValue.
+  // The reader must not be used after the borrowed value is changed or destroyed.
+  JSValueTreeReader(const JSValueObject &value) noexcept;
+  JSValueTreeReader(const JSValueArray &value) noexcept;
+
+  // Drops the references to the read value: the reader then reads a Null value.
+  // Call it before the borrowed value is changed or destroyed if the reader could still be used.
+  void Invalidate() noexcept;
+
  public: // IJSValueReader
   JSValueType ValueType() noexcept;
   bool GetNextObjectProperty(hstring &propertyName) noexcept;
@@ -27,21 +36,29 @@ struct JSValueTreeReader : implements<JSValueTreeReader, IJSValueReader> {
 
  private:
   struct StackEntry {
-    StackEntry(const JSValue &value, const JSValueObject::const_iterator &property) noexcept;
-    StackEntry(const JSValue &value, const JSValueArray::const_iterator &item) noexcept;
+    StackEntry(
+        const JSValue *value,
+        const JSValueObject &object,
+        const JSValueObject::const_iterator &property) noexcept;
+    StackEntry(const JSValue *value, const JSValueArray &array, const JSValueArray::const_iterator &item) noexcept;
 
-    const JSValue &Value;
+    const JSValue *Value; // nullptr for the borrowed root object or array.
+    const JSValueObject *Object{nullptr};
+    const JSValueArray *Array{nullptr};
     JSValueArray::const_iterator Item;
     JSValueObject::const_iterator Property;
   };
 
  private:
   void SetCurrentValue(const JSValue &value) noexcept;
+  const JSValueObject *TryGetCurrentObject() const noexcept;
+  const JSValueArray *TryGetCurrentArray() const noexcept;
 
  private:
   const JSValue m_ownedValue;
-  const JSValue &m_root;
-  const JSValue *m_current;
+  const JSValueObject *m_rootObject{nullptr};
+  const JSValueArray *m_rootArray{nullptr};
+  const JSValue *m_current; // nullptr while the reader is at the borrowed root object or array.
   bool m_isInContainer{false};
   std::vector<StackEntry> m_stack;
 };
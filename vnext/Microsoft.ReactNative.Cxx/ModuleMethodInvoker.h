@@ -0,0 +1,76 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+// IMPORTANT: Before updating this file
+// please read react-native-windows repo:
+// vnext/Microsoft.ReactNative.Cxx/README.md
+
+#pragma once
+#ifndef MICROSOFT_REACTNATIVE_MODULEMETHODINVOKER
+#define MICROSOFT_REACTNATIVE_MODULEMETHODINVOKER
+
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "JSValueReader.h"
+#include "JSValueWriter.h"
+
+// The binaries that host the JSI runtime define RNW_JSI_METHOD_ARGS to let the method invokers read the arguments
+// and write the results directly as JSI values. Other binaries, including the app and library modules, only use
+// the ABI-safe IJSValueReader and IJSValueWriter.
+#ifdef RNW_JSI_METHOD_ARGS
+#include "JSI/JsiMethodArgs.h"
+#endif
+
+namespace winrt::Microsoft::ReactNative {
+
+// Reads the input arguments of a module method.
+template <class TArgTuple, size_t... I>
+void ReadMethodArgs(
+    IJSValueReader const &reader,
+    /*out*/ TArgTuple &args,
+    [[maybe_unused]] std::index_sequence<I...> indices) noexcept {
+#ifdef RNW_JSI_METHOD_ARGS
+  if (TryReadJsiArgs(reader, args, indices)) {
+    return;
+  }
+#endif
+
+  ReadArgs(reader, std::get<I>(args)...);
+}
+
+// Writes the result of a synchronous module method.
+template <class T>
+void WriteMethodResult(IJSValueWriter const &writer, T const &result) noexcept {
+#ifdef RNW_JSI_METHOD_ARGS
+  if (TryWriteJsiResult(writer, result)) {
+    return;
+  }
+#endif
+
+  WriteValue(writer, result);
+}
+
+// Writes the result of an asynchronous module method as the result callback arguments.
+template <class T>
+void WriteMethodResultArgs(IJSValueWriter const &writer, T const &result) noexcept {
+#ifdef RNW_JSI_METHOD_ARGS
+  if (TryWriteJsiResultArgs(writer, result)) {
+    return;
+  }
+#endif
+
+  WriteArgs(writer, result);
+}
+
+// Invokes a synchronous module method: reads its arguments, calls it, and writes its result.
+template <class TResult, class... TArgs, class TMethod>
+void InvokeSyncMethod(IJSValueReader const &argReader, IJSValueWriter const &argWriter, TMethod &&method) noexcept {
+  std::tuple<std::remove_reference_t<TArgs>...> typedArgs{};
+  ReadMethodArgs(argReader, typedArgs, std::index_sequence_for<TArgs...>{});
+  TResult result = std::apply(std::forward<TMethod>(method), std::move(typedArgs));
+  WriteMethodResult(argWriter, result);
+}
+
+} // namespace winrt::Microsoft::ReactNative
+
+#endif // MICROSOFT_REACTNATIVE_MODULEMETHODINVOKER
@@ -8,6 +8,7 @@
 #include <winrt/Windows.Foundation.h>
 #include "JSValueReader.h"
 #include "JSValueWriter.h"
+#include "ModuleMethodInvoker.h"
 #include "ModuleRegistration.h"
 #include "ReactContext.h"
 #include "ReactNonAbiValue.h"
@@ -506,10 +507,10 @@ struct ModuleMethodInfo<TResult (TModule::*)(TArgs...) noexcept> : ModuleMethodI
                [[maybe_unused]] MethodResultCallback const &resolve,
                [[maybe_unused]] MethodResultCallback const &reject) mutable noexcept {
       typename Super::InputArgTuple inputArgs{};
-      ReadArgs(argReader, std::get<ArgIndex>(inputArgs)...);
+      ReadMethodArgs(argReader, inputArgs, std::index_sequence<ArgIndex...>{});
       if constexpr (!Super::IsVoidResult) {
         TResult result = (module->*method)(std::get<ArgIndex>(std::move(inputArgs))...);
-        WriteArgs(argWriter, result);
+        WriteMethodResultArgs(argWriter, result);
         resolve(argWriter);
       } else if constexpr (Super::PromiseCount == 1) {
         auto promises = std::tuple{
@@ -563,10 +564,10 @@ struct ModuleMethodInfo<TResult (*)(TArgs...) noexcept> : ModuleMethodInfoBase<T
                [[maybe_unused]] MethodResultCallback const &resolve,
                [[maybe_unused]] MethodResultCallback const &reject) mutable noexcept {
       typename Super::InputArgTuple inputArgs{};
-      ReadArgs(argReader, std::get<ArgIndex>(inputArgs)...);
+      ReadMethodArgs(argReader, inputArgs, std::index_sequence<ArgIndex...>{});
       if constexpr (!Super::IsVoidResult) {
         TResult result = (*method)(std::get<ArgIndex>(std::move(inputArgs))...);
-        WriteArgs(argWriter, result);
+        WriteMethodResultArgs(argWriter, result);
         resolve(argWriter);
       } else if constexpr (Super::PromiseCount == 1) {
         auto promises = std::tuple{
@@ -620,19 +621,13 @@ struct ModuleSyncMethodInfo<TResult (TModule::*)(TArgs...) noexcept>
   using ModuleType = TModule;
   using MethodType = TResult (TModule::*)(TArgs...) noexcept;
 
-  template <size_t... I>
-  static SyncMethodDelegate GetFunc(ModuleType *module, MethodType method, std::index_sequence<I...>) noexcept {
-    return [module, method](IJSValueReader const &argReader, IJSValueWriter const &argWriter) mutable noexcept {
-      using ArgTuple = std::tuple<std::remove_reference_t<TArgs>...>;
-      ArgTuple typedArgs{};
-      ReadArgs(argReader, std::get<I>(typedArgs)...);
-      TResult result = (module->*method)(std::get<I>(std::move(typedArgs))...);
-      WriteValue(argWriter, result);
-    };
-  }
-
   static SyncMethodDelegate GetMethodDelegate(void *module, MethodType method) noexcept {
-    return GetFunc(static_cast<ModuleType *>(module), method, std::make_index_sequence<sizeof...(TArgs)>{});
+    return [module = static_cast<ModuleType *>(module), method](
+               IJSValueReader const &argReader, IJSValueWriter const &argWriter) mutable noexcept {
+      InvokeSyncMethod<TResult, TArgs...>(argReader, argWriter, [module, method](auto &&... args) noexcept {
+        return (module->*method)(std::forward<decltype(args)>(args)...);
+      });
+    };
   }
 
   template <class TMethodSpec>
@@ -648,21 +643,12 @@ struct ModuleSyncMethodInfo<TResult (*)(TArgs...) noexcept> : ModuleSyncMethodIn
   using Super = ModuleSyncMethodInfoBase<TResult(TArgs...) noexcept>;
   using MethodType = TResult (*)(TArgs...) noexcept;
 
-  template <size_t... I>
-  static SyncMethodDelegate GetFunc(MethodType method, std::index_sequence<I...>) noexcept {
+  static SyncMethodDelegate GetMethodDelegate(void * /*module*/, MethodType method) noexcept {
     return [method](IJSValueReader const &argReader, IJSValueWriter const &argWriter) mutable noexcept {
-      using ArgTuple = std::tuple<std::remove_reference_t<TArgs>...>;
-      ArgTuple typedArgs{};
-      ReadArgs(argReader, std::get<I>(typedArgs)...);
-      TResult result = (*method)(std::get<I>(std::move(typedArgs))...);
-      WriteValue(argWriter, result);
+      InvokeSyncMethod<TResult, TArgs...>(argReader, argWriter, method);
     };
   }
 
-  static SyncMethodDelegate GetMethodDelegate(void * /*module*/, MethodType method) noexcept {
-    return GetFunc(method, std::make_index_sequence<sizeof...(TArgs)>{});
-  }
-
   template <class TMethodSpec>
   static constexpr bool Match() noexcept {
     // Do not move this method to the ModuleSyncMethodInfoBase for better error reporting.
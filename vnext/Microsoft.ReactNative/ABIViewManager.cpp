@@ -8,6 +8,7 @@
 
 #include "IReactContext.h"
 
+#include <JSValueTreeReader.h>
 #include <JSValueWriter.h>
 #include <Utils/ValueUtils.h>
 #include <Views/ShadowNodeBase.h>
@@ -15,6 +16,29 @@
 
 namespace winrt::Microsoft::ReactNative {
 
+// Reads the props or command args without copying them during one view manager call.
+// The reader is invalidated when the call returns or throws: a view manager that keeps the reader
+// then reads a Null value instead of the destroyed props.
+class BorrowedJSValueTreeReader {
+ public:
+  template <class TValue>
+  BorrowedJSValueTreeReader(const TValue &value) noexcept : m_reader{make_self<JSValueTreeReader>(value)} {}
+
+  ~BorrowedJSValueTreeReader() noexcept {
+    m_reader->Invalidate();
+  }
+
+  BorrowedJSValueTreeReader(const BorrowedJSValueTreeReader &) = delete;
+  BorrowedJSValueTreeReader &operator=(const BorrowedJSValueTreeReader &) = delete;
+
+  IJSValueReader Get() const noexcept {
+    return *m_reader;
+  }
+
+ private:
+  com_ptr<JSValueTreeReader> m_reader;
+};
+
 class ABIShadowNode : public ::Microsoft::ReactNative::ShadowNodeBase {
   using Super = ShadowNodeBase;
 
@@ -57,8 +81,8 @@ xaml::DependencyObject ABIViewManager::CreateViewCore(
     int64_t,
     const winrt::Microsoft::ReactNative::JSValueObject &props) {
   if (auto viewCreateProps = m_viewManager.try_as<IViewManagerCreateWithProperties>()) {
-    auto view = viewCreateProps.CreateViewWithProperties(
-        MakeJSValueTreeReader(winrt::Microsoft::ReactNative::JSValue(props.Copy())));
+    BorrowedJSValueTreeReader propsReader{props};
+    auto view = viewCreateProps.CreateViewWithProperties(propsReader.Get());
     return view.as<xaml::DependencyObject>();
   }
   return m_viewManager.CreateView();
@@ -115,8 +139,9 @@ void ABIViewManager::UpdateProperties(
     auto view = nodeToUpdate->GetView().as<xaml::FrameworkElement>();
 
     if (props.size() > 0) {
-      m_viewManagerWithNativeProperties.UpdateProperties(
-          view, MakeJSValueTreeReader(winrt::Microsoft::ReactNative::JSValue(props.Copy())));
+      // The reader borrows the props to avoid copying them on every update.
+      BorrowedJSValueTreeReader propsReader{props};
+      m_viewManagerWithNativeProperties.UpdateProperties(view, propsReader.Get());
     }
   }
 
@@ -138,13 +163,11 @@ void ABIViewManager::GetCommands(const winrt::Microsoft::ReactNative::IJSValueWr
 void ABIViewManager::DispatchCommand(
     const xaml::DependencyObject &viewToUpdate,
     const std::string &commandId,
-    winrt::Microsoft::ReactNative::JSValueArray &&commandArgs) {
+    const winrt::Microsoft::ReactNative::JSValueArray &commandArgs) {
   if (m_viewManagerWithCommands) {
     auto view = viewToUpdate.as<xaml::FrameworkElement>();
-    m_viewManagerWithCommands.DispatchCommand(
-        view,
-        to_hstring(commandId),
-        MakeJSValueTreeReader(winrt::Microsoft::ReactNative::JSValue(std::move(commandArgs))));
+    BorrowedJSValueTreeReader commandArgsReader{commandArgs};
+    m_viewManagerWithCommands.DispatchCommand(view, to_hstring(commandId), commandArgsReader.Get());
   }
 }
 
@@ -42,7 +42,7 @@ class ABIViewManager : public ::Microsoft::ReactNative::FrameworkElementViewMana
   void DispatchCommand(
       const xaml::DependencyObject &viewToUpdate,
       const std::string &commandId,
-      winrt::Microsoft::ReactNative::JSValueArray &&commandArgs) override;
+      const winrt::Microsoft::ReactNative::JSValueArray &commandArgs) override;
 
   void GetExportedCustomBubblingEventTypeConstants(
       const winrt::Microsoft::ReactNative::IJSValueWriter &writer) const override;
@@ -25,6 +25,7 @@ JsiReader::JsiReader(facebook::jsi::Runtime &runtime, const facebook::jsi::Value
 JsiReader::JsiReader(facebook::jsi::Runtime &runtime, const facebook::jsi::Value *args, size_t count) noexcept
     : m_runtime(runtime) {
   m_containers.push_back({args, count});
+  m_methodArgs.emplace(runtime, args, count);
 }
 
 JSValueType JsiReader::ValueType() noexcept {
@@ -143,6 +144,10 @@ double JsiReader::GetDouble() noexcept {
   return ReadOptional(m_currentPrimitiveValue).getNumber();
 }
 
+JsiMethodArgs *__stdcall JsiReader::GetJsiMethodArgs() noexcept {
+  return m_methodArgs ? &*m_methodArgs : nullptr;
+}
+
 void JsiReader::SetValue(const facebook::jsi::Value &value) noexcept {
   if (value.isObject()) {
     auto obj = value.getObject(m_runtime);
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <JSI/JsiMethodArgs.h>
 #include "jsi/jsi.h"
 #include "winrt/Microsoft.ReactNative.h"
 
@@ -20,7 +21,7 @@ decltype(auto) ReadOptional(std::optional<T> &opt) {
 }
 #endif
 
-struct JsiReader : implements<JsiReader, IJSValueReader> {
+struct JsiReader : implements<JsiReader, IJSValueReader, IJsiMethodArgsProvider> {
   JsiReader(facebook::jsi::Runtime &runtime, const facebook::jsi::Value &root) noexcept;
   JsiReader(facebook::jsi::Runtime &runtime, const facebook::jsi::Value *args, size_t count) noexcept;
 
@@ -33,6 +34,10 @@ struct JsiReader : implements<JsiReader, IJSValueReader> {
   int64_t GetInt64() noexcept;
   double GetDouble() noexcept;
 
+ public: // IJsiMethodArgsProvider
+  // Returns the JsiMethodArgs for the reader of the method arguments, or nullptr for other readers.
+  JsiMethodArgs *__stdcall GetJsiMethodArgs() noexcept override;
+
  private:
   enum class ContainerType {
     Object,
@@ -74,6 +79,7 @@ struct JsiReader : implements<JsiReader, IJSValueReader> {
   // when m_currentPrimitiveValue is null, the current value is the top value of m_nonPrimitiveValues
   std::optional<facebook::jsi::Value> m_currentPrimitiveValue;
   std::vector<Container> m_containers;
+  std::optional<JsiMethodArgs> m_methodArgs;
 };
 
 } // namespace winrt::Microsoft::ReactNative
@@ -19,11 +19,23 @@ namespace winrt::Microsoft::ReactNative {
 // JsiWriter implementation
 //===========================================================================
 
-JsiWriter::JsiWriter(facebook::jsi::Runtime &runtime) noexcept : m_runtime(runtime) {
+JsiWriter::JsiWriter(facebook::jsi::Runtime &runtime) noexcept : m_runtime(runtime), m_methodArgs(runtime) {
   Push({ContainerState::AcceptValueAndFinish});
 }
 
 facebook::jsi::Value JsiWriter::MoveResult() noexcept {
+  // the method invokers may write the result directly
+  if (m_methodArgs.Result) {
+    return std::move(ReadOptional(m_methodArgs.Result));
+  } else if (m_methodArgs.ResultArgs) {
+    auto &resultArgs = ReadOptional(m_methodArgs.ResultArgs);
+    facebook::jsi::Array resultArray(m_runtime, resultArgs.size());
+    for (size_t i = 0; i < resultArgs.size(); i++) {
+      resultArray.setValueAtIndex(m_runtime, i, std::move(resultArgs[i]));
+    }
+    return std::move(resultArray);
+  }
+
   VerifyElseCrash(m_containers.size() == 0);
   if (m_resultAsContainer.has_value()) {
     m_resultAsValue = ContainerToValue(std::move(ReadOptional(m_resultAsContainer)));
@@ -33,6 +45,13 @@ facebook::jsi::Value JsiWriter::MoveResult() noexcept {
 }
 
 void JsiWriter::AccessResultAsArgs(const facebook::jsi::Value *&args, size_t &count) noexcept {
+  if (m_methodArgs.ResultArgs) {
+    auto &resultArgs = ReadOptional(m_methodArgs.ResultArgs);
+    args = resultArgs.data();
+    count = resultArgs.size();
+    return;
+  }
+
   VerifyElseCrash(m_resultAsContainer.has_value());
   auto &container = ReadOptional(m_resultAsContainer);
   if (container.CurrentArrayElements.size() == 0) {
@@ -96,6 +115,10 @@ void JsiWriter::WriteArrayEnd() noexcept {
   WriteContainer(Pop());
 }
 
+JsiMethodArgs *__stdcall JsiWriter::GetJsiMethodArgs() noexcept {
+  return &m_methodArgs;
+}
+
 facebook::jsi::Value JsiWriter::ContainerToValue(Container &&container) noexcept {
   switch (container.State) {
     case ContainerState::AcceptPropertyName: {
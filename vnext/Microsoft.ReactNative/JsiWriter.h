@@ -6,12 +6,13 @@
 
 #pragma once
 
+#include <JSI/JsiMethodArgs.h>
 #include "jsi/jsi.h"
 #include "winrt/Microsoft.ReactNative.h"
 
 namespace winrt::Microsoft::ReactNative {
 
-struct JsiWriter : winrt::implements<JsiWriter, IJSValueWriter> {
+struct JsiWriter : winrt::implements<JsiWriter, IJSValueWriter, IJsiMethodArgsProvider> {
   JsiWriter(facebook::jsi::Runtime &runtime) noexcept;
 
   // MoveResult crashes when the root object is not closed.
@@ -35,6 +36,10 @@ struct JsiWriter : winrt::implements<JsiWriter, IJSValueWriter> {
   void WriteArrayBegin() noexcept;
   void WriteArrayEnd() noexcept;
 
+ public: // IJsiMethodArgsProvider
+  // Returns the JsiMethodArgs where the method invokers write the results directly.
+  JsiMethodArgs *__stdcall GetJsiMethodArgs() noexcept override;
+
  public:
   static facebook::jsi::Value ToJsiValue(facebook::jsi::Runtime &runtime, JSValueArgWriter const &argWriter) noexcept;
 
@@ -78,6 +83,7 @@ struct JsiWriter : winrt::implements<JsiWriter, IJSValueWriter> {
   std::optional<facebook::jsi::Value> m_resultAsValue;
   std::optional<Container> m_resultAsContainer;
   std::vector<Container> m_containers;
+  JsiMethodArgs m_methodArgs;
 };
 
 } // namespace winrt::Microsoft::ReactNative
@@ -6,6 +6,7 @@
 #include <UI.Xaml.Controls.h>
 #include <UI.Xaml.Input.h>
 #include <UI.Xaml.Media.h>
+#include <Utils/PropertyNames.h>
 #include <Views/ShadowNodeBase.h>
 #include "Modules/I18nManagerModule.h"
 #include "NativeUIManager.h"
@@ -404,352 +405,464 @@ static void StyleYogaNode(
     const std::string &key = pair.first;
     const auto &value = pair.second;
 
-    if (key == "flexDirection") {
-      YGFlexDirection direction = YGFlexDirectionColumn;
-
-      if (value == "column" || value.IsNull())
-        direction = YGFlexDirectionColumn;
-      else if (value == "row")
-        direction = YGFlexDirectionRow;
-      else if (value == "column-reverse")
-        direction = YGFlexDirectionColumnReverse;
-      else if (value == "row-reverse")
-        direction = YGFlexDirectionRowReverse;
-      else
-        assert(false);
+    switch (GetPropName(key)) {
+      case PropName::flexDirection: {
+        YGFlexDirection direction = YGFlexDirectionColumn;
+
+        if (value == "column" || value.IsNull())
+          direction = YGFlexDirectionColumn;
+        else if (value == "row")
+          direction = YGFlexDirectionRow;
+        else if (value == "column-reverse")
+          direction = YGFlexDirectionColumnReverse;
+        else if (value == "row-reverse")
+          direction = YGFlexDirectionRowReverse;
+        else
+          assert(false);
+
+        YGNodeStyleSetFlexDirection(yogaNode, direction);
+        break;
+      }
+      case PropName::justifyContent: {
+        YGJustify justify = YGJustifyFlexStart;
+
+        if (value == "flex-start" || value.IsNull())
+          justify = YGJustifyFlexStart;
+        else if (value == "flex-end")
+          justify = YGJustifyFlexEnd;
+        else if (value == "center")
+          justify = YGJustifyCenter;
+        else if (value == "space-between")
+          justify = YGJustifySpaceBetween;
+        else if (value == "space-around")
+          justify = YGJustifySpaceAround;
+        else if (value == "space-evenly")
+          justify = YGJustifySpaceEvenly;
+        else
+          assert(false);
+
+        YGNodeStyleSetJustifyContent(yogaNode, justify);
+        break;
+      }
+      case PropName::flexWrap: {
+        YGWrap wrap = YGWrapNoWrap;
 
-      YGNodeStyleSetFlexDirection(yogaNode, direction);
-    } else if (key == "justifyContent") {
-      YGJustify justify = YGJustifyFlexStart;
-
-      if (value == "flex-start" || value.IsNull())
-        justify = YGJustifyFlexStart;
-      else if (value == "flex-end")
-        justify = YGJustifyFlexEnd;
-      else if (value == "center")
-        justify = YGJustifyCenter;
-      else if (value == "space-between")
-        justify = YGJustifySpaceBetween;
-      else if (value == "space-around")
-        justify = YGJustifySpaceAround;
-      else if (value == "space-evenly")
-        justify = YGJustifySpaceEvenly;
-      else
-        assert(false);
+        if (value == "nowrap" || value.IsNull())
+          wrap = YGWrapNoWrap;
+        else if (value == "wrap")
+          wrap = YGWrapWrap;
+        else
+          assert(false);
 
-      YGNodeStyleSetJustifyContent(yogaNode, justify);
-    } else if (key == "flexWrap") {
-      YGWrap wrap = YGWrapNoWrap;
+        YGNodeStyleSetFlexWrap(yogaNode, wrap);
+        break;
+      }
+      case PropName::alignItems: {
+        YGAlign align = YGAlignStretch;
+
+        if (value == "stretch" || value.IsNull())
+          align = YGAlignStretch;
+        else if (value == "flex-start")
+          align = YGAlignFlexStart;
+        else if (value == "flex-end")
+          align = YGAlignFlexEnd;
+        else if (value == "center")
+          align = YGAlignCenter;
+        else if (value == "baseline")
+          align = YGAlignBaseline;
+        else
+          assert(false);
+
+        YGNodeStyleSetAlignItems(yogaNode, align);
+        break;
+      }
+      case PropName::alignSelf: {
+        YGAlign align = YGAlignAuto;
+
+        if (value == "auto" || value.IsNull())
+          align = YGAlignAuto;
+        else if (value == "stretch")
+          align = YGAlignStretch;
+        else if (value == "flex-start")
+          align = YGAlignFlexStart;
+        else if (value == "flex-end")
+          align = YGAlignFlexEnd;
+        else if (value == "center")
+          align = YGAlignCenter;
+        else if (value == "baseline")
+          align = YGAlignBaseline;
+        else
+          assert(false);
+
+        YGNodeStyleSetAlignSelf(yogaNode, align);
+        break;
+      }
+      case PropName::alignContent: {
+        YGAlign align = YGAlignFlexStart;
+
+        if (value == "stretch")
+          align = YGAlignStretch;
+        else if (value == "flex-start" || value.IsNull())
+          align = YGAlignFlexStart;
+        else if (value == "flex-end")
+          align = YGAlignFlexEnd;
+        else if (value == "center")
+          align = YGAlignCenter;
+        else if (value == "space-between")
+          align = YGAlignSpaceBetween;
+        else if (value == "space-around")
+          align = YGAlignSpaceAround;
+        else
+          assert(false);
+
+        YGNodeStyleSetAlignContent(yogaNode, align);
+        break;
+      }
+      case PropName::flex: {
+        float result = NumberOrDefault(value, 0.0f /*default*/);
 
-      if (value == "nowrap" || value.IsNull())
-        wrap = YGWrapNoWrap;
-      else if (value == "wrap")
-        wrap = YGWrapWrap;
-      else
-        assert(false);
+        YGNodeStyleSetFlex(yogaNode, result);
+        break;
+      }
+      case PropName::flexGrow: {
+        float result = NumberOrDefault(value, 0.0f /*default*/);
 
-      YGNodeStyleSetFlexWrap(yogaNode, wrap);
-    } else if (key == "alignItems") {
-      YGAlign align = YGAlignStretch;
-
-      if (value == "stretch" || value.IsNull())
-        align = YGAlignStretch;
-      else if (value == "flex-start")
-        align = YGAlignFlexStart;
-      else if (value == "flex-end")
-        align = YGAlignFlexEnd;
-      else if (value == "center")
-        align = YGAlignCenter;
-      else if (value == "baseline")
-        align = YGAlignBaseline;
-      else
-        assert(false);
+        YGNodeStyleSetFlexGrow(yogaNode, result);
+        break;
+      }
+      case PropName::flexShrink: {
+        float result = NumberOrDefault(value, 0.0f /*default*/);
 
-      YGNodeStyleSetAlignItems(yogaNode, align);
-    } else if (key == "alignSelf") {
-      YGAlign align = YGAlignAuto;
-
-      if (value == "auto" || value.IsNull())
-        align = YGAlignAuto;
-      else if (value == "stretch")
-        align = YGAlignStretch;
-      else if (value == "flex-start")
-        align = YGAlignFlexStart;
-      else if (value == "flex-end")
-        align = YGAlignFlexEnd;
-      else if (value == "center")
-        align = YGAlignCenter;
-      else if (value == "baseline")
-        align = YGAlignBaseline;
-      else
-        assert(false);
+        YGNodeStyleSetFlexShrink(yogaNode, result);
+        break;
+      }
+      case PropName::flexBasis: {
+        YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
 
-      YGNodeStyleSetAlignSelf(yogaNode, align);
-    } else if (key == "alignContent") {
-      YGAlign align = YGAlignFlexStart;
-
-      if (value == "stretch")
-        align = YGAlignStretch;
-      else if (value == "flex-start" || value.IsNull())
-        align = YGAlignFlexStart;
-      else if (value == "flex-end")
-        align = YGAlignFlexEnd;
-      else if (value == "center")
-        align = YGAlignCenter;
-      else if (value == "space-between")
-        align = YGAlignSpaceBetween;
-      else if (value == "space-around")
-        align = YGAlignSpaceAround;
-      else
-        assert(false);
+        SetYogaUnitValueAutoHelper(
+            yogaNode, result, YGNodeStyleSetFlexBasis, YGNodeStyleSetFlexBasisPercent, YGNodeStyleSetFlexBasisAuto);
+        break;
+      }
+      case PropName::position: {
+        YGPositionType position = YGPositionTypeRelative;
+
+        if (value == "relative" || value.IsNull())
+          position = YGPositionTypeRelative;
+        else if (value == "absolute")
+          position = YGPositionTypeAbsolute;
+        else if (value == "static")
+          position = YGPositionTypeStatic;
+        else
+          assert(false);
+
+        YGNodeStyleSetPositionType(yogaNode, position);
+        break;
+      }
+      case PropName::overflow: {
+        YGOverflow overflow = YGOverflowVisible;
+        if (value == "visible" || value.IsNull())
+          overflow = YGOverflowVisible;
+        else if (value == "hidden")
+          overflow = YGOverflowHidden;
+        else if (value == "scroll")
+          overflow = YGOverflowScroll;
+
+        YGNodeStyleSetOverflow(yogaNode, overflow);
+        break;
+      }
+      case PropName::display: {
+        YGDisplay display = YGDisplayFlex;
+        if (value == "flex" || value.IsNull())
+          display = YGDisplayFlex;
+        else if (value == "none")
+          display = YGDisplayNone;
+
+        YGNodeStyleSetDisplay(yogaNode, display);
+        break;
+      }
+      case PropName::direction: {
+        // https://github.com/microsoft/react-native-windows/issues/4668
+        // In order to support the direction property, we tell yoga to always layout
+        // in LTR direction, then push the appropriate FlowDirection into XAML.
+        // This way XAML handles flipping in RTL mode, which works both for RN components
+        // as well as native components that have purely XAML sub-trees (eg ComboBox).
+        YGDirection direction = YGDirectionLTR;
+
+        YGNodeStyleSetDirection(yogaNode, direction);
+        break;
+      }
+      case PropName::aspectRatio: {
+        float result = NumberOrDefault(value, 1.0f /*default*/);
 
-      YGNodeStyleSetAlignContent(yogaNode, align);
-    } else if (key == "flex") {
-      float result = NumberOrDefault(value, 0.0f /*default*/);
-
-      YGNodeStyleSetFlex(yogaNode, result);
-    } else if (key == "flexGrow") {
-      float result = NumberOrDefault(value, 0.0f /*default*/);
-
-      YGNodeStyleSetFlexGrow(yogaNode, result);
-    } else if (key == "flexShrink") {
-      float result = NumberOrDefault(value, 0.0f /*default*/);
-
-      YGNodeStyleSetFlexShrink(yogaNode, result);
-    } else if (key == "flexBasis") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaUnitValueAutoHelper(
-          yogaNode, result, YGNodeStyleSetFlexBasis, YGNodeStyleSetFlexBasisPercent, YGNodeStyleSetFlexBasisAuto);
-    } else if (key == "position") {
-      YGPositionType position = YGPositionTypeRelative;
-
-      if (value == "relative" || value.IsNull())
-        position = YGPositionTypeRelative;
-      else if (value == "absolute")
-        position = YGPositionTypeAbsolute;
-      else if (value == "static")
-        position = YGPositionTypeStatic;
-      else
-        assert(false);
+        YGNodeStyleSetAspectRatio(yogaNode, result);
+        break;
+      }
+      case PropName::left: {
+        YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
 
-      YGNodeStyleSetPositionType(yogaNode, position);
-    } else if (key == "overflow") {
-      YGOverflow overflow = YGOverflowVisible;
-      if (value == "visible" || value.IsNull())
-        overflow = YGOverflowVisible;
-      else if (value == "hidden")
-        overflow = YGOverflowHidden;
-      else if (value == "scroll")
-        overflow = YGOverflowScroll;
-
-      YGNodeStyleSetOverflow(yogaNode, overflow);
-    } else if (key == "display") {
-      YGDisplay display = YGDisplayFlex;
-      if (value == "flex" || value.IsNull())
-        display = YGDisplayFlex;
-      else if (value == "none")
-        display = YGDisplayNone;
-
-      YGNodeStyleSetDisplay(yogaNode, display);
-    } else if (key == "direction") {
-      // https://github.com/microsoft/react-native-windows/issues/4668
-      // In order to support the direction property, we tell yoga to always layout
-      // in LTR direction, then push the appropriate FlowDirection into XAML.
-      // This way XAML handles flipping in RTL mode, which works both for RN components
-      // as well as native components that have purely XAML sub-trees (eg ComboBox).
-      YGDirection direction = YGDirectionLTR;
-
-      YGNodeStyleSetDirection(yogaNode, direction);
-    } else if (key == "aspectRatio") {
-      float result = NumberOrDefault(value, 1.0f /*default*/);
-
-      YGNodeStyleSetAspectRatio(yogaNode, result);
-    } else if (key == "left") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueHelper(yogaNode, YGEdgeLeft, result, YGNodeStyleSetPosition, YGNodeStyleSetPositionPercent);
-    } else if (key == "top") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueHelper(yogaNode, YGEdgeTop, result, YGNodeStyleSetPosition, YGNodeStyleSetPositionPercent);
-    } else if (key == "right") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueHelper(yogaNode, YGEdgeRight, result, YGNodeStyleSetPosition, YGNodeStyleSetPositionPercent);
-    } else if (key == "bottom") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueHelper(yogaNode, YGEdgeBottom, result, YGNodeStyleSetPosition, YGNodeStyleSetPositionPercent);
-    } else if (key == "end") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueHelper(yogaNode, YGEdgeEnd, result, YGNodeStyleSetPosition, YGNodeStyleSetPositionPercent);
-    } else if (key == "start") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueHelper(yogaNode, YGEdgeStart, result, YGNodeStyleSetPosition, YGNodeStyleSetPositionPercent);
-    } else if (key == "width") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaUnitValueAutoHelper(
-          yogaNode, result, YGNodeStyleSetWidth, YGNodeStyleSetWidthPercent, YGNodeStyleSetWidthAuto);
-    } else if (key == "minWidth") {
-      YGValue result = YGValueOrDefault(value, YGValue{0.0f, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaUnitValueHelper(yogaNode, result, YGNodeStyleSetMinWidth, YGNodeStyleSetMinWidthPercent);
-    } else if (key == "maxWidth") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaUnitValueHelper(yogaNode, result, YGNodeStyleSetMaxWidth, YGNodeStyleSetMaxWidthPercent);
-    } else if (key == "height") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaUnitValueAutoHelper(
-          yogaNode, result, YGNodeStyleSetHeight, YGNodeStyleSetHeightPercent, YGNodeStyleSetHeightAuto);
-    } else if (key == "minHeight") {
-      YGValue result = YGValueOrDefault(value, YGValue{0.0f, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaUnitValueHelper(yogaNode, result, YGNodeStyleSetMinHeight, YGNodeStyleSetMinHeightPercent);
-    } else if (key == "maxHeight") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaUnitValueHelper(yogaNode, result, YGNodeStyleSetMaxHeight, YGNodeStyleSetMaxHeightPercent);
-    } else if (key == "margin") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueAutoHelper(
-          yogaNode, YGEdgeAll, result, YGNodeStyleSetMargin, YGNodeStyleSetMarginPercent, YGNodeStyleSetMarginAuto);
-    } else if (key == "marginLeft") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueAutoHelper(
-          yogaNode, YGEdgeLeft, result, YGNodeStyleSetMargin, YGNodeStyleSetMarginPercent, YGNodeStyleSetMarginAuto);
-    } else if (key == "marginStart") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueAutoHelper(
-          yogaNode, YGEdgeStart, result, YGNodeStyleSetMargin, YGNodeStyleSetMarginPercent, YGNodeStyleSetMarginAuto);
-    } else if (key == "marginTop") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueAutoHelper(
-          yogaNode, YGEdgeTop, result, YGNodeStyleSetMargin, YGNodeStyleSetMarginPercent, YGNodeStyleSetMarginAuto);
-    } else if (key == "marginRight") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueAutoHelper(
-          yogaNode, YGEdgeRight, result, YGNodeStyleSetMargin, YGNodeStyleSetMarginPercent, YGNodeStyleSetMarginAuto);
-    } else if (key == "marginEnd") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueAutoHelper(
-          yogaNode, YGEdgeEnd, result, YGNodeStyleSetMargin, YGNodeStyleSetMarginPercent, YGNodeStyleSetMarginAuto);
-    } else if (key == "marginBottom") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueAutoHelper(
-          yogaNode, YGEdgeBottom, result, YGNodeStyleSetMargin, YGNodeStyleSetMarginPercent, YGNodeStyleSetMarginAuto);
-    } else if (key == "marginHorizontal") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueAutoHelper(
-          yogaNode,
-          YGEdgeHorizontal,
-          result,
-          YGNodeStyleSetMargin,
-          YGNodeStyleSetMarginPercent,
-          YGNodeStyleSetMarginAuto);
-    } else if (key == "marginVertical") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueAutoHelper(
-          yogaNode,
-          YGEdgeVertical,
-          result,
-          YGNodeStyleSetMargin,
-          YGNodeStyleSetMarginPercent,
-          YGNodeStyleSetMarginAuto);
-    } else if (key == "padding") {
-      if (!shadowNode.ImplementsPadding()) {
+        SetYogaValueHelper(yogaNode, YGEdgeLeft, result, YGNodeStyleSetPosition, YGNodeStyleSetPositionPercent);
+        break;
+      }
+      case PropName::top: {
         YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
 
-        SetYogaValueHelper(yogaNode, YGEdgeAll, result, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent);
+        SetYogaValueHelper(yogaNode, YGEdgeTop, result, YGNodeStyleSetPosition, YGNodeStyleSetPositionPercent);
+        break;
       }
-    } else if (key == "paddingLeft") {
-      if (!shadowNode.ImplementsPadding()) {
+      case PropName::right: {
         YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
 
-        SetYogaValueHelper(yogaNode, YGEdgeLeft, result, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent);
+        SetYogaValueHelper(yogaNode, YGEdgeRight, result, YGNodeStyleSetPosition, YGNodeStyleSetPositionPercent);
+        break;
       }
-    } else if (key == "paddingStart") {
-      if (!shadowNode.ImplementsPadding()) {
+      case PropName::bottom: {
         YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
 
-        SetYogaValueHelper(yogaNode, YGEdgeStart, result, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent);
+        SetYogaValueHelper(yogaNode, YGEdgeBottom, result, YGNodeStyleSetPosition, YGNodeStyleSetPositionPercent);
+        break;
       }
-    } else if (key == "paddingTop") {
-      if (!shadowNode.ImplementsPadding()) {
+      case PropName::end: {
         YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
 
-        SetYogaValueHelper(yogaNode, YGEdgeTop, result, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent);
+        SetYogaValueHelper(yogaNode, YGEdgeEnd, result, YGNodeStyleSetPosition, YGNodeStyleSetPositionPercent);
+        break;
       }
-    } else if (key == "paddingRight") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
+      case PropName::start: {
+        YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
 
-      SetYogaValueHelper(yogaNode, YGEdgeRight, result, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent);
-    } else if (key == "paddingEnd") {
-      if (!shadowNode.ImplementsPadding()) {
+        SetYogaValueHelper(yogaNode, YGEdgeStart, result, YGNodeStyleSetPosition, YGNodeStyleSetPositionPercent);
+        break;
+      }
+      case PropName::width: {
         YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
 
-        SetYogaValueHelper(yogaNode, YGEdgeEnd, result, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent);
+        SetYogaUnitValueAutoHelper(
+            yogaNode, result, YGNodeStyleSetWidth, YGNodeStyleSetWidthPercent, YGNodeStyleSetWidthAuto);
+        break;
       }
-    } else if (key == "paddingBottom") {
-      if (!shadowNode.ImplementsPadding()) {
+      case PropName::minWidth: {
+        YGValue result = YGValueOrDefault(value, YGValue{0.0f, YGUnitPoint} /*default*/, shadowNode, key);
+
+        SetYogaUnitValueHelper(yogaNode, result, YGNodeStyleSetMinWidth, YGNodeStyleSetMinWidthPercent);
+        break;
+      }
+      case PropName::maxWidth: {
         YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
 
-        SetYogaValueHelper(yogaNode, YGEdgeBottom, result, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent);
+        SetYogaUnitValueHelper(yogaNode, result, YGNodeStyleSetMaxWidth, YGNodeStyleSetMaxWidthPercent);
+        break;
       }
-    } else if (key == "paddingHorizontal") {
-      if (!shadowNode.ImplementsPadding()) {
+      case PropName::height: {
         YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
 
-        SetYogaValueHelper(yogaNode, YGEdgeHorizontal, result, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent);
+        SetYogaUnitValueAutoHelper(
+            yogaNode, result, YGNodeStyleSetHeight, YGNodeStyleSetHeightPercent, YGNodeStyleSetHeightAuto);
+        break;
+      }
+      case PropName::minHeight: {
+        YGValue result = YGValueOrDefault(value, YGValue{0.0f, YGUnitPoint} /*default*/, shadowNode, key);
+
+        SetYogaUnitValueHelper(yogaNode, result, YGNodeStyleSetMinHeight, YGNodeStyleSetMinHeightPercent);
+        break;
       }
-    } else if (key == "paddingVertical") {
-      if (!shadowNode.ImplementsPadding()) {
+      case PropName::maxHeight: {
         YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
 
-        SetYogaValueHelper(yogaNode, YGEdgeVertical, result, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent);
+        SetYogaUnitValueHelper(yogaNode, result, YGNodeStyleSetMaxHeight, YGNodeStyleSetMaxHeightPercent);
+        break;
       }
-    } else if (key == "borderWidth") {
-      float result = NumberOrDefault(value, 0.0f /*default*/);
+      case PropName::margin: {
+        YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
 
-      YGNodeStyleSetBorder(yogaNode, YGEdgeAll, result);
-    } else if (key == "borderLeftWidth") {
-      float result = NumberOrDefault(value, 0.0f /*default*/);
+        SetYogaValueAutoHelper(
+            yogaNode, YGEdgeAll, result, YGNodeStyleSetMargin, YGNodeStyleSetMarginPercent, YGNodeStyleSetMarginAuto);
+        break;
+      }
+      case PropName::marginLeft: {
+        YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
 
-      YGNodeStyleSetBorder(yogaNode, YGEdgeLeft, result);
-    } else if (key == "borderStartWidth") {
-      float result = NumberOrDefault(value, 0.0f /*default*/);
+        SetYogaValueAutoHelper(
+            yogaNode, YGEdgeLeft, result, YGNodeStyleSetMargin, YGNodeStyleSetMarginPercent, YGNodeStyleSetMarginAuto);
+        break;
+      }
+      case PropName::marginStart: {
+        YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
 
-      YGNodeStyleSetBorder(yogaNode, YGEdgeStart, result);
-    } else if (key == "borderTopWidth") {
-      float result = NumberOrDefault(value, 0.0f /*default*/);
+        SetYogaValueAutoHelper(
+            yogaNode, YGEdgeStart, result, YGNodeStyleSetMargin, YGNodeStyleSetMarginPercent, YGNodeStyleSetMarginAuto);
+        break;
+      }
+      case PropName::marginTop: {
+        YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
 
-      YGNodeStyleSetBorder(yogaNode, YGEdgeTop, result);
-    } else if (key == "borderRightWidth") {
-      float result = NumberOrDefault(value, 0.0f /*default*/);
+        SetYogaValueAutoHelper(
+            yogaNode, YGEdgeTop, result, YGNodeStyleSetMargin, YGNodeStyleSetMarginPercent, YGNodeStyleSetMarginAuto);
+        break;
+      }
+      case PropName::marginRight: {
+        YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
 
-      YGNodeStyleSetBorder(yogaNode, YGEdgeRight, result);
-    } else if (key == "borderEndWidth") {
-      float result = NumberOrDefault(value, 0.0f /*default*/);
+        SetYogaValueAutoHelper(
+            yogaNode, YGEdgeRight, result, YGNodeStyleSetMargin, YGNodeStyleSetMarginPercent, YGNodeStyleSetMarginAuto);
+        break;
+      }
+      case PropName::marginEnd: {
+        YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
+
+        SetYogaValueAutoHelper(
+            yogaNode, YGEdgeEnd, result, YGNodeStyleSetMargin, YGNodeStyleSetMarginPercent, YGNodeStyleSetMarginAuto);
+        break;
+      }
+      case PropName::marginBottom: {
+        YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
+
+        SetYogaValueAutoHelper(
+            yogaNode,
+            YGEdgeBottom,
+            result,
+            YGNodeStyleSetMargin,
+            YGNodeStyleSetMarginPercent,
+            YGNodeStyleSetMarginAuto);
+        break;
+      }
+      case PropName::marginHorizontal: {
+        YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
+
+        SetYogaValueAutoHelper(
+            yogaNode,
+            YGEdgeHorizontal,
+            result,
+            YGNodeStyleSetMargin,
+            YGNodeStyleSetMarginPercent,
+            YGNodeStyleSetMarginAuto);
+        break;
+      }
+      case PropName::marginVertical: {
+        YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
+
+        SetYogaValueAutoHelper(
+            yogaNode,
+            YGEdgeVertical,
+            result,
+            YGNodeStyleSetMargin,
+            YGNodeStyleSetMarginPercent,
+            YGNodeStyleSetMarginAuto);
+        break;
+      }
+      case PropName::padding: {
+        if (!shadowNode.ImplementsPadding()) {
+          YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
+
+          SetYogaValueHelper(yogaNode, YGEdgeAll, result, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent);
+        }
+        break;
+      }
+      case PropName::paddingLeft: {
+        if (!shadowNode.ImplementsPadding()) {
+          YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
+
+          SetYogaValueHelper(yogaNode, YGEdgeLeft, result, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent);
+        }
+        break;
+      }
+      case PropName::paddingStart: {
+        if (!shadowNode.ImplementsPadding()) {
+          YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
+
+          SetYogaValueHelper(yogaNode, YGEdgeStart, result, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent);
+        }
+        break;
+      }
+      case PropName::paddingTop: {
+        if (!shadowNode.ImplementsPadding()) {
+          YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
+
+          SetYogaValueHelper(yogaNode, YGEdgeTop, result, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent);
+        }
+        break;
+      }
+      case PropName::paddingRight: {
+        YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
+
+        SetYogaValueHelper(yogaNode, YGEdgeRight, result, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent);
+        break;
+      }
+      case PropName::paddingEnd: {
+        if (!shadowNode.ImplementsPadding()) {
+          YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
 
-      YGNodeStyleSetBorder(yogaNode, YGEdgeEnd, result);
-    } else if (key == "borderBottomWidth") {
-      float result = NumberOrDefault(value, 0.0f /*default*/);
+          SetYogaValueHelper(yogaNode, YGEdgeEnd, result, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent);
+        }
+        break;
+      }
+      case PropName::paddingBottom: {
+        if (!shadowNode.ImplementsPadding()) {
+          YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
+
+          SetYogaValueHelper(yogaNode, YGEdgeBottom, result, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent);
+        }
+        break;
+      }
+      case PropName::paddingHorizontal: {
+        if (!shadowNode.ImplementsPadding()) {
+          YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
+
+          SetYogaValueHelper(yogaNode, YGEdgeHorizontal, result, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent);
+        }
+        break;
+      }
+      case PropName::paddingVertical: {
+        if (!shadowNode.ImplementsPadding()) {
+          YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
+
+          SetYogaValueHelper(yogaNode, YGEdgeVertical, result, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent);
+        }
+        break;
+      }
+      case PropName::borderWidth: {
+        float result = NumberOrDefault(value, 0.0f /*default*/);
+
+        YGNodeStyleSetBorder(yogaNode, YGEdgeAll, result);
+        break;
+      }
+      case PropName::borderLeftWidth: {
+        float result = NumberOrDefault(value, 0.0f /*default*/);
 
-      YGNodeStyleSetBorder(yogaNode, YGEdgeBottom, result);
+        YGNodeStyleSetBorder(yogaNode, YGEdgeLeft, result);
+        break;
+      }
+      case PropName::borderStartWidth: {
+        float result = NumberOrDefault(value, 0.0f /*default*/);
+
+        YGNodeStyleSetBorder(yogaNode, YGEdgeStart, result);
+        break;
+      }
+      case PropName::borderTopWidth: {
+        float result = NumberOrDefault(value, 0.0f /*default*/);
+
+        YGNodeStyleSetBorder(yogaNode, YGEdgeTop, result);
+        break;
+      }
+      case PropName::borderRightWidth: {
+        float result = NumberOrDefault(value, 0.0f /*default*/);
+
+        YGNodeStyleSetBorder(yogaNode, YGEdgeRight, result);
+        break;
+      }
+      case PropName::borderEndWidth: {
+        float result = NumberOrDefault(value, 0.0f /*default*/);
+
+        YGNodeStyleSetBorder(yogaNode, YGEdgeEnd, result);
+        break;
+      }
+      case PropName::borderBottomWidth: {
+        float result = NumberOrDefault(value, 0.0f /*default*/);
+
+        YGNodeStyleSetBorder(yogaNode, YGEdgeBottom, result);
+        break;
+      }
+      default:
+        break;
     }
   }
 }
@@ -14,7 +14,8 @@ struct JSCallInvokerScheduler
   JSCallInvokerScheduler(
       std::shared_ptr<facebook::react::CallInvoker> &&callInvoker,
       Mso::Functor<void(const Mso::ErrorCode &)> &&errorHandler,
-      Mso::Promise<void> &&whenQuit) noexcept;
+      Mso::Promise<void> &&whenQuit,
+      std::string_view instrumentationName) noexcept;
   ~JSCallInvokerScheduler() noexcept override;
 
  public:
@@ -47,10 +48,14 @@ std::shared_ptr<facebook::react::MessageQueueThread> JSCallInvokerScheduler::Get
 JSCallInvokerScheduler::JSCallInvokerScheduler(
     std::shared_ptr<facebook::react::CallInvoker> &&callInvoker,
     Mso::Functor<void(const Mso::ErrorCode &)> &&errorHandler,
-    Mso::Promise<void> &&whenQuit) noexcept
+    Mso::Promise<void> &&whenQuit,
+    std::string_view instrumentationName) noexcept
     : m_callInvoker(callInvoker) {
   m_jsMessageThread = std::make_shared<Mso::React::MessageDispatchQueue>(
-      Mso::DispatchQueue::MakeLooperQueue(), std::move(errorHandler), std::move(whenQuit));
+      Mso::DispatchQueue::MakeLooperQueue(Mso::DispatchQueueOptions::LockFreePost),
+      std::move(errorHandler),
+      std::move(whenQuit),
+      instrumentationName);
 }
 
 JSCallInvokerScheduler::~JSCallInvokerScheduler() noexcept {
@@ -93,9 +98,10 @@ void JSCallInvokerScheduler::AwaitTermination() noexcept {
 Mso::CntPtr<IDispatchQueueScheduler> MakeJSCallInvokerScheduler(
     std::shared_ptr<facebook::react::CallInvoker> &&callInvoker,
     Mso::Functor<void(const Mso::ErrorCode &)> &&errorHandler,
-    Mso::Promise<void> &&whenQuit) noexcept {
+    Mso::Promise<void> &&whenQuit,
+    std::string_view instrumentationName) noexcept {
   return Mso::Make<JSCallInvokerScheduler, IDispatchQueueScheduler>(
-      std::move(callInvoker), std::move(errorHandler), std::move(whenQuit));
+      std::move(callInvoker), std::move(errorHandler), std::move(whenQuit), instrumentationName);
 }
 
 } // namespace Mso
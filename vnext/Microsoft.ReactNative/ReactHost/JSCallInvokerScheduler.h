@@ -20,5 +20,6 @@ struct IJSCallInvokerQueueScheduler : IUnknown {
 Mso::CntPtr<IDispatchQueueScheduler> MakeJSCallInvokerScheduler(
     std::shared_ptr<facebook::react::CallInvoker> &&callInvoker,
     Mso::Functor<void(const Mso::ErrorCode &)> &&errorHandler,
-    Mso::Promise<void> &&whenQuit = nullptr) noexcept;
+    Mso::Promise<void> &&whenQuit = nullptr,
+    std::string_view instrumentationName = {}) noexcept;
 } // namespace Mso
@@ -238,6 +238,10 @@ struct ReactOptions {
 
   std::string ByteCodeFileUri;
   bool EnableByteCodeCaching{true};
+
+  //! Flag to generate the missing Chakra prepared scripts in background instead of before the script evaluation.
+  bool EnableBackgroundScriptPreparation{false};
+
   JSIEngine JsiEngine{JSIEngine::Chakra};
 
   //! Enable function nativePerformanceNow.
@@ -245,6 +249,11 @@ struct ReactOptions {
   //! It is not safe to expose to Custom Function. Add this flag so we can turn it off for Custom Function.
   bool EnableNativePerformanceNow{true};
 
+  //! Flag to collect task statistics for the JS, native and UI queues of the React instance.
+  //! The statistics are reported under the JSQueue, NativeQueue, UIQueue and UIBatchingQueue names.
+  //! It is off by default because every posted task is wrapped to measure it.
+  bool EnableQueueInstrumentation{false};
+
   ReactDevOptions DeveloperSettings = {};
 
   //! This controls the availability of various developer support functionality including
@@ -256,7 +256,7 @@ bool ReactHost::IsInstanceLoaded() const noexcept {
   }
 
   // Create a new serial queue if it was provided
-  return Mso::DispatchQueue::MakeSerialQueue();
+  return Mso::DispatchQueue::MakeSerialQueue(Mso::DispatchQueueOptions::LockFreePost);
 }
 
 ReactOptions ReactHost::Options() const noexcept {
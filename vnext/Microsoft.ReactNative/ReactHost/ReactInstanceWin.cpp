@@ -54,11 +54,12 @@
 #endif // USE_HERMES
 
 #if defined(USE_V8)
-#include <winrt/Windows.Storage.h>
-#include "BaseScriptStoreImpl.h"
 #include "V8JSIRuntimeHolder.h"
 #endif // USE_V8
 
+#include <winrt/Windows.Storage.h>
+#include "BaseScriptStoreImpl.h"
+
 #include "RedBox.h"
 
 #include <tuple>
@@ -381,6 +382,26 @@ void ReactInstanceWin::Initialize() noexcept {
       std::unique_ptr<facebook::jsi::ScriptStore> scriptStore = nullptr;
       std::unique_ptr<facebook::jsi::PreparedScriptStore> preparedScriptStore = nullptr;
 
+      if (m_options.JsiEngine == JSIEngine::Chakra && !m_options.ByteCodeFileUri.empty()) {
+        // The byte code file shipped with the app is generated ahead of time with the bundle timestamp as its script
+        // version, so it keeps the timestamp versioning instead of the content hash.
+        scriptStore = std::make_unique<react::uwp::UwpScriptStore>();
+        preparedScriptStore =
+            std::make_unique<react::uwp::UwpPreparedScriptStore>(winrt::to_hstring(m_options.ByteCodeFileUri));
+      } else if (
+          (m_options.EnableByteCodeCaching && m_options.JsiEngine != JSIEngine::Hermes) ||
+          m_options.JsiEngine == JSIEngine::V8) {
+        // V8 and Chakra share the same prepared script store. Its entries are keyed by the runtime signature and
+        // by the bundle content hash, so the prepared scripts are never reused across bundle or engine updates.
+        // V8 has always used its code cache, so it does not depend on EnableByteCodeCaching. Hermes cannot generate
+        // byte code at run time, so it does not use the store.
+        scriptStore = std::make_unique<facebook::react::BaseScriptStoreImpl>(
+            std::make_shared<react::uwp::UwpBundleVersionProvider>(BundleRootPath()));
+        preparedScriptStore =
+            std::make_unique<facebook::react::ContentAddressedPreparedScriptStore>(getApplicationLocalFolder());
+      }
+      devSettings->useBackgroundScriptPreparation = m_options.EnableBackgroundScriptPreparation;
+
       switch (m_options.JsiEngine) {
         case JSIEngine::Hermes:
 #if defined(USE_HERMES)
@@ -390,19 +411,11 @@ void ReactInstanceWin::Initialize() noexcept {
 #endif
         case JSIEngine::V8:
 #if defined(USE_V8)
-          preparedScriptStore =
-              std::make_unique<facebook::react::BasePreparedScriptStoreImpl>(getApplicationLocalFolder());
-
           devSettings->jsiRuntimeHolder = std::make_shared<facebook::react::V8JSIRuntimeHolder>(
               devSettings, m_jsMessageThread.Load(), std::move(scriptStore), std::move(preparedScriptStore));
           break;
 #endif
         case JSIEngine::Chakra:
-          if (m_options.EnableByteCodeCaching || !m_options.ByteCodeFileUri.empty()) {
-            scriptStore = std::make_unique<react::uwp::UwpScriptStore>();
-            preparedScriptStore =
-                std::make_unique<react::uwp::UwpPreparedScriptStore>(winrt::to_hstring(m_options.ByteCodeFileUri));
-          }
           devSettings->jsiRuntimeHolder = std::make_shared<Microsoft::JSI::ChakraRuntimeHolder>(
               devSettings, m_jsMessageThread.Load(), std::move(scriptStore), std::move(preparedScriptStore));
           break;
@@ -552,6 +565,10 @@ const ReactOptions &ReactInstanceWin::Options() const noexcept {
   return m_options;
 }
 
+std::string_view ReactInstanceWin::QueueInstrumentationName(std::string_view name) const noexcept {
+  return m_options.EnableQueueInstrumentation ? name : std::string_view{};
+}
+
 ReactInstanceState ReactInstanceWin::State() const noexcept {
   return m_state;
 }
@@ -562,7 +579,8 @@ void ReactInstanceWin::InitJSMessageThread() noexcept {
   auto scheduler = Mso::MakeJSCallInvokerScheduler(
       m_instance.Load()->getJSCallInvoker(),
       Mso::MakeWeakMemberFunctor(this, &ReactInstanceWin::OnError),
-      Mso::Copy(m_whenDestroyed));
+      Mso::Copy(m_whenDestroyed),
+      QueueInstrumentationName(JSQueueInstrumentationName));
   auto jsDispatchQueue = Mso::DispatchQueue::MakeCustomQueue(Mso::CntPtr(scheduler));
 
   // This work item will be processed as a first item in JS queue when the react instance is created.
@@ -582,18 +600,25 @@ void ReactInstanceWin::InitJSMessageThread() noexcept {
 
 void ReactInstanceWin::InitNativeMessageThread() noexcept {
   // Native queue was already given us in constructor.
-  m_nativeMessageThread.Exchange(
-      std::make_shared<MessageDispatchQueue>(Queue(), Mso::MakeWeakMemberFunctor(this, &ReactInstanceWin::OnError)));
+  m_nativeMessageThread.Exchange(std::make_shared<MessageDispatchQueue>(
+      Queue(),
+      Mso::MakeWeakMemberFunctor(this, &ReactInstanceWin::OnError),
+      /*whenQuit:*/ nullptr,
+      QueueInstrumentationName(NativeQueueInstrumentationName)));
 }
 
 void ReactInstanceWin::InitUIMessageThread() noexcept {
   // Native queue was already given us in constructor.
   m_uiQueue = winrt::Microsoft::ReactNative::implementation::ReactDispatcher::GetUIDispatchQueue(m_options.Properties);
   VerifyElseCrashSz(m_uiQueue, "No UI Dispatcher provided");
-  m_uiMessageThread.Exchange(
-      std::make_shared<MessageDispatchQueue>(m_uiQueue, Mso::MakeWeakMemberFunctor(this, &ReactInstanceWin::OnError)));
+  m_uiMessageThread.Exchange(std::make_shared<MessageDispatchQueue>(
+      m_uiQueue,
+      Mso::MakeWeakMemberFunctor(this, &ReactInstanceWin::OnError),
+      /*whenQuit:*/ nullptr,
+      QueueInstrumentationName(UIQueueInstrumentationName)));
 
-  m_batchingUIThread = react::uwp::MakeBatchingQueueThread(m_uiMessageThread.Load());
+  m_batchingUIThread = react::uwp::MakeBatchingQueueThread(
+      m_uiMessageThread.Load(), QueueInstrumentationName(UIBatchingQueueInstrumentationName));
 }
 
 void ReactInstanceWin::InitUIManager() noexcept {
@@ -877,13 +902,11 @@ Mso::CntPtr<IReactInstanceInternal> MakeReactInstance(
       reactHost, std::move(options), std::move(whenCreated), std::move(whenLoaded), std::move(updateUI));
 }
 
-#if defined(USE_V8)
 std::string ReactInstanceWin::getApplicationLocalFolder() {
   auto local = winrt::Windows::Storage::ApplicationData::Current().LocalFolder().Path();
 
   return Microsoft::Common::Unicode::Utf16ToUtf8(local.c_str(), local.size()) + "\\";
 }
-#endif
 
 bool ReactInstanceWin::UseWebDebugger() const noexcept {
   return m_useWebDebugger;
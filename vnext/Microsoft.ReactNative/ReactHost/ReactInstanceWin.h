@@ -100,6 +100,7 @@ class ReactInstanceWin final : public Mso::ActiveObject<IReactInstanceInternal>
   void InitNativeMessageThread() noexcept;
   void InitUIMessageThread() noexcept;
   void InitUIManager() noexcept;
+  std::string_view QueueInstrumentationName(std::string_view name) const noexcept;
   std::string GetBytecodeFileName() noexcept;
   std::function<void()> GetLiveReloadCallback() noexcept;
   std::function<void(std::string)> GetErrorCallback() noexcept;
@@ -126,9 +127,7 @@ class ReactInstanceWin final : public Mso::ActiveObject<IReactInstanceInternal>
     folly::dynamic Args;
   };
 
-#if defined(USE_V8)
   static std::string getApplicationLocalFolder();
-#endif
 
  private: // immutable fields
   const Mso::WeakPtr<IReactHost> m_weakReactHost;
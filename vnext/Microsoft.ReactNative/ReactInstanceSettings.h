@@ -99,6 +99,9 @@ struct ReactInstanceSettings : ReactInstanceSettingsT<ReactInstanceSettings> {
   bool EnableByteCodeCaching() noexcept;
   void EnableByteCodeCaching(bool value) noexcept;
 
+  bool EnableBackgroundScriptPreparation() noexcept;
+  void EnableBackgroundScriptPreparation(bool value) noexcept;
+
   //! Same as UseDeveloperSupport
   bool EnableDeveloperMenu() noexcept;
   void EnableDeveloperMenu(bool value) noexcept;
@@ -167,6 +170,7 @@ struct ReactInstanceSettings : ReactInstanceSettingsT<ReactInstanceSettings> {
   hstring m_javaScriptBundleFile{};
   bool m_enableJITCompilation{true};
   bool m_enableByteCodeCaching{false};
+  bool m_enableBackgroundScriptPreparation{false};
   hstring m_byteCodeFileUri{};
   hstring m_debugBundlePath{};
   hstring m_bundleRootPath{};
@@ -243,6 +247,14 @@ inline void ReactInstanceSettings::EnableByteCodeCaching(bool value) noexcept {
   m_enableByteCodeCaching = value;
 }
 
+inline bool ReactInstanceSettings::EnableBackgroundScriptPreparation() noexcept {
+  return m_enableBackgroundScriptPreparation;
+}
+
+inline void ReactInstanceSettings::EnableBackgroundScriptPreparation(bool value) noexcept {
+  m_enableBackgroundScriptPreparation = value;
+}
+
 inline hstring ReactInstanceSettings::ByteCodeFileUri() noexcept {
   return m_byteCodeFileUri;
 }
@@ -124,6 +124,7 @@ IAsyncAction ReactNativeHost::ReloadInstance() noexcept {
 
   reactOptions.ByteCodeFileUri = to_string(m_instanceSettings.ByteCodeFileUri());
   reactOptions.EnableByteCodeCaching = m_instanceSettings.EnableByteCodeCaching();
+  reactOptions.EnableBackgroundScriptPreparation = m_instanceSettings.EnableBackgroundScriptPreparation();
   reactOptions.JsiEngine = static_cast<Mso::React::JSIEngine>(m_instanceSettings.JSIEngineOverride());
 
   reactOptions.ModuleProvider = modulesProvider;
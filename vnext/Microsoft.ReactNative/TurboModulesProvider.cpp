@@ -73,10 +73,87 @@ struct TurboModuleBuilder : winrt::implements<TurboModuleBuilder, IReactModuleBu
   IReactContext m_reactContext;
 };
 
+/*-------------------------------------------------------------------------------
+  NoOpJSValueWriter
+-------------------------------------------------------------------------------*/
+
+// Void methods do not return a result, and the values that they write are ignored.
+// One writer is shared by all calls of a method to avoid creating a JsiWriter per call.
+struct NoOpJSValueWriter : implements<NoOpJSValueWriter, IJSValueWriter> {
+  void WriteNull() noexcept {}
+  void WriteBoolean(bool /*value*/) noexcept {}
+  void WriteInt64(int64_t /*value*/) noexcept {}
+  void WriteDouble(double /*value*/) noexcept {}
+  void WriteString(const winrt::hstring & /*value*/) noexcept {}
+  void WriteObjectBegin() noexcept {}
+  void WritePropertyName(const winrt::hstring & /*name*/) noexcept {}
+  void WriteObjectEnd() noexcept {}
+  void WriteArrayBegin() noexcept {}
+  void WriteArrayEnd() noexcept {}
+};
+
+/*-------------------------------------------------------------------------------
+  RuntimeTeardownNotifier
+-------------------------------------------------------------------------------*/
+
+// It is owned by the JS runtime through a global property, and the runtime destroys it when it is torn down.
+// TurboModules use it to release the JSI values that they cached for the runtime.
+// The property is defined as non-enumerable, non-writable and non-configurable, so JS code does not see it
+// when it enumerates the global object, and cannot replace or delete it to release the cached values early.
+struct RuntimeTeardownNotifier : facebook::jsi::HostObject {
+  ~RuntimeTeardownNotifier() noexcept override {
+    for (auto &listener : m_listeners) {
+      listener();
+    }
+  }
+
+  static RuntimeTeardownNotifier &GetOrCreate(facebook::jsi::Runtime &runtime) {
+    constexpr const char *notifierPropertyName = "__rnwRuntimeTeardownNotifier";
+    auto global = runtime.global();
+    auto notifierValue = global.getProperty(runtime, notifierPropertyName);
+    if (notifierValue.isObject()) {
+      auto notifierObject = notifierValue.getObject(runtime);
+      if (notifierObject.isHostObject<RuntimeTeardownNotifier>(runtime)) {
+        return *notifierObject.getHostObject<RuntimeTeardownNotifier>(runtime);
+      }
+    }
+
+    auto notifier = std::make_shared<RuntimeTeardownNotifier>();
+    facebook::jsi::Object descriptor{runtime};
+    descriptor.setProperty(runtime, "value", facebook::jsi::Object::createFromHostObject(runtime, notifier));
+    descriptor.setProperty(runtime, "enumerable", false);
+    descriptor.setProperty(runtime, "writable", false);
+    descriptor.setProperty(runtime, "configurable", false);
+    global.getPropertyAsObject(runtime, "Object")
+        .getPropertyAsFunction(runtime, "defineProperty")
+        .call(runtime, global, facebook::jsi::String::createFromAscii(runtime, notifierPropertyName), descriptor);
+    return *notifier;
+  }
+
+  void AddListener(std::function<void()> &&listener) {
+    m_listeners.push_back(std::move(listener));
+  }
+
+ private:
+  std::vector<std::function<void()>> m_listeners;
+};
+
 /*-------------------------------------------------------------------------------
   TurboModuleImpl
 -------------------------------------------------------------------------------*/
 
+// Members of a TurboModule that were already requested by a JS runtime.
+struct TurboModuleRuntimeCache {
+  // Looked up by PropNameID::compare to avoid the UTF-8 conversion of the property name. The engines compare
+  // property names by their interned IDs, so the linear scan is cheap for the few members a module has.
+  // The members that the module does not have are not cached, so the list never grows beyond the module
+  // methods and getConstants, no matter what property names JS code probes.
+  std::vector<std::pair<facebook::jsi::PropNameID, facebook::jsi::Value>> Members;
+  std::optional<facebook::jsi::Value> Constants;
+};
+
+using TurboModuleRuntimeCacheMap = std::unordered_map<facebook::jsi::Runtime *, TurboModuleRuntimeCache>;
+
 class TurboModuleImpl : public facebook::react::TurboModule {
  public:
   TurboModuleImpl(
@@ -109,7 +186,53 @@ class TurboModuleImpl : public facebook::react::TurboModule {
       return m_hostObjectWrapper->get(runtime, propName);
     }
 
-    // it is not safe to assume that "runtime" never changes, so members are not cached here
+    // the module may be used by more than one runtime, so members are cached per runtime
+    auto &runtimeCache = GetRuntimeCache(runtime);
+    for (auto &member : runtimeCache.Members) {
+      if (facebook::jsi::PropNameID::compare(runtime, member.first, propName)) {
+        return facebook::jsi::Value(runtime, member.second);
+      }
+    }
+
+    auto value = CreateMember(runtime, propName);
+    if (value.isUndefined()) {
+      return value;
+    }
+
+    runtimeCache.Members.emplace_back(
+        facebook::jsi::PropNameID(runtime, propName), facebook::jsi::Value(runtime, value));
+    return value;
+  }
+
+  void set(facebook::jsi::Runtime &rt, const facebook::jsi::PropNameID &name, const facebook::jsi::Value &value)
+      override {
+    if (m_hostObjectWrapper) {
+      return m_hostObjectWrapper->set(rt, name, value);
+    }
+
+    facebook::react::TurboModule::set(rt, name, value);
+  }
+
+ private:
+  TurboModuleRuntimeCache &GetRuntimeCache(facebook::jsi::Runtime &runtime) {
+    auto it = m_runtimeCaches->find(&runtime);
+    if (it == m_runtimeCaches->end()) {
+      it = m_runtimeCaches->emplace(&runtime, TurboModuleRuntimeCache{}).first;
+
+      // the cached JSI values must be released before the runtime is destroyed,
+      // and the runtime address may be reused by the next runtime
+      RuntimeTeardownNotifier::GetOrCreate(runtime).AddListener(
+          [weakRuntimeCaches = std::weak_ptr<TurboModuleRuntimeCacheMap>(m_runtimeCaches), &runtime]() noexcept {
+            if (auto runtimeCaches = weakRuntimeCaches.lock()) {
+              runtimeCaches->erase(&runtime);
+            }
+          });
+    }
+
+    return it->second;
+  }
+
+  facebook::jsi::Value CreateMember(facebook::jsi::Runtime &runtime, const facebook::jsi::PropNameID &propName) {
     auto tmb = m_moduleBuilder.as<TurboModuleBuilder>();
     auto key = propName.utf8(runtime);
 
@@ -119,11 +242,24 @@ class TurboModuleImpl : public facebook::react::TurboModule {
           runtime,
           propName,
           0,
-          [&runtime, tmb](
+          [&runtime, tmb, weakRuntimeCaches = std::weak_ptr<TurboModuleRuntimeCacheMap>(m_runtimeCaches)](
               facebook::jsi::Runtime &rt,
               const facebook::jsi::Value &thisVal,
               const facebook::jsi::Value *args,
               size_t count) {
+            auto runtimeCaches = weakRuntimeCaches.lock();
+            TurboModuleRuntimeCache *runtimeCache = nullptr;
+            if (runtimeCaches) {
+              auto it = runtimeCaches->find(&runtime);
+              if (it != runtimeCaches->end()) {
+                runtimeCache = &it->second;
+              }
+            }
+
+            if (runtimeCache && runtimeCache->Constants) {
+              return facebook::jsi::Value(runtime, *runtimeCache->Constants);
+            }
+
             // collect all constants to an object
             auto writer = winrt::make<JsiWriter>(runtime);
             writer.WriteObjectBegin();
@@ -131,7 +267,18 @@ class TurboModuleImpl : public facebook::react::TurboModule {
               cp(writer);
             }
             writer.WriteObjectEnd();
-            return writer.as<JsiWriter>()->MoveResult();
+            auto constants = writer.as<JsiWriter>()->MoveResult();
+
+            // the same constants object is returned to all callers, so it is frozen to prevent one caller
+            // from changing the constants seen by the others
+            runtime.global()
+                .getPropertyAsObject(runtime, "Object")
+                .getPropertyAsFunction(runtime, "freeze")
+                .call(runtime, constants);
+            if (runtimeCache) {
+              runtimeCache->Constants = facebook::jsi::Value(runtime, constants);
+            }
+            return constants;
           });
     }
 
@@ -143,7 +290,11 @@ class TurboModuleImpl : public facebook::react::TurboModule {
             runtime,
             propName,
             0,
-            [&runtime, method = it->second](
+            [&runtime,
+             method = it->second,
+             noOpWriter = it->second.ReturnType == MethodReturnType::Void
+                 ? IJSValueWriter{winrt::make<NoOpJSValueWriter>()}
+                 : IJSValueWriter{nullptr}](
                 facebook::jsi::Runtime &rt,
                 const facebook::jsi::Value &thisVal,
                 const facebook::jsi::Value *args,
@@ -170,8 +321,9 @@ class TurboModuleImpl : public facebook::react::TurboModule {
               auto argReader = winrt::make<JsiReader>(runtime, args, serializableArgumentCount);
 
               // prepare output value
-              // TODO: it is no reason to pass a argWriter just to receive [undefined] for void, should be optimized
-              auto argWriter = winrt::make<JsiWriter>(runtime);
+              // void methods do not write any result, so they share a writer that ignores the written values
+              IJSValueWriter argWriter =
+                  method.ReturnType == MethodReturnType::Void ? noOpWriter : winrt::make<JsiWriter>(runtime);
 
               // call the function
               switch (method.ReturnType) {
@@ -185,18 +337,13 @@ class TurboModuleImpl : public facebook::react::TurboModule {
                         method.Method(
                             argReader,
                             argWriter,
-                            [promise, &runtime](const IJSValueWriter &writer) {
-                              auto result = writer.as<JsiWriter>()->MoveResult();
-                              if (result.isObject()) {
-                                auto resultArrayObject = result.getObject(runtime);
-                                VerifyElseCrash(resultArrayObject.isArray(runtime));
-                                auto resultArray = resultArrayObject.getArray(runtime);
-                                VerifyElseCrash(resultArray.length(runtime) == 1);
-                                auto resultItem = resultArray.getValueAtIndex(runtime, 0);
-                                promise->resolve(resultItem);
-                              } else {
-                                VerifyElseCrash(false);
-                              }
+                            [promise](const IJSValueWriter &writer) {
+                              // the result is written as a single callback argument
+                              const facebook::jsi::Value *resultArgs = nullptr;
+                              size_t resultCount = 0;
+                              writer.as<JsiWriter>()->AccessResultAsArgs(resultArgs, resultCount);
+                              VerifyElseCrash(resultCount == 1);
+                              promise->resolve(resultArgs[0]);
                             },
                             [promise, &runtime](const IJSValueWriter &writer) {
                               auto result = writer.as<JsiWriter>()->MoveResult();
@@ -289,19 +436,11 @@ class TurboModuleImpl : public facebook::react::TurboModule {
     return facebook::jsi::Value::undefined();
   }
 
-  void set(facebook::jsi::Runtime &rt, const facebook::jsi::PropNameID &name, const facebook::jsi::Value &value)
-      override {
-    if (m_hostObjectWrapper) {
-      return m_hostObjectWrapper->set(rt, name, value);
-    }
-
-    facebook::react::TurboModule::set(rt, name, value);
-  }
-
  private:
   IReactModuleBuilder m_moduleBuilder;
   IInspectable providedModule;
   std::shared_ptr<implementation::HostObjectWrapper> m_hostObjectWrapper;
+  std::shared_ptr<TurboModuleRuntimeCacheMap> m_runtimeCaches{std::make_shared<TurboModuleRuntimeCacheMap>()};
 };
 
 /*-------------------------------------------------------------------------------
@@ -4,8 +4,11 @@
 #include "pch.h"
 
 #include <Utils/LocalBundleReader.h>
+#include <winrt/Windows.ApplicationModel.h>
 #include <winrt/Windows.Storage.Streams.h>
 #include <winrt/Windows.Storage.h>
+#include <algorithm>
+#include "MemoryMappedBuffer.h"
 #include "Unicode.h"
 
 #if _MSC_VER <= 1913
@@ -52,6 +55,52 @@ std::string LocalBundleReader::LoadBundle(const std::string &bundlePath) {
   return LoadBundleAsync(bundlePath).get();
 }
 
+std::unique_ptr<const facebook::react::JSBigString> LocalBundleReader::LoadBundleBigString(
+    const std::string &bundleUri) {
+  std::wstring bundlePath = ResolveBundlePath(bundleUri);
+  if (!bundlePath.empty()) {
+    try {
+      return Microsoft::JSI::MakeMemoryMappedBigString(bundlePath.c_str());
+    } catch (const facebook::jsi::JSINativeException &) {
+      // The file cannot be opened or mapped directly. Read it with the storage APIs below.
+    }
+  }
+
+  return std::make_unique<StorageFileBigString>(bundleUri);
+}
+
+std::wstring LocalBundleReader::ResolveBundlePath(const std::string &bundleUri) noexcept {
+  constexpr std::wstring_view appxScheme{L"ms-appx:///"};
+  constexpr std::wstring_view appLocalDataScheme{L"ms-appdata:///local/"};
+  constexpr std::wstring_view appTempDataScheme{L"ms-appdata:///temp/"};
+
+  try {
+    std::wstring path = Microsoft::Common::Unicode::Utf8ToUtf16(bundleUri);
+    std::wstring rootPath;
+    if (path._Starts_with(appxScheme)) {
+      rootPath = winrt::Windows::ApplicationModel::Package::Current().InstalledLocation().Path();
+      path.erase(0, appxScheme.size());
+    } else if (path._Starts_with(appLocalDataScheme)) {
+      rootPath = winrt::Windows::Storage::ApplicationData::Current().LocalFolder().Path();
+      path.erase(0, appLocalDataScheme.size());
+    } else if (path._Starts_with(appTempDataScheme)) {
+      rootPath = winrt::Windows::Storage::ApplicationData::Current().TemporaryFolder().Path();
+      path.erase(0, appTempDataScheme.size());
+    } else if (path._Starts_with(L"ms-app")) {
+      // Other application URIs, e.g. "ms-appdata:///roaming/", are read with the storage APIs.
+      return {};
+    }
+
+    std::replace(path.begin(), path.end(), L'/', L'\\');
+    return rootPath.empty() ? path : rootPath + L'\\' + path;
+  } catch (const winrt::hresult_error &) {
+    // The app has no package identity or application data.
+    return {};
+  } catch (const std::exception &) {
+    return {};
+  }
+}
+
 StorageFileBigString::StorageFileBigString(const std::string &path) {
   m_futureBuffer = LocalBundleReader::LoadBundleAsync(path);
 }
@@ -4,6 +4,7 @@
 #pragma once
 #include <cxxreact/JSBigString.h>
 #include <future>
+#include <memory>
 #include <string>
 
 namespace react::uwp {
@@ -12,6 +13,15 @@ class LocalBundleReader {
  public:
   static std::future<std::string> LoadBundleAsync(const std::string &bundlePath);
   static std::string LoadBundle(const std::string &bundlePath);
+
+  // Memory maps the bundle file when it can be opened directly, so that the bundle is not copied to the heap.
+  // Otherwise, e.g. for a file that is only accessible through the storage APIs, reads it as StorageFileBigString.
+  // While the bundle is mapped, an updater can replace the file or rename it, but cannot overwrite it in place.
+  static std::unique_ptr<const facebook::react::JSBigString> LoadBundleBigString(const std::string &bundleUri);
+
+  // Returns the file system path of a local bundle path or an "ms-appx:///" or "ms-appdata:///" URI.
+  // Returns an empty string if the URI cannot be resolved.
+  static std::wstring ResolveBundlePath(const std::string &bundleUri) noexcept;
 };
 
 class StorageFileBigString : public facebook::react::JSBigString {
@@ -0,0 +1,57 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <Utils/PropertyNames.h>
+
+#include <algorithm>
+#include <array>
+#include <initializer_list>
+
+namespace Microsoft::ReactNative {
+
+// Maps the interned property names to the property handlers of a view manager.
+// A view manager builds its table once from the table of its base class and the names of the properties it handles.
+// The handlers of the base classes are merged in at build time, and a property is dispatched with one array lookup
+// instead of walking the UpdateProperty chain of the class hierarchy.
+template <class THandler>
+class PropertyHandlerTable {
+ public:
+  PropertyHandlerTable(THandler handler, std::initializer_list<PropName> propNames) noexcept {
+    Add(handler, propNames);
+  }
+
+  // The handler replaces the base class handlers for the same property names.
+  // The base class handlers are converted to THandler: the pointers to the base class member functions
+  // become pointers to the derived class member functions.
+  template <class TBaseHandler>
+  PropertyHandlerTable(
+      const PropertyHandlerTable<TBaseHandler> &baseTable,
+      THandler handler,
+      std::initializer_list<PropName> propNames) noexcept {
+    std::copy(baseTable.m_handlers.begin(), baseTable.m_handlers.end(), m_handlers.begin());
+    Add(handler, propNames);
+  }
+
+  // Returns the handler for the property, or nullptr if the property is not supported.
+  THandler Find(PropName propName) const noexcept {
+    return m_handlers[static_cast<size_t>(propName)];
+  }
+
+ private:
+  void Add(THandler handler, std::initializer_list<PropName> propNames) noexcept {
+    for (PropName propName : propNames) {
+      m_handlers[static_cast<size_t>(propName)] = handler;
+    }
+  }
+
+  template <class TOtherHandler>
+  friend class PropertyHandlerTable;
+
+ private:
+  // PropName::Unknown never gets a handler.
+  std::array<THandler, PropNameCount> m_handlers{};
+};
+
+} // namespace Microsoft::ReactNative
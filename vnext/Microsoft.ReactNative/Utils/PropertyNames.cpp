@@ -0,0 +1,159 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "PropertyNames.h"
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+
+namespace Microsoft::ReactNative {
+
+namespace {
+
+constexpr std::string_view PropNameStrings[] = {
+    std::string_view{}, // PropName::Unknown
+#define RNW_PROP_NAME_STRING(name) #name,
+    RNW_PROP_NAMES(RNW_PROP_NAME_STRING)
+#undef RNW_PROP_NAME_STRING
+};
+
+static_assert(std::size(PropNameStrings) == PropNameCount);
+
+// FNV-1a hash of the property name.
+constexpr uint32_t HashPropName(std::string_view name) noexcept {
+  uint32_t hash = 2166136261u;
+  for (char ch : name) {
+    hash = (hash ^ static_cast<uint8_t>(ch)) * 16777619u;
+  }
+
+  return hash;
+}
+
+constexpr size_t NextPowerOfTwo(size_t value) noexcept {
+  size_t result = 1;
+  while (result < value) {
+    result *= 2;
+  }
+
+  return result;
+}
+
+// Perfect hash table for the names in RNW_PROP_NAMES. It is built at compile time with the hash and displace
+// algorithm: the names are split by their hash into small buckets, and each bucket gets the displacement
+// that moves all its names into free slots.
+// The lookup takes one hash, one displacement lookup and one string comparison to reject the unknown names.
+// The table has at least twice more slots than names, and a bucket has two names on average:
+// most buckets are placed on the first attempt.
+constexpr size_t PropNameSlotCount = NextPowerOfTwo(PropNameCount * 2);
+constexpr size_t PropNameBucketCount = NextPowerOfTwo(PropNameCount / 2);
+
+// The build fails if placing the buckets takes more attempts. It keeps the compile time search short
+// as names are added to RNW_PROP_NAMES: increase PropNameSlotCount if it is reached.
+constexpr size_t MaxPropNamePlacementAttempts = PropNameBucketCount * 4;
+
+constexpr size_t GetPropNameBucket(uint32_t hash) noexcept {
+  return (hash >> 16) & (PropNameBucketCount - 1);
+}
+
+constexpr size_t GetPropNameSlot(uint32_t hash, uint16_t displacement) noexcept {
+  uint32_t mixed = hash ^ (displacement * 0x9E3779B9u);
+  mixed ^= mixed >> 15;
+  mixed *= 0x85EBCA6Bu;
+  mixed ^= mixed >> 13;
+  return mixed & (PropNameSlotCount - 1);
+}
+
+struct PropNameTable {
+  std::array<uint16_t, PropNameBucketCount> Displacements{};
+  std::array<PropName, PropNameSlotCount> Slots{};
+
+  // False if the buckets were not placed within MaxPropNamePlacementAttempts.
+  bool IsPerfect{false};
+  size_t PlacementAttempts{0};
+};
+
+// The names of one bucket and their hashes.
+struct PropNameBucket {
+  std::array<PropName, PropNameCount> Names{};
+  std::array<uint32_t, PropNameCount> Hashes{};
+  size_t Size{0};
+};
+
+constexpr bool
+TryPlacePropNameBucket(PropNameTable &table, const PropNameBucket &bucket, uint16_t displacement) noexcept {
+  for (size_t i = 0; i < bucket.Size; ++i) {
+    PropName &slot = table.Slots[GetPropNameSlot(bucket.Hashes[i], displacement)];
+    if (slot != PropName::Unknown) {
+      // Release the slots taken by the previous names of the bucket.
+      for (size_t j = 0; j < i; ++j) {
+        table.Slots[GetPropNameSlot(bucket.Hashes[j], displacement)] = PropName::Unknown;
+      }
+
+      return false;
+    }
+
+    slot = bucket.Names[i];
+  }
+
+  return true;
+}
+
+constexpr PropNameTable BuildPropNameTable() noexcept {
+  std::array<PropNameBucket, PropNameBucketCount> buckets{};
+  size_t maxBucketSize = 0;
+  for (size_t i = 1; i < PropNameCount; ++i) {
+    uint32_t hash = HashPropName(PropNameStrings[i]);
+    PropNameBucket &bucket = buckets[GetPropNameBucket(hash)];
+    bucket.Names[bucket.Size] = static_cast<PropName>(i);
+    bucket.Hashes[bucket.Size] = hash;
+    maxBucketSize = std::max(maxBucketSize, ++bucket.Size);
+  }
+
+  // The largest buckets are placed first while most of the slots are free.
+  PropNameTable table{};
+  for (size_t bucketSize = maxBucketSize; bucketSize > 0; --bucketSize) {
+    for (size_t bucketIndex = 0; bucketIndex < PropNameBucketCount; ++bucketIndex) {
+      if (buckets[bucketIndex].Size != bucketSize) {
+        continue;
+      }
+
+      uint16_t displacement = 0;
+      while (!TryPlacePropNameBucket(table, buckets[bucketIndex], displacement)) {
+        if (++table.PlacementAttempts >= MaxPropNamePlacementAttempts) {
+          return table;
+        }
+
+        ++displacement;
+      }
+
+      ++table.PlacementAttempts;
+      table.Displacements[bucketIndex] = displacement;
+    }
+  }
+
+  table.IsPerfect = true;
+  return table;
+}
+
+constexpr PropNameTable PropNames = BuildPropNameTable();
+static_assert(PropNames.IsPerfect, "Each name in RNW_PROP_NAMES must have its own slot in the perfect hash table.");
+static_assert(
+    PropNames.PlacementAttempts <= MaxPropNamePlacementAttempts,
+    "The perfect hash table search must stay within MaxPropNamePlacementAttempts.");
+
+} // namespace
+
+PropName GetPropName(std::string_view name) noexcept {
+  uint32_t hash = HashPropName(name);
+  PropName propName = PropNames.Slots[GetPropNameSlot(hash, PropNames.Displacements[GetPropNameBucket(hash)])];
+  return (PropNameStrings[static_cast<size_t>(propName)] == name) ? propName : PropName::Unknown;
+}
+
+std::string_view GetPropNameString(PropName propName) noexcept {
+  size_t index = static_cast<size_t>(propName);
+  return index < PropNameCount ? PropNameStrings[index] : std::string_view{};
+}
+
+} // namespace Microsoft::ReactNative
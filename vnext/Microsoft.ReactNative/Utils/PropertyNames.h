@@ -0,0 +1,140 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace Microsoft::ReactNative {
+
+// The view property names handled by the built-in view managers and by the Yoga node styling.
+#define RNW_PROP_NAMES(X)           \
+  X(accessibilityActions)           \
+  X(accessibilityHint)              \
+  X(accessibilityLabel)             \
+  X(accessibilityLiveRegion)        \
+  X(accessibilityPosInSet)          \
+  X(accessibilityRole)              \
+  X(accessibilitySetSize)           \
+  X(accessibilityState)             \
+  X(accessibilityValue)             \
+  X(accessible)                     \
+  X(alignContent)                   \
+  X(alignItems)                     \
+  X(alignSelf)                      \
+  X(aspectRatio)                    \
+  X(backgroundColor)                \
+  X(borderBottomEndRadius)          \
+  X(borderBottomLeftRadius)         \
+  X(borderBottomRightRadius)        \
+  X(borderBottomStartRadius)        \
+  X(borderBottomWidth)              \
+  X(borderColor)                    \
+  X(borderEndWidth)                 \
+  X(borderLeftWidth)                \
+  X(borderRadius)                   \
+  X(borderRightWidth)               \
+  X(borderStartWidth)               \
+  X(borderTopEndRadius)             \
+  X(borderTopLeftRadius)            \
+  X(borderTopRightRadius)           \
+  X(borderTopStartRadius)           \
+  X(borderTopWidth)                 \
+  X(borderWidth)                    \
+  X(bottom)                         \
+  X(color)                          \
+  X(direction)                      \
+  X(display)                        \
+  X(enableFocusRing)                \
+  X(end)                            \
+  X(flex)                           \
+  X(flexBasis)                      \
+  X(flexDirection)                  \
+  X(flexGrow)                       \
+  X(flexShrink)                     \
+  X(flexWrap)                       \
+  X(focusable)                      \
+  X(height)                         \
+  X(horizontal)                     \
+  X(justifyContent)                 \
+  X(keyboardDismissMode)            \
+  X(keyDownEvents)                  \
+  X(keyUpEvents)                    \
+  X(left)                           \
+  X(margin)                         \
+  X(marginBottom)                   \
+  X(marginEnd)                      \
+  X(marginHorizontal)               \
+  X(marginLeft)                     \
+  X(marginRight)                    \
+  X(marginStart)                    \
+  X(marginTop)                      \
+  X(marginVertical)                 \
+  X(maxHeight)                      \
+  X(maximumZoomScale)               \
+  X(maxWidth)                       \
+  X(minHeight)                      \
+  X(minimumZoomScale)               \
+  X(minWidth)                       \
+  X(onClick)                        \
+  X(onLayout)                       \
+  X(onMouseEnter)                   \
+  X(onMouseLeave)                   \
+  X(opacity)                        \
+  X(overflow)                       \
+  X(padding)                        \
+  X(paddingBottom)                  \
+  X(paddingEnd)                     \
+  X(paddingHorizontal)              \
+  X(paddingLeft)                    \
+  X(paddingRight)                   \
+  X(paddingStart)                   \
+  X(paddingTop)                     \
+  X(paddingVertical)                \
+  X(pagingEnabled)                  \
+  X(pointerEvents)                  \
+  X(position)                       \
+  X(right)                          \
+  X(scrollEnabled)                  \
+  X(showsHorizontalScrollIndicator) \
+  X(showsVerticalScrollIndicator)   \
+  X(snapToAlignment)                \
+  X(snapToEnd)                      \
+  X(snapToInterval)                 \
+  X(snapToOffsets)                  \
+  X(snapToStart)                    \
+  X(start)                          \
+  X(tabIndex)                       \
+  X(testID)                         \
+  X(tooltip)                        \
+  X(top)                            \
+  X(transform)                      \
+  X(width)                          \
+  X(writingDirection)               \
+  X(zIndex)                         \
+  X(zoomScale)
+
+// Interned view property name.
+// The property handlers use it to dispatch with a switch instead of a chain of string comparisons.
+enum class PropName : uint16_t {
+  Unknown = 0,
+#define RNW_PROP_NAME_ENUM(name) name,
+  RNW_PROP_NAMES(RNW_PROP_NAME_ENUM)
+#undef RNW_PROP_NAME_ENUM
+};
+
+// The number of the PropName values including PropName::Unknown.
+#define RNW_PROP_NAME_COUNT(name) +1
+constexpr size_t PropNameCount = 1 RNW_PROP_NAMES(RNW_PROP_NAME_COUNT);
+#undef RNW_PROP_NAME_COUNT
+
+// Returns the interned name for the property name, or PropName::Unknown if the name is not in RNW_PROP_NAMES.
+// The lookup uses a perfect hash table: it costs one hash and at most one string comparison.
+PropName GetPropName(std::string_view name) noexcept;
+
+// Returns the string of the interned name. It is empty for PropName::Unknown.
+std::string_view GetPropNameString(PropName propName) noexcept;
+
+} // namespace Microsoft::ReactNative
@@ -1,10 +1,13 @@
 #include "pch.h"
 
 #include <Utils/UwpScriptStore.h>
+#include <Utils/LocalBundleReader.h>
 #include <winrt/Windows.Foundation.h>
 #include <winrt/Windows.Storage.FileProperties.h>
 #include <winrt/Windows.Storage.h>
+#include <filesystem>
 #include <future>
+#include "MemoryMappedBuffer.h"
 #include "Unicode.h"
 
 namespace winrt {
@@ -53,4 +56,20 @@ std::future<facebook::jsi::ScriptVersion_t> UwpScriptStore::getScriptVersionAsyn
   co_return GetFileVersion(file.Path().c_str());
 }
 
+facebook::jsi::ScriptVersion_t UwpBundleVersionProvider::getVersion(const std::string &url) noexcept {
+  try {
+    // The bundle path is composed the same way as when the bundle is loaded.
+    std::wstring bundlePath = LocalBundleReader::ResolveBundlePath(
+        (std::filesystem::path(m_bundleRootPath) / (url + ".bundle")).string());
+    if (bundlePath.empty()) {
+      return 0;
+    }
+
+    auto buffer = Microsoft::JSI::MakeMemoryMappedBuffer(bundlePath.c_str());
+    return facebook::react::ComputeContentHash(buffer->data(), buffer->size());
+  } catch (const std::exception &) {
+    return 0;
+  }
+}
+
 } // namespace react::uwp
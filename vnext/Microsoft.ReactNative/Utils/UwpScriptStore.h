@@ -1,6 +1,7 @@
 #pragma once
 #include <JSI/ScriptStore.h>
 #include <future>
+#include "BaseScriptStoreImpl.h"
 
 namespace react::uwp {
 
@@ -19,4 +20,16 @@ class UwpScriptStore : public facebook::jsi::ScriptStore {
   std::future<facebook::jsi::ScriptVersion_t> getScriptVersionAsync(const std::string &bundleUri);
 };
 
+// Uses the content hash of the bundle under the bundle root path as the script version, so the prepared scripts of
+// all the JS engines follow the same versioning.
+class UwpBundleVersionProvider : public facebook::react::ScriptVersionProvider {
+ public:
+  UwpBundleVersionProvider(std::string bundleRootPath) noexcept : m_bundleRootPath{std::move(bundleRootPath)} {}
+
+  facebook::jsi::ScriptVersion_t getVersion(const std::string &url) noexcept override;
+
+ private:
+  std::string m_bundleRootPath;
+};
+
 } // namespace react::uwp
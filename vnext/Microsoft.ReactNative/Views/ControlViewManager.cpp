@@ -50,6 +50,56 @@ bool ControlViewManager::UpdateProperty(
     ShadowNodeBase *nodeToUpdate,
     const std::string &propertyName,
     const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  // Without a control the properties are ignored, including the ones handled by the base classes.
+  if (nodeToUpdate->GetView() == nullptr) {
+    return true;
+  }
+
+  return DispatchProperty(*this, GetPropertyHandlers(), nodeToUpdate, propertyName, propertyValue);
+}
+
+/*static*/ const ControlViewManager::PropertyHandlers<ControlViewManager> &
+ControlViewManager::GetPropertyHandlers() noexcept {
+  static const PropertyHandlers<ControlViewManager> handlers{
+      Super::GetPropertyHandlers(),
+      &ControlViewManager::UpdateControlProperty,
+      {PropName::backgroundColor,
+       PropName::borderColor,
+       PropName::borderLeftWidth,
+       PropName::borderTopWidth,
+       PropName::borderRightWidth,
+       PropName::borderBottomWidth,
+       PropName::borderStartWidth,
+       PropName::borderEndWidth,
+       PropName::borderWidth,
+       PropName::color,
+       PropName::borderTopLeftRadius,
+       PropName::borderTopRightRadius,
+       PropName::borderTopStartRadius,
+       PropName::borderTopEndRadius,
+       PropName::borderBottomRightRadius,
+       PropName::borderBottomLeftRadius,
+       PropName::borderBottomStartRadius,
+       PropName::borderBottomEndRadius,
+       PropName::borderRadius,
+       PropName::paddingLeft,
+       PropName::paddingTop,
+       PropName::paddingRight,
+       PropName::paddingBottom,
+       PropName::paddingStart,
+       PropName::paddingEnd,
+       PropName::paddingHorizontal,
+       PropName::paddingVertical,
+       PropName::padding,
+       PropName::tabIndex}};
+  return handlers;
+}
+
+bool ControlViewManager::UpdateControlProperty(
+    ShadowNodeBase *nodeToUpdate,
+    PropName /*propName*/,
+    const std::string &propertyName,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
   auto control(nodeToUpdate->GetView().as<xaml::Controls::Control>());
 
   bool implementsPadding = nodeToUpdate->ImplementsPadding();
@@ -74,7 +124,8 @@ bool ControlViewManager::UpdateProperty(
         control.ClearValue(TAB_INDEX_PROPERTY());
       }
     } else {
-      ret = Super::UpdateProperty(nodeToUpdate, propertyName, propertyValue);
+      // The padding is not supported by the control.
+      ret = false;
     }
   }
 
@@ -24,6 +24,15 @@ class REACTWINDOWS_EXPORT ControlViewManager : public FrameworkElementViewManage
 
  protected:
   void OnViewCreated(XamlView view) override;
+
+  static const PropertyHandlers<ControlViewManager> &GetPropertyHandlers() noexcept;
+
+ private:
+  bool UpdateControlProperty(
+      ShadowNodeBase *nodeToUpdate,
+      PropName propName,
+      const std::string &propertyName,
+      const winrt::Microsoft::ReactNative::JSValue &propertyValue);
 };
 
 } // namespace Microsoft::ReactNative
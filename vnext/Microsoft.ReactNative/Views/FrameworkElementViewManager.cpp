@@ -10,6 +10,7 @@
 
 #include <JSValueWriter.h>
 #include <Utils/AccessibilityUtils.h>
+#include <Utils/PropertyNames.h>
 #include <Utils/PropertyUtils.h>
 #include <Utils/ValueUtils.h>
 
@@ -190,353 +191,450 @@ bool FrameworkElementViewManager::UpdateProperty(
     ShadowNodeBase *nodeToUpdate,
     const std::string &propertyName,
     const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  // Without an element the properties are ignored, including the ones handled by ViewManagerBase.
+  if (nodeToUpdate->GetView() == nullptr) {
+    return true;
+  }
+
+  return DispatchProperty(*this, GetPropertyHandlers(), nodeToUpdate, propertyName, propertyValue);
+}
+
+/*static*/ const FrameworkElementViewManager::PropertyHandlers<FrameworkElementViewManager> &
+FrameworkElementViewManager::GetPropertyHandlers() noexcept {
+  static const PropertyHandlers<FrameworkElementViewManager> handlers{
+      Super::GetPropertyHandlers(),
+      &FrameworkElementViewManager::UpdateFrameworkElementProperty,
+      {PropName::opacity,
+       PropName::transform,
+       PropName::width,
+       PropName::height,
+       PropName::minWidth,
+       PropName::maxWidth,
+       PropName::minHeight,
+       PropName::maxHeight,
+       PropName::accessibilityHint,
+       PropName::accessibilityLabel,
+       PropName::accessible,
+       PropName::accessibilityLiveRegion,
+       PropName::accessibilityPosInSet,
+       PropName::accessibilitySetSize,
+       PropName::accessibilityRole,
+       PropName::accessibilityState,
+       PropName::accessibilityValue,
+       PropName::testID,
+       PropName::tooltip,
+       PropName::zIndex,
+       PropName::direction,
+       PropName::writingDirection,
+       PropName::accessibilityActions}};
+  return handlers;
+}
+
+bool FrameworkElementViewManager::UpdateFrameworkElementProperty(
+    ShadowNodeBase *nodeToUpdate,
+    PropName propName,
+    const std::string &propertyName,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
   auto element(nodeToUpdate->GetView().as<xaml::FrameworkElement>());
   if (element != nullptr) {
-    if (propertyName == "opacity") {
-      if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Double ||
-          propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Int64) {
-        double opacity = propertyValue.AsDouble();
-        if (opacity >= 0 && opacity <= 1)
-          element.Opacity(opacity);
-        // else
-        // TODO report error
-      } else if (propertyValue.IsNull()) {
-        element.ClearValue(xaml::UIElement::OpacityProperty());
-      }
-    } else if (propertyName == "transform") {
-      if (element.try_as<xaml::IUIElement10>()) // Works on 19H1+
-      {
-        if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Array) {
-          assert(propertyValue.AsArray().size() == 16);
-          winrt::Windows::Foundation::Numerics::float4x4 transformMatrix;
-          transformMatrix.m11 = static_cast<float>(propertyValue[0].AsDouble());
-          transformMatrix.m12 = static_cast<float>(propertyValue[1].AsDouble());
-          transformMatrix.m13 = static_cast<float>(propertyValue[2].AsDouble());
-          transformMatrix.m14 = static_cast<float>(propertyValue[3].AsDouble());
-          transformMatrix.m21 = static_cast<float>(propertyValue[4].AsDouble());
-          transformMatrix.m22 = static_cast<float>(propertyValue[5].AsDouble());
-          transformMatrix.m23 = static_cast<float>(propertyValue[6].AsDouble());
-          transformMatrix.m24 = static_cast<float>(propertyValue[7].AsDouble());
-          transformMatrix.m31 = static_cast<float>(propertyValue[8].AsDouble());
-          transformMatrix.m32 = static_cast<float>(propertyValue[9].AsDouble());
-          transformMatrix.m33 = static_cast<float>(propertyValue[10].AsDouble());
-          transformMatrix.m34 = static_cast<float>(propertyValue[11].AsDouble());
-          transformMatrix.m41 = static_cast<float>(propertyValue[12].AsDouble());
-          transformMatrix.m42 = static_cast<float>(propertyValue[13].AsDouble());
-          transformMatrix.m43 = static_cast<float>(propertyValue[14].AsDouble());
-          transformMatrix.m44 = static_cast<float>(propertyValue[15].AsDouble());
-
-          if (!element.IsLoaded()) {
-            element.Loaded([=](auto sender, auto &&) -> auto {
-              ApplyTransformMatrix(sender.as<xaml::UIElement>(), nodeToUpdate, transformMatrix);
-            });
-          } else {
-            ApplyTransformMatrix(element, nodeToUpdate, transformMatrix);
-          }
+    switch (propName) {
+      case PropName::opacity: {
+        if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Double ||
+            propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Int64) {
+          double opacity = propertyValue.AsDouble();
+          if (opacity >= 0 && opacity <= 1)
+            element.Opacity(opacity);
+          // else
+          // TODO report error
         } else if (propertyValue.IsNull()) {
-          element.TransformMatrix(winrt::Windows::Foundation::Numerics::float4x4::identity());
+          element.ClearValue(xaml::UIElement::OpacityProperty());
         }
-      } else {
-        cdebug << "[Dim down] " << propertyName << "\n";
+        break;
       }
-    } else if (propertyName == "width") {
-      if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Double ||
-          propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Int64) {
-        double width = propertyValue.AsDouble();
-        if (width >= 0)
-          element.Width(width);
-        // else
-        // TODO report error
-      } else if (propertyValue.IsNull()) {
-        element.ClearValue(xaml::FrameworkElement::WidthProperty());
+      case PropName::transform: {
+        if (element.try_as<xaml::IUIElement10>()) // Works on 19H1+
+        {
+          if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Array) {
+            assert(propertyValue.AsArray().size() == 16);
+            winrt::Windows::Foundation::Numerics::float4x4 transformMatrix;
+            transformMatrix.m11 = static_cast<float>(propertyValue[0].AsDouble());
+            transformMatrix.m12 = static_cast<float>(propertyValue[1].AsDouble());
+            transformMatrix.m13 = static_cast<float>(propertyValue[2].AsDouble());
+            transformMatrix.m14 = static_cast<float>(propertyValue[3].AsDouble());
+            transformMatrix.m21 = static_cast<float>(propertyValue[4].AsDouble());
+            transformMatrix.m22 = static_cast<float>(propertyValue[5].AsDouble());
+            transformMatrix.m23 = static_cast<float>(propertyValue[6].AsDouble());
+            transformMatrix.m24 = static_cast<float>(propertyValue[7].AsDouble());
+            transformMatrix.m31 = static_cast<float>(propertyValue[8].AsDouble());
+            transformMatrix.m32 = static_cast<float>(propertyValue[9].AsDouble());
+            transformMatrix.m33 = static_cast<float>(propertyValue[10].AsDouble());
+            transformMatrix.m34 = static_cast<float>(propertyValue[11].AsDouble());
+            transformMatrix.m41 = static_cast<float>(propertyValue[12].AsDouble());
+            transformMatrix.m42 = static_cast<float>(propertyValue[13].AsDouble());
+            transformMatrix.m43 = static_cast<float>(propertyValue[14].AsDouble());
+            transformMatrix.m44 = static_cast<float>(propertyValue[15].AsDouble());
+
+            if (!element.IsLoaded()) {
+              element.Loaded([=](auto sender, auto &&) -> auto {
+                ApplyTransformMatrix(sender.as<xaml::UIElement>(), nodeToUpdate, transformMatrix);
+              });
+            } else {
+              ApplyTransformMatrix(element, nodeToUpdate, transformMatrix);
+            }
+          } else if (propertyValue.IsNull()) {
+            element.TransformMatrix(winrt::Windows::Foundation::Numerics::float4x4::identity());
+          }
+        } else {
+          cdebug << "[Dim down] " << propertyName << "\n";
+        }
+        break;
       }
+      case PropName::width: {
+        if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Double ||
+            propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Int64) {
+          double width = propertyValue.AsDouble();
+          if (width >= 0)
+            element.Width(width);
+          // else
+          // TODO report error
+        } else if (propertyValue.IsNull()) {
+          element.ClearValue(xaml::FrameworkElement::WidthProperty());
+        }
 
-    } else if (propertyName == "height") {
-      if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Double ||
-          propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Int64) {
-        double height = propertyValue.AsDouble();
-        if (height >= 0)
-          element.Height(height);
-        // else
-        // TODO report error
-      } else if (propertyValue.IsNull()) {
-        element.ClearValue(xaml::FrameworkElement::HeightProperty());
+        break;
       }
-    } else if (propertyName == "minWidth") {
-      if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Double ||
-          propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Int64) {
-        double minWidth = propertyValue.AsDouble();
-        if (minWidth >= 0)
-          element.MinWidth(minWidth);
-        // else
-        // TODO report error
-      } else if (propertyValue.IsNull()) {
-        element.ClearValue(xaml::FrameworkElement::MinWidthProperty());
+      case PropName::height: {
+        if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Double ||
+            propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Int64) {
+          double height = propertyValue.AsDouble();
+          if (height >= 0)
+            element.Height(height);
+          // else
+          // TODO report error
+        } else if (propertyValue.IsNull()) {
+          element.ClearValue(xaml::FrameworkElement::HeightProperty());
+        }
+        break;
       }
-    } else if (propertyName == "maxWidth") {
-      if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Double ||
-          propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Int64) {
-        double maxWidth = propertyValue.AsDouble();
-        if (maxWidth >= 0)
-          element.MaxWidth(maxWidth);
-        // else
-        // TODO report error
-      } else if (propertyValue.IsNull()) {
-        element.ClearValue(xaml::FrameworkElement::MaxWidthProperty());
+      case PropName::minWidth: {
+        if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Double ||
+            propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Int64) {
+          double minWidth = propertyValue.AsDouble();
+          if (minWidth >= 0)
+            element.MinWidth(minWidth);
+          // else
+          // TODO report error
+        } else if (propertyValue.IsNull()) {
+          element.ClearValue(xaml::FrameworkElement::MinWidthProperty());
+        }
+        break;
       }
+      case PropName::maxWidth: {
+        if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Double ||
+            propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Int64) {
+          double maxWidth = propertyValue.AsDouble();
+          if (maxWidth >= 0)
+            element.MaxWidth(maxWidth);
+          // else
+          // TODO report error
+        } else if (propertyValue.IsNull()) {
+          element.ClearValue(xaml::FrameworkElement::MaxWidthProperty());
+        }
 
-    } else if (propertyName == "minHeight") {
-      if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Double ||
-          propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Int64) {
-        double minHeight = propertyValue.AsDouble();
-        if (minHeight >= 0)
-          element.MinHeight(minHeight);
-        // else
-        // TODO report error
-      } else if (propertyValue.IsNull()) {
-        element.ClearValue(xaml::FrameworkElement::MinHeightProperty());
+        break;
       }
-    } else if (propertyName == "maxHeight") {
-      if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Double ||
-          propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Int64) {
-        double maxHeight = propertyValue.AsDouble();
-        if (maxHeight >= 0)
-          element.MaxHeight(maxHeight);
-        // else
-        // TODO report error
-      } else if (propertyValue.IsNull()) {
-        element.ClearValue(xaml::FrameworkElement::MaxHeightProperty());
+      case PropName::minHeight: {
+        if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Double ||
+            propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Int64) {
+          double minHeight = propertyValue.AsDouble();
+          if (minHeight >= 0)
+            element.MinHeight(minHeight);
+          // else
+          // TODO report error
+        } else if (propertyValue.IsNull()) {
+          element.ClearValue(xaml::FrameworkElement::MinHeightProperty());
+        }
+        break;
       }
+      case PropName::maxHeight: {
+        if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Double ||
+            propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Int64) {
+          double maxHeight = propertyValue.AsDouble();
+          if (maxHeight >= 0)
+            element.MaxHeight(maxHeight);
+          // else
+          // TODO report error
+        } else if (propertyValue.IsNull()) {
+          element.ClearValue(xaml::FrameworkElement::MaxHeightProperty());
+        }
 
-    } else if (propertyName == "accessibilityHint") {
-      if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::String) {
-        auto value = react::uwp::asHstring(propertyValue);
-        auto boxedValue = winrt::Windows::Foundation::PropertyValue::CreateString(value);
+        break;
+      }
+      case PropName::accessibilityHint: {
+        if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::String) {
+          auto value = react::uwp::asHstring(propertyValue);
+          auto boxedValue = winrt::Windows::Foundation::PropertyValue::CreateString(value);
 
-        element.SetValue(xaml::Automation::AutomationProperties::HelpTextProperty(), boxedValue);
-      } else if (propertyValue.IsNull()) {
-        element.ClearValue(xaml::Automation::AutomationProperties::HelpTextProperty());
+          element.SetValue(xaml::Automation::AutomationProperties::HelpTextProperty(), boxedValue);
+        } else if (propertyValue.IsNull()) {
+          element.ClearValue(xaml::Automation::AutomationProperties::HelpTextProperty());
+        }
+        break;
       }
-    } else if (propertyName == "accessibilityLabel") {
-      if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::String) {
-        auto value = react::uwp::asHstring(propertyValue);
-        auto boxedValue = winrt::Windows::Foundation::PropertyValue::CreateString(value);
-
-        element.SetValue(xaml::Automation::AutomationProperties::NameProperty(), boxedValue);
-      } else if (propertyValue.IsNull()) {
-        element.ClearValue(xaml::Automation::AutomationProperties::NameProperty());
+      case PropName::accessibilityLabel: {
+        if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::String) {
+          auto value = react::uwp::asHstring(propertyValue);
+          auto boxedValue = winrt::Windows::Foundation::PropertyValue::CreateString(value);
+
+          element.SetValue(xaml::Automation::AutomationProperties::NameProperty(), boxedValue);
+        } else if (propertyValue.IsNull()) {
+          element.ClearValue(xaml::Automation::AutomationProperties::NameProperty());
+        }
+        react::uwp::AnnounceLiveRegionChangedIfNeeded(element);
+        break;
       }
-      react::uwp::AnnounceLiveRegionChangedIfNeeded(element);
-    } else if (propertyName == "accessible") {
-      if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Boolean) {
-        if (!propertyValue.AsBoolean())
-          xaml::Automation::AutomationProperties::SetAccessibilityView(element, winrt::Peers::AccessibilityView::Raw);
+      case PropName::accessible: {
+        if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Boolean) {
+          if (!propertyValue.AsBoolean())
+            xaml::Automation::AutomationProperties::SetAccessibilityView(element, winrt::Peers::AccessibilityView::Raw);
+        }
+        break;
       }
-    } else if (propertyName == "accessibilityLiveRegion") {
-      if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::String) {
-        auto value = propertyValue.AsString();
+      case PropName::accessibilityLiveRegion: {
+        if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::String) {
+          auto value = propertyValue.AsString();
+
+          auto liveSetting = winrt::AutomationLiveSetting::Off;
 
-        auto liveSetting = winrt::AutomationLiveSetting::Off;
+          if (value == "polite") {
+            liveSetting = winrt::AutomationLiveSetting::Polite;
+          } else if (value == "assertive") {
+            liveSetting = winrt::AutomationLiveSetting::Assertive;
+          }
 
-        if (value == "polite") {
-          liveSetting = winrt::AutomationLiveSetting::Polite;
-        } else if (value == "assertive") {
-          liveSetting = winrt::AutomationLiveSetting::Assertive;
+          element.SetValue(
+              xaml::Automation::AutomationProperties::LiveSettingProperty(), winrt::box_value(liveSetting));
+        } else if (propertyValue.IsNull()) {
+          element.ClearValue(xaml::Automation::AutomationProperties::LiveSettingProperty());
         }
+        react::uwp::AnnounceLiveRegionChangedIfNeeded(element);
+        break;
+      }
+      case PropName::accessibilityPosInSet: {
+        if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Double ||
+            propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Int64) {
+          auto value = static_cast<int>(propertyValue.AsDouble());
+          auto boxedValue = winrt::Windows::Foundation::PropertyValue::CreateInt32(value);
 
-        element.SetValue(xaml::Automation::AutomationProperties::LiveSettingProperty(), winrt::box_value(liveSetting));
-      } else if (propertyValue.IsNull()) {
-        element.ClearValue(xaml::Automation::AutomationProperties::LiveSettingProperty());
+          element.SetValue(xaml::Automation::AutomationProperties::PositionInSetProperty(), boxedValue);
+        } else if (propertyValue.IsNull()) {
+          element.ClearValue(xaml::Automation::AutomationProperties::PositionInSetProperty());
+        }
+        break;
       }
-      react::uwp::AnnounceLiveRegionChangedIfNeeded(element);
-    } else if (propertyName == "accessibilityPosInSet") {
-      if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Double ||
-          propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Int64) {
-        auto value = static_cast<int>(propertyValue.AsDouble());
-        auto boxedValue = winrt::Windows::Foundation::PropertyValue::CreateInt32(value);
-
-        element.SetValue(xaml::Automation::AutomationProperties::PositionInSetProperty(), boxedValue);
-      } else if (propertyValue.IsNull()) {
-        element.ClearValue(xaml::Automation::AutomationProperties::PositionInSetProperty());
+      case PropName::accessibilitySetSize: {
+        if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Double ||
+            propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Int64) {
+          auto value = static_cast<int>(propertyValue.AsDouble());
+          auto boxedValue = winrt::Windows::Foundation::PropertyValue::CreateInt32(value);
+
+          element.SetValue(xaml::Automation::AutomationProperties::SizeOfSetProperty(), boxedValue);
+        } else if (propertyValue.IsNull()) {
+          element.ClearValue(xaml::Automation::AutomationProperties::SizeOfSetProperty());
+        }
+        break;
       }
-    } else if (propertyName == "accessibilitySetSize") {
-      if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Double ||
-          propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Int64) {
-        auto value = static_cast<int>(propertyValue.AsDouble());
-        auto boxedValue = winrt::Windows::Foundation::PropertyValue::CreateInt32(value);
-
-        element.SetValue(xaml::Automation::AutomationProperties::SizeOfSetProperty(), boxedValue);
-      } else if (propertyValue.IsNull()) {
-        element.ClearValue(xaml::Automation::AutomationProperties::SizeOfSetProperty());
+      case PropName::accessibilityRole: {
+        if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::String) {
+          const std::string &role = propertyValue.AsString();
+          if (role == "none")
+            DynamicAutomationProperties::SetAccessibilityRole(element, winrt::react::uwp::AccessibilityRoles::None);
+          else if (role == "button")
+            DynamicAutomationProperties::SetAccessibilityRole(element, winrt::react::uwp::AccessibilityRoles::Button);
+          else if (role == "link")
+            DynamicAutomationProperties::SetAccessibilityRole(element, winrt::react::uwp::AccessibilityRoles::Link);
+          else if (role == "search")
+            DynamicAutomationProperties::SetAccessibilityRole(element, winrt::react::uwp::AccessibilityRoles::Search);
+          else if (role == "image")
+            DynamicAutomationProperties::SetAccessibilityRole(element, winrt::react::uwp::AccessibilityRoles::Image);
+          else if (role == "keyboardkey")
+            DynamicAutomationProperties::SetAccessibilityRole(
+                element, winrt::react::uwp::AccessibilityRoles::KeyboardKey);
+          else if (role == "text")
+            DynamicAutomationProperties::SetAccessibilityRole(element, winrt::react::uwp::AccessibilityRoles::Text);
+          else if (role == "adjustable")
+            DynamicAutomationProperties::SetAccessibilityRole(
+                element, winrt::react::uwp::AccessibilityRoles::Adjustable);
+          else if (role == "imagebutton")
+            DynamicAutomationProperties::SetAccessibilityRole(
+                element, winrt::react::uwp::AccessibilityRoles::ImageButton);
+          else if (role == "header")
+            DynamicAutomationProperties::SetAccessibilityRole(element, winrt::react::uwp::AccessibilityRoles::Header);
+          else if (role == "summary")
+            DynamicAutomationProperties::SetAccessibilityRole(element, winrt::react::uwp::AccessibilityRoles::Summary);
+          else if (role == "alert")
+            DynamicAutomationProperties::SetAccessibilityRole(element, winrt::react::uwp::AccessibilityRoles::Alert);
+          else if (role == "checkbox")
+            DynamicAutomationProperties::SetAccessibilityRole(element, winrt::react::uwp::AccessibilityRoles::CheckBox);
+          else if (role == "combobox")
+            DynamicAutomationProperties::SetAccessibilityRole(element, winrt::react::uwp::AccessibilityRoles::ComboBox);
+          else if (role == "menu")
+            DynamicAutomationProperties::SetAccessibilityRole(element, winrt::react::uwp::AccessibilityRoles::Menu);
+          else if (role == "menubar")
+            DynamicAutomationProperties::SetAccessibilityRole(element, winrt::react::uwp::AccessibilityRoles::MenuBar);
+          else if (role == "menuitem")
+            DynamicAutomationProperties::SetAccessibilityRole(element, winrt::react::uwp::AccessibilityRoles::MenuItem);
+          else if (role == "progressbar")
+            DynamicAutomationProperties::SetAccessibilityRole(
+                element, winrt::react::uwp::AccessibilityRoles::ProgressBar);
+          else if (role == "radio")
+            DynamicAutomationProperties::SetAccessibilityRole(element, winrt::react::uwp::AccessibilityRoles::Radio);
+          else if (role == "radiogroup")
+            DynamicAutomationProperties::SetAccessibilityRole(
+                element, winrt::react::uwp::AccessibilityRoles::RadioGroup);
+          else if (role == "scrollbar")
+            DynamicAutomationProperties::SetAccessibilityRole(
+                element, winrt::react::uwp::AccessibilityRoles::ScrollBar);
+          else if (role == "spinbutton")
+            DynamicAutomationProperties::SetAccessibilityRole(
+                element, winrt::react::uwp::AccessibilityRoles::SpinButton);
+          else if (role == "switch")
+            DynamicAutomationProperties::SetAccessibilityRole(element, winrt::react::uwp::AccessibilityRoles::Switch);
+          else if (role == "tab")
+            DynamicAutomationProperties::SetAccessibilityRole(element, winrt::react::uwp::AccessibilityRoles::Tab);
+          else if (role == "tablist")
+            DynamicAutomationProperties::SetAccessibilityRole(element, winrt::react::uwp::AccessibilityRoles::TabList);
+          else if (role == "timer")
+            DynamicAutomationProperties::SetAccessibilityRole(element, winrt::react::uwp::AccessibilityRoles::Timer);
+          else if (role == "toolbar")
+            DynamicAutomationProperties::SetAccessibilityRole(element, winrt::react::uwp::AccessibilityRoles::ToolBar);
+          else if (role == "list")
+            DynamicAutomationProperties::SetAccessibilityRole(element, winrt::react::uwp::AccessibilityRoles::List);
+          else if (role == "listitem")
+            DynamicAutomationProperties::SetAccessibilityRole(element, winrt::react::uwp::AccessibilityRoles::ListItem);
+          else
+            DynamicAutomationProperties::SetAccessibilityRole(element, winrt::react::uwp::AccessibilityRoles::Unknown);
+        } else if (propertyValue.IsNull()) {
+          element.ClearValue(DynamicAutomationProperties::AccessibilityRoleProperty());
+        }
+        break;
       }
-    } else if (propertyName == "accessibilityRole") {
-      if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::String) {
-        const std::string &role = propertyValue.AsString();
-        if (role == "none")
-          DynamicAutomationProperties::SetAccessibilityRole(element, winrt::react::uwp::AccessibilityRoles::None);
-        else if (role == "button")
-          DynamicAutomationProperties::SetAccessibilityRole(element, winrt::react::uwp::AccessibilityRoles::Button);
-        else if (role == "link")
-          DynamicAutomationProperties::SetAccessibilityRole(element, winrt::react::uwp::AccessibilityRoles::Link);
-        else if (role == "search")
-          DynamicAutomationProperties::SetAccessibilityRole(element, winrt::react::uwp::AccessibilityRoles::Search);
-        else if (role == "image")
-          DynamicAutomationProperties::SetAccessibilityRole(element, winrt::react::uwp::AccessibilityRoles::Image);
-        else if (role == "keyboardkey")
-          DynamicAutomationProperties::SetAccessibilityRole(
-              element, winrt::react::uwp::AccessibilityRoles::KeyboardKey);
-        else if (role == "text")
-          DynamicAutomationProperties::SetAccessibilityRole(element, winrt::react::uwp::AccessibilityRoles::Text);
-        else if (role == "adjustable")
-          DynamicAutomationProperties::SetAccessibilityRole(element, winrt::react::uwp::AccessibilityRoles::Adjustable);
-        else if (role == "imagebutton")
-          DynamicAutomationProperties::SetAccessibilityRole(
-              element, winrt::react::uwp::AccessibilityRoles::ImageButton);
-        else if (role == "header")
-          DynamicAutomationProperties::SetAccessibilityRole(element, winrt::react::uwp::AccessibilityRoles::Header);
-        else if (role == "summary")
-          DynamicAutomationProperties::SetAccessibilityRole(element, winrt::react::uwp::AccessibilityRoles::Summary);
-        else if (role == "alert")
-          DynamicAutomationProperties::SetAccessibilityRole(element, winrt::react::uwp::AccessibilityRoles::Alert);
-        else if (role == "checkbox")
-          DynamicAutomationProperties::SetAccessibilityRole(element, winrt::react::uwp::AccessibilityRoles::CheckBox);
-        else if (role == "combobox")
-          DynamicAutomationProperties::SetAccessibilityRole(element, winrt::react::uwp::AccessibilityRoles::ComboBox);
-        else if (role == "menu")
-          DynamicAutomationProperties::SetAccessibilityRole(element, winrt::react::uwp::AccessibilityRoles::Menu);
-        else if (role == "menubar")
-          DynamicAutomationProperties::SetAccessibilityRole(element, winrt::react::uwp::AccessibilityRoles::MenuBar);
-        else if (role == "menuitem")
-          DynamicAutomationProperties::SetAccessibilityRole(element, winrt::react::uwp::AccessibilityRoles::MenuItem);
-        else if (role == "progressbar")
-          DynamicAutomationProperties::SetAccessibilityRole(
-              element, winrt::react::uwp::AccessibilityRoles::ProgressBar);
-        else if (role == "radio")
-          DynamicAutomationProperties::SetAccessibilityRole(element, winrt::react::uwp::AccessibilityRoles::Radio);
-        else if (role == "radiogroup")
-          DynamicAutomationProperties::SetAccessibilityRole(element, winrt::react::uwp::AccessibilityRoles::RadioGroup);
-        else if (role == "scrollbar")
-          DynamicAutomationProperties::SetAccessibilityRole(element, winrt::react::uwp::AccessibilityRoles::ScrollBar);
-        else if (role == "spinbutton")
-          DynamicAutomationProperties::SetAccessibilityRole(element, winrt::react::uwp::AccessibilityRoles::SpinButton);
-        else if (role == "switch")
-          DynamicAutomationProperties::SetAccessibilityRole(element, winrt::react::uwp::AccessibilityRoles::Switch);
-        else if (role == "tab")
-          DynamicAutomationProperties::SetAccessibilityRole(element, winrt::react::uwp::AccessibilityRoles::Tab);
-        else if (role == "tablist")
-          DynamicAutomationProperties::SetAccessibilityRole(element, winrt::react::uwp::AccessibilityRoles::TabList);
-        else if (role == "timer")
-          DynamicAutomationProperties::SetAccessibilityRole(element, winrt::react::uwp::AccessibilityRoles::Timer);
-        else if (role == "toolbar")
-          DynamicAutomationProperties::SetAccessibilityRole(element, winrt::react::uwp::AccessibilityRoles::ToolBar);
-        else if (role == "list")
-          DynamicAutomationProperties::SetAccessibilityRole(element, winrt::react::uwp::AccessibilityRoles::List);
-        else if (role == "listitem")
-          DynamicAutomationProperties::SetAccessibilityRole(element, winrt::react::uwp::AccessibilityRoles::ListItem);
-        else
-          DynamicAutomationProperties::SetAccessibilityRole(element, winrt::react::uwp::AccessibilityRoles::Unknown);
-      } else if (propertyValue.IsNull()) {
-        element.ClearValue(DynamicAutomationProperties::AccessibilityRoleProperty());
+      case PropName::accessibilityState: {
+        bool states[static_cast<int32_t>(winrt::react::uwp::AccessibilityStates::CountStates)] = {};
+
+        if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Object) {
+          for (const auto &pair : propertyValue.AsObject()) {
+            const std::string &innerName = pair.first;
+            const auto &innerValue = pair.second;
+
+            if (innerName == "selected")
+              states[static_cast<int32_t>(winrt::react::uwp::AccessibilityStates::Selected)] = innerValue.AsBoolean();
+            else if (innerName == "disabled")
+              states[static_cast<int32_t>(winrt::react::uwp::AccessibilityStates::Disabled)] = innerValue.AsBoolean();
+            else if (innerName == "checked") {
+              states[static_cast<int32_t>(winrt::react::uwp::AccessibilityStates::Checked)] =
+                  innerValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Boolean && innerValue.AsBoolean();
+              states[static_cast<int32_t>(winrt::react::uwp::AccessibilityStates::Unchecked)] =
+                  innerValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Boolean && !innerValue.AsBoolean();
+              // If the state is "mixed" we'll just set both Checked and Unchecked to false,
+              // then later in the IToggleProvider implementation it will return the Intermediate state
+              // due to both being set to false (see  DynamicAutomationPeer::ToggleState()).
+            } else if (innerName == "busy")
+              states[static_cast<int32_t>(winrt::react::uwp::AccessibilityStates::Busy)] =
+                  !innerValue.IsNull() && innerValue.AsBoolean();
+            else if (innerName == "expanded") {
+              states[static_cast<int32_t>(winrt::react::uwp::AccessibilityStates::Expanded)] =
+                  !innerValue.IsNull() && innerValue.AsBoolean();
+              states[static_cast<int32_t>(winrt::react::uwp::AccessibilityStates::Collapsed)] =
+                  innerValue.IsNull() || !innerValue.AsBoolean();
+            }
+          }
+        }
+
+        DynamicAutomationProperties::SetAccessibilityStateSelected(
+            element, states[static_cast<int32_t>(winrt::react::uwp::AccessibilityStates::Selected)]);
+        DynamicAutomationProperties::SetAccessibilityStateDisabled(
+            element, states[static_cast<int32_t>(winrt::react::uwp::AccessibilityStates::Disabled)]);
+        DynamicAutomationProperties::SetAccessibilityStateChecked(
+            element, states[static_cast<int32_t>(winrt::react::uwp::AccessibilityStates::Checked)]);
+        DynamicAutomationProperties::SetAccessibilityStateUnchecked(
+            element, states[static_cast<int32_t>(winrt::react::uwp::AccessibilityStates::Unchecked)]);
+        DynamicAutomationProperties::SetAccessibilityStateBusy(
+            element, states[static_cast<int32_t>(winrt::react::uwp::AccessibilityStates::Busy)]);
+        DynamicAutomationProperties::SetAccessibilityStateExpanded(
+            element, states[static_cast<int32_t>(winrt::react::uwp::AccessibilityStates::Expanded)]);
+        DynamicAutomationProperties::SetAccessibilityStateCollapsed(
+            element, states[static_cast<int32_t>(winrt::react::uwp::AccessibilityStates::Collapsed)]);
+        break;
       }
-    } else if (propertyName == "accessibilityState") {
-      bool states[static_cast<int32_t>(winrt::react::uwp::AccessibilityStates::CountStates)] = {};
-
-      if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Object) {
-        for (const auto &pair : propertyValue.AsObject()) {
-          const std::string &innerName = pair.first;
-          const auto &innerValue = pair.second;
-
-          if (innerName == "selected")
-            states[static_cast<int32_t>(winrt::react::uwp::AccessibilityStates::Selected)] = innerValue.AsBoolean();
-          else if (innerName == "disabled")
-            states[static_cast<int32_t>(winrt::react::uwp::AccessibilityStates::Disabled)] = innerValue.AsBoolean();
-          else if (innerName == "checked") {
-            states[static_cast<int32_t>(winrt::react::uwp::AccessibilityStates::Checked)] =
-                innerValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Boolean && innerValue.AsBoolean();
-            states[static_cast<int32_t>(winrt::react::uwp::AccessibilityStates::Unchecked)] =
-                innerValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Boolean && !innerValue.AsBoolean();
-            // If the state is "mixed" we'll just set both Checked and Unchecked to false,
-            // then later in the IToggleProvider implementation it will return the Intermediate state
-            // due to both being set to false (see  DynamicAutomationPeer::ToggleState()).
-          } else if (innerName == "busy")
-            states[static_cast<int32_t>(winrt::react::uwp::AccessibilityStates::Busy)] =
-                !innerValue.IsNull() && innerValue.AsBoolean();
-          else if (innerName == "expanded") {
-            states[static_cast<int32_t>(winrt::react::uwp::AccessibilityStates::Expanded)] =
-                !innerValue.IsNull() && innerValue.AsBoolean();
-            states[static_cast<int32_t>(winrt::react::uwp::AccessibilityStates::Collapsed)] =
-                innerValue.IsNull() || !innerValue.AsBoolean();
+      case PropName::accessibilityValue: {
+        if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Object) {
+          for (const auto &pair : propertyValue.AsObject()) {
+            const std::string &innerName = pair.first;
+            const auto &innerValue = pair.second;
+
+            if (innerName == "min" &&
+                (innerValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Double ||
+                 innerValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Int64)) {
+              DynamicAutomationProperties::SetAccessibilityValueMin(element, innerValue.AsDouble());
+            } else if (
+                innerName == "max" && innerValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Double ||
+                innerValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Int64) {
+              DynamicAutomationProperties::SetAccessibilityValueMax(element, innerValue.AsDouble());
+            } else if (
+                innerName == "now" && innerValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Double ||
+                innerValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Int64) {
+              DynamicAutomationProperties::SetAccessibilityValueNow(element, innerValue.AsDouble());
+            } else if (innerName == "text" && innerValue.Type() == winrt::Microsoft::ReactNative::JSValueType::String) {
+              auto value = react::uwp::asHstring(innerValue);
+              DynamicAutomationProperties::SetAccessibilityValueText(element, value);
+            }
           }
         }
+        break;
       }
+      case PropName::testID: {
+        if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::String) {
+          auto value = react::uwp::asHstring(propertyValue);
+          auto boxedValue = winrt::Windows::Foundation::PropertyValue::CreateString(value);
 
-      DynamicAutomationProperties::SetAccessibilityStateSelected(
-          element, states[static_cast<int32_t>(winrt::react::uwp::AccessibilityStates::Selected)]);
-      DynamicAutomationProperties::SetAccessibilityStateDisabled(
-          element, states[static_cast<int32_t>(winrt::react::uwp::AccessibilityStates::Disabled)]);
-      DynamicAutomationProperties::SetAccessibilityStateChecked(
-          element, states[static_cast<int32_t>(winrt::react::uwp::AccessibilityStates::Checked)]);
-      DynamicAutomationProperties::SetAccessibilityStateUnchecked(
-          element, states[static_cast<int32_t>(winrt::react::uwp::AccessibilityStates::Unchecked)]);
-      DynamicAutomationProperties::SetAccessibilityStateBusy(
-          element, states[static_cast<int32_t>(winrt::react::uwp::AccessibilityStates::Busy)]);
-      DynamicAutomationProperties::SetAccessibilityStateExpanded(
-          element, states[static_cast<int32_t>(winrt::react::uwp::AccessibilityStates::Expanded)]);
-      DynamicAutomationProperties::SetAccessibilityStateCollapsed(
-          element, states[static_cast<int32_t>(winrt::react::uwp::AccessibilityStates::Collapsed)]);
-    } else if (propertyName == "accessibilityValue") {
-      if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Object) {
-        for (const auto &pair : propertyValue.AsObject()) {
-          const std::string &innerName = pair.first;
-          const auto &innerValue = pair.second;
-
-          if (innerName == "min" &&
-              (innerValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Double ||
-               innerValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Int64)) {
-            DynamicAutomationProperties::SetAccessibilityValueMin(element, innerValue.AsDouble());
-          } else if (
-              innerName == "max" && innerValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Double ||
-              innerValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Int64) {
-            DynamicAutomationProperties::SetAccessibilityValueMax(element, innerValue.AsDouble());
-          } else if (
-              innerName == "now" && innerValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Double ||
-              innerValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Int64) {
-            DynamicAutomationProperties::SetAccessibilityValueNow(element, innerValue.AsDouble());
-          } else if (innerName == "text" && innerValue.Type() == winrt::Microsoft::ReactNative::JSValueType::String) {
-            auto value = react::uwp::asHstring(innerValue);
-            DynamicAutomationProperties::SetAccessibilityValueText(element, value);
-          }
+          element.SetValue(xaml::Automation::AutomationProperties::AutomationIdProperty(), boxedValue);
+        } else if (propertyValue.IsNull()) {
+          element.ClearValue(xaml::Automation::AutomationProperties::AutomationIdProperty());
+        }
+        break;
+      }
+      case PropName::tooltip: {
+        if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::String) {
+          winrt::ToolTipService::SetToolTip(element, winrt::box_value(react::uwp::asHstring(propertyValue)));
+        }
+        break;
+      }
+      case PropName::zIndex: {
+        if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Double ||
+            propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Int64) {
+          auto value = static_cast<int>(propertyValue.AsDouble());
+          auto boxedValue = winrt::Windows::Foundation::PropertyValue::CreateInt32(value);
+
+          element.SetValue(winrt::Canvas::ZIndexProperty(), boxedValue);
+        } else if (propertyValue.IsNull()) {
+          element.ClearValue(winrt::Canvas::ZIndexProperty());
         }
+        break;
       }
-    } else if (propertyName == "testID") {
-      if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::String) {
-        auto value = react::uwp::asHstring(propertyValue);
-        auto boxedValue = winrt::Windows::Foundation::PropertyValue::CreateString(value);
-
-        element.SetValue(xaml::Automation::AutomationProperties::AutomationIdProperty(), boxedValue);
-      } else if (propertyValue.IsNull()) {
-        element.ClearValue(xaml::Automation::AutomationProperties::AutomationIdProperty());
+      case PropName::direction:
+      case PropName::writingDirection: {
+        TryUpdateFlowDirection(element, propertyName, propertyValue);
+        break;
       }
-    } else if (propertyName == "tooltip") {
-      if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::String) {
-        winrt::ToolTipService::SetToolTip(element, winrt::box_value(react::uwp::asHstring(propertyValue)));
+      case PropName::accessibilityActions: {
+        auto value = json_type_traits<winrt::IVector<winrt::react::uwp::AccessibilityAction>>::parseJson(propertyValue);
+        DynamicAutomationProperties::SetAccessibilityActions(element, value);
+        break;
       }
-    } else if (propertyName == "zIndex") {
-      if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Double ||
-          propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Int64) {
-        auto value = static_cast<int>(propertyValue.AsDouble());
-        auto boxedValue = winrt::Windows::Foundation::PropertyValue::CreateInt32(value);
-
-        element.SetValue(winrt::Canvas::ZIndexProperty(), boxedValue);
-      } else if (propertyValue.IsNull()) {
-        element.ClearValue(winrt::Canvas::ZIndexProperty());
+      default: {
+        return false;
       }
-    } else if (TryUpdateFlowDirection(element, propertyName, propertyValue)) {
-    } else if (propertyName == "accessibilityActions") {
-      auto value = json_type_traits<winrt::IVector<winrt::react::uwp::AccessibilityAction>>::parseJson(propertyValue);
-      DynamicAutomationProperties::SetAccessibilityActions(element, value);
-    } else {
-      return Super::UpdateProperty(nodeToUpdate, propertyName, propertyValue);
     }
   }
   return true;
@@ -35,7 +35,14 @@ class REACTWINDOWS_EXPORT FrameworkElementViewManager : public ViewManagerBase {
       xaml::DependencyProperty oldViewDP,
       xaml::DependencyProperty newViewDP);
 
+  static const PropertyHandlers<FrameworkElementViewManager> &GetPropertyHandlers() noexcept;
+
  private:
+  bool UpdateFrameworkElementProperty(
+      ShadowNodeBase *nodeToUpdate,
+      PropName propName,
+      const std::string &propertyName,
+      const winrt::Microsoft::ReactNative::JSValue &propertyValue);
   void ApplyTransformMatrix(
       xaml::UIElement uielement,
       ShadowNodeBase *shadowNode,
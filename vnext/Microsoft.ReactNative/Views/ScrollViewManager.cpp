@@ -6,6 +6,7 @@
 #include <DynamicReader.h>
 #include <JSValueWriter.h>
 #include <JsiWriter.h>
+#include <Utils/PropertyNames.h>
 #include <Views/SIPEventHandler.h>
 #include <Views/ShadowNodeBase.h>
 #include "Impl/ScrollViewUWPImplementation.h"
@@ -141,94 +142,125 @@ void ScrollViewShadowNode::updateProperties(winrt::Microsoft::ReactNative::JSVal
     const std::string &propertyName = pair.first;
     const auto &propertyValue = pair.second;
 
-    if (propertyName == "horizontal") {
-      const auto [valid, horizontal] = getPropertyAndValidity(propertyValue, false);
-      if (valid) {
-        m_isHorizontal = horizontal;
-        react::uwp::ScrollViewUWPImplementation(scrollViewer).SetHorizontal(horizontal);
-        SetScrollMode(scrollViewer);
+    switch (GetPropName(propertyName)) {
+      case PropName::horizontal: {
+        const auto [valid, horizontal] = getPropertyAndValidity(propertyValue, false);
+        if (valid) {
+          m_isHorizontal = horizontal;
+          react::uwp::ScrollViewUWPImplementation(scrollViewer).SetHorizontal(horizontal);
+          SetScrollMode(scrollViewer);
+        }
+        break;
       }
-    }
-    if (propertyName == "scrollEnabled") {
-      const auto [valid, scrollEnabled] = getPropertyAndValidity(propertyValue, true);
-      if (valid) {
-        m_isScrollingEnabled = scrollEnabled;
-        SetScrollMode(scrollViewer);
+      case PropName::scrollEnabled: {
+        const auto [valid, scrollEnabled] = getPropertyAndValidity(propertyValue, true);
+        if (valid) {
+          m_isScrollingEnabled = scrollEnabled;
+          SetScrollMode(scrollViewer);
+        }
+        break;
       }
-    } else if (propertyName == "showsHorizontalScrollIndicator") {
-      const auto [valid, showsHorizontalScrollIndicator] = getPropertyAndValidity(propertyValue, true);
-      if (valid) {
-        scrollViewer.HorizontalScrollBarVisibility(
-            showsHorizontalScrollIndicator ? winrt::ScrollBarVisibility::Visible : winrt::ScrollBarVisibility::Hidden);
+      case PropName::showsHorizontalScrollIndicator: {
+        const auto [valid, showsHorizontalScrollIndicator] = getPropertyAndValidity(propertyValue, true);
+        if (valid) {
+          scrollViewer.HorizontalScrollBarVisibility(
+              showsHorizontalScrollIndicator ? winrt::ScrollBarVisibility::Visible
+                                             : winrt::ScrollBarVisibility::Hidden);
+        }
+        break;
       }
-    } else if (propertyName == "showsVerticalScrollIndicator") {
-      const auto [valid, showsVerticalScrollIndicator] = getPropertyAndValidity(propertyValue, true);
-      if (valid) {
-        scrollViewer.VerticalScrollBarVisibility(
-            showsVerticalScrollIndicator ? winrt::ScrollBarVisibility::Visible : winrt::ScrollBarVisibility::Hidden);
+      case PropName::showsVerticalScrollIndicator: {
+        const auto [valid, showsVerticalScrollIndicator] = getPropertyAndValidity(propertyValue, true);
+        if (valid) {
+          scrollViewer.VerticalScrollBarVisibility(
+              showsVerticalScrollIndicator ? winrt::ScrollBarVisibility::Visible : winrt::ScrollBarVisibility::Hidden);
+        }
+        break;
       }
-    } else if (propertyName == "minimumZoomScale") {
-      const auto [valid, minimumZoomScale] = getPropertyAndValidity(propertyValue, 1.0);
-      if (valid) {
-        scrollViewer.MinZoomFactor(static_cast<float>(minimumZoomScale));
-        UpdateZoomMode(scrollViewer);
+      case PropName::minimumZoomScale: {
+        const auto [valid, minimumZoomScale] = getPropertyAndValidity(propertyValue, 1.0);
+        if (valid) {
+          scrollViewer.MinZoomFactor(static_cast<float>(minimumZoomScale));
+          UpdateZoomMode(scrollViewer);
+        }
+        break;
       }
-    } else if (propertyName == "maximumZoomScale") {
-      const auto [valid, maximumZoomScale] = getPropertyAndValidity(propertyValue, 1.0);
-      if (valid) {
-        scrollViewer.MaxZoomFactor(static_cast<float>(maximumZoomScale));
-        UpdateZoomMode(scrollViewer);
+      case PropName::maximumZoomScale: {
+        const auto [valid, maximumZoomScale] = getPropertyAndValidity(propertyValue, 1.0);
+        if (valid) {
+          scrollViewer.MaxZoomFactor(static_cast<float>(maximumZoomScale));
+          UpdateZoomMode(scrollViewer);
+        }
+        break;
       }
-    } else if (propertyName == "zoomScale") {
-      const auto [valid, zoomScale] = getPropertyAndValidity(propertyValue, 1.0);
-      if (valid) {
-        m_zoomFactor = static_cast<float>(zoomScale);
-        m_changeViewAfterLoaded = !scrollViewer.ChangeView(nullptr, nullptr, m_zoomFactor);
+      case PropName::zoomScale: {
+        const auto [valid, zoomScale] = getPropertyAndValidity(propertyValue, 1.0);
+        if (valid) {
+          m_zoomFactor = static_cast<float>(zoomScale);
+          m_changeViewAfterLoaded = !scrollViewer.ChangeView(nullptr, nullptr, m_zoomFactor);
+        }
+        break;
       }
-    } else if (propertyName == "snapToInterval") {
-      const auto [valid, snapToInterval] = getPropertyAndValidity(propertyValue, 0.0);
-      if (valid) {
-        react::uwp::ScrollViewUWPImplementation(scrollViewer).SnapToInterval(static_cast<float>(snapToInterval));
+      case PropName::snapToInterval: {
+        const auto [valid, snapToInterval] = getPropertyAndValidity(propertyValue, 0.0);
+        if (valid) {
+          react::uwp::ScrollViewUWPImplementation(scrollViewer).SnapToInterval(static_cast<float>(snapToInterval));
+        }
+        break;
       }
-    } else if (propertyName == "snapToOffsets") {
-      if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Array) {
-        const auto snapToOffsets = winrt::single_threaded_vector<float>();
-        for (const auto &val : propertyValue.AsArray()) {
-          if (val.Type() == winrt::Microsoft::ReactNative::JSValueType::Double ||
-              val.Type() == winrt::Microsoft::ReactNative::JSValueType::Int64)
-            snapToOffsets.Append(val.AsSingle());
+      case PropName::snapToOffsets: {
+        if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Array) {
+          const auto snapToOffsets = winrt::single_threaded_vector<float>();
+          for (const auto &val : propertyValue.AsArray()) {
+            if (val.Type() == winrt::Microsoft::ReactNative::JSValueType::Double ||
+                val.Type() == winrt::Microsoft::ReactNative::JSValueType::Int64)
+              snapToOffsets.Append(val.AsSingle());
+          }
+          react::uwp::ScrollViewUWPImplementation(scrollViewer).SnapToOffsets(snapToOffsets.GetView());
         }
-        react::uwp::ScrollViewUWPImplementation(scrollViewer).SnapToOffsets(snapToOffsets.GetView());
+        break;
       }
-    } else if (propertyName == "snapToStart") {
-      const auto [valid, snaptoStart] = getPropertyAndValidity(propertyValue, true);
-      if (valid) {
-        react::uwp::ScrollViewUWPImplementation(scrollViewer).SnapToStart(snaptoStart);
+      case PropName::snapToStart: {
+        const auto [valid, snaptoStart] = getPropertyAndValidity(propertyValue, true);
+        if (valid) {
+          react::uwp::ScrollViewUWPImplementation(scrollViewer).SnapToStart(snaptoStart);
+        }
+        break;
       }
-    } else if (propertyName == "snapToEnd") {
-      const auto [valid, snapToEnd] = getPropertyAndValidity(propertyValue, true);
-      if (valid) {
-        react::uwp::ScrollViewUWPImplementation(scrollViewer).SnapToEnd(snapToEnd);
+      case PropName::snapToEnd: {
+        const auto [valid, snapToEnd] = getPropertyAndValidity(propertyValue, true);
+        if (valid) {
+          react::uwp::ScrollViewUWPImplementation(scrollViewer).SnapToEnd(snapToEnd);
+        }
+        break;
       }
-    } else if (propertyName == "keyboardDismissMode") {
-      m_dismissKeyboardOnDrag = false;
-      if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::String) {
-        m_dismissKeyboardOnDrag = (propertyValue.AsString() == "on-drag");
-        if (m_dismissKeyboardOnDrag) {
-          m_SIPEventHandler = std::make_unique<SIPEventHandler>(GetViewManager()->GetReactContext());
-          m_SIPEventHandler->AttachView(GetView(), false /*fireKeyboardEvents*/);
+      case PropName::keyboardDismissMode: {
+        m_dismissKeyboardOnDrag = false;
+        if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::String) {
+          m_dismissKeyboardOnDrag = (propertyValue.AsString() == "on-drag");
+          if (m_dismissKeyboardOnDrag) {
+            m_SIPEventHandler = std::make_unique<SIPEventHandler>(GetViewManager()->GetReactContext());
+            m_SIPEventHandler->AttachView(GetView(), false /*fireKeyboardEvents*/);
+          }
         }
+        break;
       }
-    } else if (propertyName == "snapToAlignment") {
-      const auto [valid, snapToAlignment] = getPropertyAndValidity(propertyValue, winrt::SnapPointsAlignment::Near);
-      if (valid) {
-        react::uwp::ScrollViewUWPImplementation(scrollViewer).SnapPointAlignment(snapToAlignment);
+      case PropName::snapToAlignment: {
+        const auto [valid, snapToAlignment] = getPropertyAndValidity(propertyValue, winrt::SnapPointsAlignment::Near);
+        if (valid) {
+          react::uwp::ScrollViewUWPImplementation(scrollViewer).SnapPointAlignment(snapToAlignment);
+        }
+        break;
       }
-    } else if (propertyName == "pagingEnabled") {
-      const auto [valid, pagingEnabled] = getPropertyAndValidity(propertyValue, false);
-      if (valid) {
-        react::uwp::ScrollViewUWPImplementation(scrollViewer).PagingEnabled(pagingEnabled);
+      case PropName::pagingEnabled: {
+        const auto [valid, pagingEnabled] = getPropertyAndValidity(propertyValue, false);
+        if (valid) {
+          react::uwp::ScrollViewUWPImplementation(scrollViewer).PagingEnabled(pagingEnabled);
+        }
+        break;
       }
+      default:
+        break;
     }
   }
 
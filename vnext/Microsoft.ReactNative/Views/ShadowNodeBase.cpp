@@ -50,7 +50,7 @@ bool ShadowNodeBase::NeedsForceLayout() {
 void ShadowNodeBase::dispatchCommand(
     const std::string &commandId,
     winrt::Microsoft::ReactNative::JSValueArray &&commandArgs) {
-  GetViewManager()->DispatchCommand(GetView(), commandId, std::move(commandArgs));
+  GetViewManager()->DispatchCommand(GetView(), commandId, commandArgs);
 }
 
 void ShadowNodeBase::removeAllChildren() {
@@ -16,6 +16,7 @@
 #include <Modules/PaperUIManagerModule.h>
 #include <ReactPropertyBag.h>
 #include <TestHook.h>
+#include <Utils/PropertyNames.h>
 #include <Views/ExpressionAnimationStore.h>
 #include <Views/ShadowNodeBase.h>
 
@@ -254,14 +255,30 @@ bool ViewManagerBase::UpdateProperty(
     ShadowNodeBase *nodeToUpdate,
     const std::string &propertyName,
     const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
-  if (propertyName == "onLayout") {
-    nodeToUpdate->m_onLayoutRegistered = !propertyValue.IsNull() && propertyValue.AsBoolean();
-  } else if (propertyName == "keyDownEvents") {
-    nodeToUpdate->UpdateHandledKeyboardEvents(propertyName, propertyValue);
-  } else if (propertyName == "keyUpEvents") {
-    nodeToUpdate->UpdateHandledKeyboardEvents(propertyName, propertyValue);
-  } else {
-    return false;
+  return DispatchProperty(*this, GetPropertyHandlers(), nodeToUpdate, propertyName, propertyValue);
+}
+
+/*static*/ const ViewManagerBase::PropertyHandlers<ViewManagerBase> &ViewManagerBase::GetPropertyHandlers() noexcept {
+  static const PropertyHandlers<ViewManagerBase> handlers{
+      &ViewManagerBase::UpdateBaseProperty, {PropName::onLayout, PropName::keyDownEvents, PropName::keyUpEvents}};
+  return handlers;
+}
+
+bool ViewManagerBase::UpdateBaseProperty(
+    ShadowNodeBase *nodeToUpdate,
+    PropName propName,
+    const std::string &propertyName,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  switch (propName) {
+    case PropName::onLayout:
+      nodeToUpdate->m_onLayoutRegistered = !propertyValue.IsNull() && propertyValue.AsBoolean();
+      break;
+    case PropName::keyDownEvents:
+    case PropName::keyUpEvents:
+      nodeToUpdate->UpdateHandledKeyboardEvents(propertyName, propertyValue);
+      break;
+    default:
+      return false;
   }
   return true;
 }
@@ -271,7 +288,7 @@ void ViewManagerBase::TransferProperties(const XamlView & /*oldView*/, const Xam
 void ViewManagerBase::DispatchCommand(
     const XamlView & /*viewToUpdate*/,
     const std::string & /*commandId*/,
-    winrt::Microsoft::ReactNative::JSValueArray &&commandArgs) {
+    const winrt::Microsoft::ReactNative::JSValueArray & /*commandArgs*/) {
   assert(false); // View did not handle its command
 }
 
@@ -5,6 +5,7 @@
 
 #include <React.h>
 #include <Shared/ReactWindowsAPI.h>
+#include <Utils/PropertyHandlerTable.h>
 #include <Views/ViewManager.h>
 #include <XamlView.h>
 #include <folly/dynamic.h>
@@ -64,7 +65,7 @@ class REACTWINDOWS_EXPORT ViewManagerBase : public IViewManager {
   virtual void DispatchCommand(
       const XamlView &viewToUpdate,
       const std::string &commandId,
-      winrt::Microsoft::ReactNative::JSValueArray &&commandArgs);
+      const winrt::Microsoft::ReactNative::JSValueArray &commandArgs);
 
   // Yoga Layout
   virtual void SetLayoutProps(
@@ -99,6 +100,45 @@ class REACTWINDOWS_EXPORT ViewManagerBase : public IViewManager {
       const winrt::Microsoft::ReactNative::JSValue &value);
   virtual void OnPropertiesUpdated(ShadowNodeBase *node) {}
 
+  // Updates a view property handled by a view manager class.
+  // It returns false if the property value is not supported.
+  // The handlers are member functions of the class that handles the properties. The table of a derived class
+  // converts the handlers of its base class to its own member function pointers without a cast.
+  template <class TViewManager>
+  using PropertyHandler = bool (TViewManager::*)(
+      ShadowNodeBase *nodeToUpdate,
+      PropName propName,
+      const std::string &propertyName,
+      const winrt::Microsoft::ReactNative::JSValue &propertyValue);
+  template <class TViewManager>
+  using PropertyHandlers = PropertyHandlerTable<PropertyHandler<TViewManager>>;
+
+  // Every view manager class that handles properties shadows this function with a table that includes
+  // the handlers of its base class, and dispatches its UpdateProperty through that table.
+  static const PropertyHandlers<ViewManagerBase> &GetPropertyHandlers() noexcept;
+
+  template <class TViewManager>
+  static bool DispatchProperty(
+      TViewManager &viewManager,
+      const PropertyHandlers<TViewManager> &handlers,
+      ShadowNodeBase *nodeToUpdate,
+      const std::string &propertyName,
+      const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+    PropName propName = GetPropName(propertyName);
+    if (PropertyHandler<TViewManager> handler = handlers.Find(propName)) {
+      return (viewManager.*handler)(nodeToUpdate, propName, propertyName, propertyValue);
+    }
+
+    return false;
+  }
+
+ private:
+  bool UpdateBaseProperty(
+      ShadowNodeBase *nodeToUpdate,
+      PropName propName,
+      const std::string &propertyName,
+      const winrt::Microsoft::ReactNative::JSValue &propertyValue);
+
  protected:
   Mso::CntPtr<const Mso::React::IReactContext> m_context;
 };
@@ -13,6 +13,7 @@
 #include <Modules/NativeUIManager.h>
 #include <Modules/PaperUIManagerModule.h>
 #include <Utils/AccessibilityUtils.h>
+#include <Utils/PropertyNames.h>
 #include <Utils/PropertyUtils.h>
 
 #include <INativeUIManager.h>
@@ -391,45 +392,126 @@ bool ViewViewManager::UpdateProperty(
     ShadowNodeBase *nodeToUpdate,
     const std::string &propertyName,
     const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  // Without a panel the properties are ignored, including the ones handled by the base classes.
+  if (static_cast<ViewShadowNode *>(nodeToUpdate)->GetViewPanel() == nullptr) {
+    return true;
+  }
+
+  return DispatchProperty(*this, GetPropertyHandlers(), nodeToUpdate, propertyName, propertyValue);
+}
+
+/*static*/ const ViewViewManager::PropertyHandlers<ViewViewManager> &ViewViewManager::GetPropertyHandlers() noexcept {
+  static const PropertyHandlers<ViewViewManager> handlers{
+      Super::GetPropertyHandlers(),
+      &ViewViewManager::UpdateViewProperty,
+      {PropName::backgroundColor,
+       PropName::borderColor,
+       PropName::borderLeftWidth,
+       PropName::borderTopWidth,
+       PropName::borderRightWidth,
+       PropName::borderBottomWidth,
+       PropName::borderStartWidth,
+       PropName::borderEndWidth,
+       PropName::borderWidth,
+       PropName::borderTopLeftRadius,
+       PropName::borderTopRightRadius,
+       PropName::borderTopStartRadius,
+       PropName::borderTopEndRadius,
+       PropName::borderBottomRightRadius,
+       PropName::borderBottomLeftRadius,
+       PropName::borderBottomStartRadius,
+       PropName::borderBottomEndRadius,
+       PropName::borderRadius,
+       PropName::onMouseEnter,
+       PropName::onMouseLeave,
+       PropName::onClick,
+       PropName::overflow,
+       PropName::pointerEvents,
+       PropName::focusable,
+       PropName::enableFocusRing,
+       PropName::tabIndex}};
+  return handlers;
+}
+
+bool ViewViewManager::UpdateViewProperty(
+    ShadowNodeBase *nodeToUpdate,
+    PropName propName,
+    const std::string &propertyName,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
   auto *pViewShadowNode = static_cast<ViewShadowNode *>(nodeToUpdate);
 
   auto pPanel = pViewShadowNode->GetViewPanel();
   bool ret = true;
   if (pPanel != nullptr) {
-    if (TryUpdateBackgroundBrush(pPanel, propertyName, propertyValue)) {
-    } else if (TryUpdateBorderProperties(nodeToUpdate, pPanel, propertyName, propertyValue)) {
-    } else if (TryUpdateCornerRadiusOnNode(nodeToUpdate, pPanel, propertyName, propertyValue)) {
-      UpdateCornerRadiusOnElement(nodeToUpdate, pPanel);
-    } else if (TryUpdateMouseEvents(nodeToUpdate, propertyName, propertyValue)) {
-    } else if (propertyName == "onClick") {
-      pViewShadowNode->OnClick(!propertyValue.IsNull() && propertyValue.AsBoolean());
-    } else if (propertyName == "overflow") {
-      if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::String) {
-        bool clipChildren = propertyValue.AsString() == "hidden";
-        pPanel.ClipChildren(clipChildren);
+    switch (propName) {
+      case PropName::backgroundColor:
+        TryUpdateBackgroundBrush(pPanel, propertyName, propertyValue);
+        break;
+      case PropName::borderColor:
+      case PropName::borderLeftWidth:
+      case PropName::borderTopWidth:
+      case PropName::borderRightWidth:
+      case PropName::borderBottomWidth:
+      case PropName::borderStartWidth:
+      case PropName::borderEndWidth:
+      case PropName::borderWidth:
+        TryUpdateBorderProperties(nodeToUpdate, pPanel, propertyName, propertyValue);
+        break;
+      case PropName::borderTopLeftRadius:
+      case PropName::borderTopRightRadius:
+      case PropName::borderTopStartRadius:
+      case PropName::borderTopEndRadius:
+      case PropName::borderBottomRightRadius:
+      case PropName::borderBottomLeftRadius:
+      case PropName::borderBottomStartRadius:
+      case PropName::borderBottomEndRadius:
+      case PropName::borderRadius:
+        TryUpdateCornerRadiusOnNode(nodeToUpdate, pPanel, propertyName, propertyValue);
+        UpdateCornerRadiusOnElement(nodeToUpdate, pPanel);
+        break;
+      case PropName::onMouseEnter:
+      case PropName::onMouseLeave:
+        TryUpdateMouseEvents(nodeToUpdate, propertyName, propertyValue);
+        break;
+      case PropName::onClick:
+        pViewShadowNode->OnClick(!propertyValue.IsNull() && propertyValue.AsBoolean());
+        break;
+      case PropName::overflow: {
+        if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::String) {
+          bool clipChildren = propertyValue.AsString() == "hidden";
+          pPanel.ClipChildren(clipChildren);
+        }
+        break;
       }
-    } else if (propertyName == "pointerEvents") {
-      if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::String) {
-        bool hitTestable = propertyValue.AsString() != "none";
-        pPanel.IsHitTestVisible(hitTestable);
+      case PropName::pointerEvents: {
+        if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::String) {
+          bool hitTestable = propertyValue.AsString() != "none";
+          pPanel.IsHitTestVisible(hitTestable);
+        }
+        break;
       }
-    } else if (propertyName == "focusable") {
-      if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Boolean)
-        pViewShadowNode->IsFocusable(propertyValue.AsBoolean());
-    } else if (propertyName == "enableFocusRing") {
-      if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Boolean)
-        pViewShadowNode->EnableFocusRing(propertyValue.AsBoolean());
-      else if (propertyValue.IsNull())
-        pViewShadowNode->EnableFocusRing(false);
-    } else if (propertyName == "tabIndex") {
-      auto tabIndex = propertyValue.AsInt64();
-      if (tabIndex == static_cast<int32_t>(tabIndex)) {
-        pViewShadowNode->TabIndex(static_cast<int32_t>(tabIndex));
-      } else if (propertyValue.IsNull()) {
-        pViewShadowNode->TabIndex(std::numeric_limits<std::int32_t>::max());
+      case PropName::focusable:
+        if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Boolean)
+          pViewShadowNode->IsFocusable(propertyValue.AsBoolean());
+        break;
+      case PropName::enableFocusRing:
+        if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Boolean)
+          pViewShadowNode->EnableFocusRing(propertyValue.AsBoolean());
+        else if (propertyValue.IsNull())
+          pViewShadowNode->EnableFocusRing(false);
+        break;
+      case PropName::tabIndex: {
+        auto tabIndex = propertyValue.AsInt64();
+        if (tabIndex == static_cast<int32_t>(tabIndex)) {
+          pViewShadowNode->TabIndex(static_cast<int32_t>(tabIndex));
+        } else if (propertyValue.IsNull()) {
+          pViewShadowNode->TabIndex(std::numeric_limits<std::int32_t>::max());
+        }
+        break;
       }
-    } else {
-      ret = Super::UpdateProperty(nodeToUpdate, propertyName, propertyValue);
+      default:
+        ret = false;
+        break;
     }
   }
 
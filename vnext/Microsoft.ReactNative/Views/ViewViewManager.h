@@ -44,7 +44,15 @@ class ViewViewManager : public FrameworkElementViewManager {
 
   xaml::Media::SolidColorBrush EnsureTransparentBrush();
 
+  static const PropertyHandlers<ViewViewManager> &GetPropertyHandlers() noexcept;
+
  private:
+  bool UpdateViewProperty(
+      ShadowNodeBase *nodeToUpdate,
+      PropName propName,
+      const std::string &propertyName,
+      const winrt::Microsoft::ReactNative::JSValue &propertyValue);
+
   xaml::Media::SolidColorBrush m_transparentBrush{nullptr};
 };
 
@@ -0,0 +1,695 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "dispatchQueue/dispatchQueue.h"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+#include "eventWaitHandle/eventWaitHandle.h"
+#include "memoryApi/smallBlockAllocator.h"
+#include "motifCpp/libletAwareMemLeakDetection.h"
+#include "motifCpp/testCheck.h"
+
+using namespace std::chrono_literals;
+
+namespace DispatchQueueTests {
+
+TEST_CLASS_EX (DispatchQueueTest, LibletAwareMemLeakDetection) {
+  // MemoryLeakDetectionHook::TrackPerTest m_trackLeakPerTest;
+
+  TEST_METHOD(ConcurrentQueue_InvokesAllTasks) {
+    constexpr int32_t taskCount{1000};
+    std::atomic<int32_t> invokeCount{0};
+    Mso::ManualResetEvent finished;
+    auto const &queue = Mso::DispatchQueue::ConcurrentQueue();
+    for (int32_t i = 0; i < taskCount; ++i) {
+      queue.Post([&]() noexcept {
+        if (++invokeCount == taskCount) {
+          finished.Set();
+        }
+      });
+    }
+
+    TestCheck(finished.WaitFor(10s));
+    TestCheckEqual(taskCount, invokeCount.load());
+  }
+
+  TEST_METHOD(MakeConcurrentQueue_RespectsMaxThreads) {
+    constexpr int32_t taskCount{100};
+    std::atomic<int32_t> invokeCount{0};
+    std::atomic<int32_t> runningCount{0};
+    std::atomic<int32_t> maxRunningCount{0};
+    Mso::ManualResetEvent finished;
+    auto queue = Mso::DispatchQueue::MakeConcurrentQueue(2);
+    TestCheck(!queue.IsSerial());
+    for (int32_t i = 0; i < taskCount; ++i) {
+      queue.Post([&]() noexcept {
+        int32_t running = ++runningCount;
+        int32_t maxRunning = maxRunningCount.load();
+        while (running > maxRunning && !maxRunningCount.compare_exchange_weak(maxRunning, running)) {
+        }
+
+        std::this_thread::sleep_for(1ms);
+        --runningCount;
+        if (++invokeCount == taskCount) {
+          finished.Set();
+        }
+      });
+    }
+
+    TestCheck(finished.WaitFor(10s));
+    TestCheck(maxRunningCount.load() <= 2);
+    queue.AwaitTermination();
+  }
+
+  TEST_METHOD(MakeConcurrentQueue_OneThreadIsSerial) {
+    constexpr int32_t taskCount{100};
+    std::vector<int32_t> order;
+    Mso::ManualResetEvent finished;
+    auto queue = Mso::DispatchQueue::MakeConcurrentQueue(1, 1ms);
+    TestCheck(queue.IsSerial());
+    for (int32_t i = 0; i < taskCount; ++i) {
+      queue.Post([&order, &finished, i]() noexcept {
+        order.push_back(i);
+        if (i == taskCount - 1) {
+          finished.Set();
+        }
+      });
+    }
+
+    TestCheck(finished.WaitFor(10s));
+    TestCheckEqual(static_cast<size_t>(taskCount), order.size());
+    for (int32_t i = 0; i < taskCount; ++i) {
+      TestCheckEqual(i, order[i]);
+    }
+
+    queue.AwaitTermination();
+  }
+
+  TEST_METHOD(MakeConcurrentQueue_PostFromTasksOfManyQueues) {
+    // Tasks posted from the thread pool threads go to the local worker deques and must be stolen by idle workers.
+    constexpr int32_t queueCount{8};
+    constexpr int32_t taskCount{200};
+    std::atomic<int32_t> invokeCount{0};
+    Mso::ManualResetEvent finished;
+    std::vector<Mso::DispatchQueue> queues;
+    for (int32_t i = 0; i < queueCount; ++i) {
+      queues.push_back(Mso::DispatchQueue::MakeConcurrentQueue(0, 1ms));
+    }
+
+    for (int32_t i = 0; i < queueCount; ++i) {
+      queues[i].Post([&, i]() noexcept {
+        for (int32_t j = 0; j < taskCount; ++j) {
+          queues[(i + j) % queueCount].Post([&]() noexcept {
+            if (++invokeCount == queueCount * taskCount) {
+              finished.Set();
+            }
+          });
+        }
+      });
+    }
+
+    TestCheck(finished.WaitFor(10s));
+    for (auto &queue : queues) {
+      queue.AwaitTermination();
+    }
+  }
+
+  TEST_METHOD(MakeConcurrentQueue_PostFromManyThreads) {
+    constexpr int32_t threadCount{8};
+    constexpr int32_t taskCount{10000};
+    std::atomic<int32_t> invokeCount{0};
+    Mso::ManualResetEvent finished;
+    auto queue = Mso::DispatchQueue::MakeConcurrentQueue(0);
+    std::vector<std::thread> threads;
+    for (int32_t i = 0; i < threadCount; ++i) {
+      threads.emplace_back([&]() noexcept {
+        for (int32_t j = 0; j < taskCount; ++j) {
+          queue.Post([&]() noexcept {
+            if (++invokeCount == threadCount * taskCount) {
+              finished.Set();
+            }
+          });
+        }
+      });
+    }
+
+    for (auto &thread : threads) {
+      thread.join();
+    }
+
+    TestCheck(finished.WaitFor(30s));
+    queue.AwaitTermination();
+  }
+
+  TEST_METHOD(LockFreePost_KeepsOrderPerThread) {
+    constexpr int32_t threadCount{4};
+    constexpr int32_t taskCount{10000};
+    std::vector<int32_t> lastValues(threadCount, -1);
+    std::atomic<bool> isOrdered{true};
+    std::atomic<int32_t> invokeCount{0};
+    Mso::ManualResetEvent finished;
+    auto queue = Mso::DispatchQueue::MakeLooperQueue(Mso::DispatchQueueOptions::LockFreePost);
+    std::vector<std::thread> threads;
+    for (int32_t i = 0; i < threadCount; ++i) {
+      threads.emplace_back([&, i]() noexcept {
+        for (int32_t j = 0; j < taskCount; ++j) {
+          queue.Post([&, i, j]() noexcept {
+            if (lastValues[i] + 1 != j) {
+              isOrdered = false;
+            }
+
+            lastValues[i] = j;
+            if (++invokeCount == threadCount * taskCount) {
+              finished.Set();
+            }
+          });
+        }
+      });
+    }
+
+    for (auto &thread : threads) {
+      thread.join();
+    }
+
+    TestCheck(finished.WaitFor(30s));
+    TestCheck(isOrdered.load());
+    queue.AwaitTermination();
+  }
+
+  TEST_METHOD(LockFreePost_SuspendAndResume) {
+    std::atomic<int32_t> invokeCount{0};
+    Mso::ManualResetEvent finished;
+    auto queue = Mso::DispatchQueue::MakeSerialQueue(Mso::DispatchQueueOptions::LockFreePost);
+    {
+      auto suspendGuard = queue.Suspend();
+      for (int32_t i = 0; i < 10; ++i) {
+        queue.Post([&]() noexcept {
+          if (++invokeCount == 10) {
+            finished.Set();
+          }
+        });
+      }
+
+      TestCheck(!finished.WaitFor(10ms));
+      TestCheckEqual(0, invokeCount.load());
+    }
+
+    TestCheck(finished.WaitFor(10s));
+    queue.AwaitTermination();
+  }
+
+  TEST_METHOD(LockFreePost_ShutdownCancelsTasks) {
+    std::atomic<int32_t> invokeCount{0};
+    std::atomic<int32_t> cancelCount{0};
+    auto queue = Mso::DispatchQueue::MakeSerialQueue(Mso::DispatchQueueOptions::LockFreePost);
+    auto suspendGuard = queue.Suspend();
+    for (int32_t i = 0; i < 10; ++i) {
+      queue.Post(Mso::MakeDispatchTask([&]() noexcept { ++invokeCount; }, [&]() noexcept { ++cancelCount; }));
+    }
+
+    queue.Shutdown(Mso::PendingTaskAction::Cancel);
+    queue.Post(Mso::MakeDispatchTask([&]() noexcept { ++invokeCount; }, [&]() noexcept { ++cancelCount; }));
+
+    TestCheckEqual(0, invokeCount.load());
+    TestCheckEqual(11, cancelCount.load());
+  }
+
+  TEST_METHOD(LockFreePost_ShutdownCompleteCancelsLaterTasks) {
+    // The tasks posted before the Shutdown(Complete) are invoked, and the tasks posted after it are canceled.
+    std::atomic<int32_t> invokeCount{0};
+    std::atomic<int32_t> cancelCount{0};
+    auto queue = Mso::DispatchQueue::MakeSerialQueue(Mso::DispatchQueueOptions::LockFreePost);
+    {
+      auto suspendGuard = queue.Suspend();
+      for (int32_t i = 0; i < 10; ++i) {
+        queue.Post(Mso::MakeDispatchTask([&]() noexcept { ++invokeCount; }, [&]() noexcept { ++cancelCount; }));
+      }
+
+      queue.Shutdown(Mso::PendingTaskAction::Complete);
+      queue.Post(Mso::MakeDispatchTask([&]() noexcept { ++invokeCount; }, [&]() noexcept { ++cancelCount; }));
+      TestCheckEqual(1, cancelCount.load());
+    }
+
+    queue.AwaitTermination();
+    TestCheckEqual(10, invokeCount.load());
+    TestCheckEqual(1, cancelCount.load());
+  }
+
+  TEST_METHOD(LockFreePost_AllocatesNodesFromSmallBlockPool) {
+    // After the warm-up round each posted task takes two blocks from the pool: one for the task and one for the
+    // lock-free queue node.
+    constexpr int32_t taskCount{1000};
+    auto queue = Mso::DispatchQueue::MakeSerialQueue(Mso::DispatchQueueOptions::LockFreePost);
+    auto postTasks = [&queue]() noexcept {
+      std::atomic<int32_t> invokeCount{0};
+      Mso::ManualResetEvent finished;
+      for (int32_t i = 0; i < taskCount; ++i) {
+        queue.Post([&invokeCount, &finished]() noexcept {
+          if (++invokeCount == taskCount) {
+            finished.Set();
+          }
+        });
+      }
+
+      TestCheck(finished.WaitFor(10s));
+    };
+
+    postTasks();
+    auto statsBefore = Mso::Memory::GetSmallBlockPoolStats();
+    postTasks();
+    auto statsAfter = Mso::Memory::GetSmallBlockPoolStats();
+    queue.AwaitTermination();
+    TestCheck(statsAfter.HitCount - statsBefore.HitCount >= 2 * static_cast<uint64_t>(taskCount));
+  }
+
+  TEST_METHOD(TaskBatching_CollectsTasksIntoOneBatch) {
+    // BeginTaskBatching used to dereference the moved task batch when the thread had no batch yet.
+    std::vector<int32_t> order;
+    Mso::ManualResetEvent finished;
+    auto queue = Mso::DispatchQueue::MakeSerialQueue(Mso::DispatchQueueOptions::LockFreePost);
+    Mso::IDispatchQueueService *queueService = *GetRawState(queue);
+    queueService->BeginTaskBatching();
+    TestCheck(queueService->HasTaskBatching());
+    for (int32_t i = 0; i < 3; ++i) {
+      queue.Post([&order, i]() noexcept { order.push_back(i); });
+    }
+
+    Mso::DispatchTask batch = queueService->EndTaskBatching();
+    TestCheck(!queueService->HasTaskBatching());
+    TestCheck(order.empty());
+
+    queue.Post(std::move(batch));
+    queue.Post([&]() noexcept { finished.Set(); });
+    TestCheck(finished.WaitFor(10s));
+    TestCheckEqual(3u, order.size());
+    for (int32_t i = 0; i < 3; ++i) {
+      TestCheckEqual(i, order[i]);
+    }
+
+    queue.AwaitTermination();
+  }
+
+  TEST_METHOD(TaskBatching_NestedBatchIsSeparate) {
+    // The nested BeginTaskBatching used to be ignored, and its tasks were added to the enclosing batch.
+    std::vector<int32_t> order;
+    Mso::ManualResetEvent finished;
+    auto queue = Mso::DispatchQueue::MakeSerialQueue();
+    Mso::IDispatchQueueService *queueService = *GetRawState(queue);
+    queueService->BeginTaskBatching();
+    queue.Post([&]() noexcept { order.push_back(1); });
+    queueService->BeginTaskBatching();
+    queue.Post([&]() noexcept { order.push_back(2); });
+    Mso::DispatchTask innerBatch = queueService->EndTaskBatching();
+    TestCheck(queueService->HasTaskBatching());
+    Mso::DispatchTask outerBatch = queueService->EndTaskBatching();
+    TestCheck(!queueService->HasTaskBatching());
+
+    queue.Post(std::move(innerBatch));
+    queue.Post(std::move(outerBatch));
+    queue.Post([&]() noexcept { finished.Set(); });
+    TestCheck(finished.WaitFor(10s));
+    TestCheckEqual(2u, order.size());
+    TestCheckEqual(2, order[0]);
+    TestCheckEqual(1, order[1]);
+    queue.AwaitTermination();
+  }
+
+  TEST_METHOD(PostWithPriority_InvokesHigherPriorityFirst) {
+    std::vector<Mso::DispatchTaskPriority> order;
+    Mso::ManualResetEvent finished;
+    auto queue = Mso::DispatchQueue::MakeSerialQueue();
+    {
+      auto suspendGuard = queue.Suspend();
+      queue.PostWithPriority(
+          [&]() noexcept { order.push_back(Mso::DispatchTaskPriority::Low); }, Mso::DispatchTaskPriority::Low);
+      queue.Post([&]() noexcept { order.push_back(Mso::DispatchTaskPriority::Normal); });
+      queue.PostWithPriority(
+          [&]() noexcept { order.push_back(Mso::DispatchTaskPriority::High); }, Mso::DispatchTaskPriority::High);
+      queue.PostWithPriority([&]() noexcept { finished.Set(); }, Mso::DispatchTaskPriority::Low);
+    }
+
+    TestCheck(finished.WaitFor(10s));
+    TestCheckEqual(3u, order.size());
+    TestCheck(order[0] == Mso::DispatchTaskPriority::High);
+    TestCheck(order[1] == Mso::DispatchTaskPriority::Normal);
+    TestCheck(order[2] == Mso::DispatchTaskPriority::Low);
+    queue.AwaitTermination();
+  }
+
+  TEST_METHOD(PostWithPriority_LowPriorityIsNotStarved) {
+    constexpr int32_t taskCount{100};
+    int32_t highInvokeCount{0};
+    int32_t highInvokeCountBeforeLow{-1};
+    Mso::ManualResetEvent finished;
+    auto queue = Mso::DispatchQueue::MakeSerialQueue(Mso::DispatchQueueOptions::LockFreePost);
+    {
+      auto suspendGuard = queue.Suspend();
+      queue.PostWithPriority(
+          [&]() noexcept { highInvokeCountBeforeLow = highInvokeCount; }, Mso::DispatchTaskPriority::Low);
+      for (int32_t i = 0; i < taskCount; ++i) {
+        queue.PostWithPriority([&]() noexcept { ++highInvokeCount; }, Mso::DispatchTaskPriority::High);
+      }
+
+      queue.PostWithPriority([&]() noexcept { finished.Set(); }, Mso::DispatchTaskPriority::Low);
+    }
+
+    TestCheck(finished.WaitFor(10s));
+    TestCheck(highInvokeCountBeforeLow >= 0);
+    TestCheck(highInvokeCountBeforeLow < taskCount);
+    queue.AwaitTermination();
+  }
+
+  TEST_METHOD(PostWithPriority_ShouldYieldForHigherPriorityTask) {
+    Mso::ManualResetEvent started;
+    Mso::ManualResetEvent highPosted;
+    Mso::ManualResetEvent finished;
+    Mso::TaskYieldReason yieldReason{Mso::TaskYieldReason::TimeExpired};
+    bool shouldYieldBefore{true};
+    bool shouldYieldAfter{false};
+    auto queue = Mso::DispatchQueue::MakeSerialQueue();
+    queue.PostWithPriority(
+        [&]() noexcept {
+          started.Set();
+          shouldYieldBefore = queue.ShouldYield();
+          highPosted.Wait();
+          shouldYieldAfter = queue.ShouldYield(&yieldReason);
+        },
+        Mso::DispatchTaskPriority::Low);
+
+    started.Wait();
+    queue.PostWithPriority([&]() noexcept { finished.Set(); }, Mso::DispatchTaskPriority::High);
+    highPosted.Set();
+
+    TestCheck(finished.WaitFor(10s));
+    TestCheck(!shouldYieldBefore);
+    TestCheck(shouldYieldAfter);
+    TestCheck(yieldReason == Mso::TaskYieldReason::HigherPriorityTask);
+    queue.AwaitTermination();
+  }
+
+  TEST_METHOD(PostAfter_InvokesTaskAfterDelay) {
+    Mso::ManualResetEvent finished;
+    std::chrono::steady_clock::time_point invokeTime;
+    auto queue = Mso::DispatchQueue::MakeSerialQueue();
+    auto startTime = std::chrono::steady_clock::now();
+    queue.PostAfter(50ms, [&]() noexcept {
+      invokeTime = std::chrono::steady_clock::now();
+      finished.Set();
+    });
+
+    TestCheck(finished.WaitFor(10s));
+    TestCheck(invokeTime - startTime >= 50ms);
+    queue.AwaitTermination();
+  }
+
+  TEST_METHOD(PostAfter_InvokesTasksInDueTimeOrder) {
+    // The delays cross the first timer wheel level to test timer cascading.
+    std::vector<int32_t> order;
+    Mso::ManualResetEvent finished;
+    auto queue = Mso::DispatchQueue::MakeLooperQueue();
+    queue.PostAfter(150ms, [&]() noexcept {
+      order.push_back(3);
+      finished.Set();
+    });
+    queue.PostAfter(10ms, [&]() noexcept { order.push_back(1); });
+    queue.PostAfter(70ms, [&]() noexcept { order.push_back(2); });
+
+    TestCheck(finished.WaitFor(10s));
+    TestCheckEqual(3u, order.size());
+    TestCheckEqual(1, order[0]);
+    TestCheckEqual(2, order[1]);
+    TestCheckEqual(3, order[2]);
+    queue.Shutdown(Mso::PendingTaskAction::Complete);
+    queue.AwaitTermination();
+  }
+
+  TEST_METHOD(PostAt_PastDueTimeInvokesTask) {
+    Mso::ManualResetEvent finished;
+    auto queue = Mso::DispatchQueue::MakeSerialQueue();
+    queue.PostAt(std::chrono::steady_clock::now() - 1s, [&]() noexcept { finished.Set(); });
+
+    TestCheck(finished.WaitFor(10s));
+    queue.AwaitTermination();
+  }
+
+  TEST_METHOD(PostAfter_CancelTimer) {
+    bool isInvoked{false};
+    bool isCanceled{false};
+    Mso::ManualResetEvent finished;
+    auto queue = Mso::DispatchQueue::MakeSerialQueue();
+    auto timer = queue.PostAfter(
+        1h,
+        Mso::MakeDispatchTask([&]() noexcept { isInvoked = true; }, [&]() noexcept { isCanceled = true; }));
+    queue.PostAfter(10ms, [&]() noexcept { finished.Set(); });
+
+    TestCheck(timer.Cancel());
+    TestCheck(!timer.Cancel());
+    TestCheck(isCanceled);
+    TestCheck(finished.WaitFor(10s));
+    TestCheck(!isInvoked);
+    queue.AwaitTermination();
+  }
+
+  TEST_METHOD(PostAfter_ManyTimers) {
+    constexpr int32_t timerCount{10000};
+    std::atomic<int32_t> invokeCount{0};
+    std::atomic<int32_t> earlyCount{0};
+    Mso::ManualResetEvent finished;
+    auto const &queue = Mso::DispatchQueue::ConcurrentQueue();
+    std::vector<Mso::DispatchTimer> timers;
+    timers.reserve(timerCount);
+    auto startTime = std::chrono::steady_clock::now();
+    for (int32_t i = 0; i < timerCount; ++i) {
+      auto dueTime = startTime + std::chrono::milliseconds(i % 100);
+      timers.push_back(queue.PostAt(dueTime, [&, dueTime]() noexcept {
+        if (std::chrono::steady_clock::now() < dueTime) {
+          ++earlyCount;
+        }
+
+        if (++invokeCount == timerCount / 2) {
+          finished.Set();
+        }
+      }));
+    }
+
+    // Cancel every other timer.
+    for (int32_t i = 0; i < timerCount; i += 2) {
+      timers[i].Cancel();
+    }
+
+    TestCheck(finished.WaitFor(10s));
+    TestCheckEqual(0, earlyCount.load());
+    TestCheckEqual(timerCount / 2, invokeCount.load());
+  }
+
+  TEST_METHOD(PostAfter_ShutdownQueueCancelsTask) {
+    Mso::ManualResetEvent canceled;
+    bool isInvoked{false};
+    auto queue = Mso::DispatchQueue::MakeSerialQueue();
+    queue.PostAfter(
+        10ms, Mso::MakeDispatchTask([&]() noexcept { isInvoked = true; }, [&]() noexcept { canceled.Set(); }));
+    queue.Shutdown(Mso::PendingTaskAction::Complete);
+
+    TestCheck(canceled.WaitFor(10s));
+    TestCheck(!isInvoked);
+    queue.AwaitTermination();
+  }
+
+  TEST_METHOD(Instrumentation_IsDisabledByDefault) {
+    auto queue = Mso::DispatchQueue::MakeSerialQueue();
+    Mso::DispatchQueueStats stats;
+    TestCheck(!queue.TryGetStats(stats));
+  }
+
+  TEST_METHOD(Instrumentation_CollectsTaskStats) {
+    constexpr int32_t taskCount{10};
+    Mso::ManualResetEvent finished;
+    auto queue = Mso::DispatchQueue::MakeSerialQueue();
+    queue.EnableInstrumentation("TestQueue");
+    queue.EnableInstrumentation("IgnoredName");
+    {
+      auto suspendGuard = queue.Suspend();
+      for (int32_t i = 0; i < taskCount; ++i) {
+        queue.Post([]() noexcept { std::this_thread::sleep_for(1ms); });
+      }
+
+      queue.Post([&]() noexcept {
+        auto innerSuspendGuard = queue.Suspend();
+        TestCheck(queue.ShouldYield());
+        finished.Set();
+      });
+    }
+
+    TestCheck(finished.WaitFor(10s));
+    queue.Shutdown(Mso::PendingTaskAction::Complete);
+    queue.AwaitTermination();
+
+    Mso::DispatchQueueStats stats;
+    TestCheck(queue.TryGetStats(stats));
+    TestCheck(stats.Name == "TestQueue");
+    TestCheckEqual(static_cast<uint64_t>(taskCount + 1), stats.PostedTaskCount);
+    TestCheckEqual(static_cast<uint64_t>(taskCount + 1), stats.InvokedTaskCount);
+    TestCheckEqual(0u, stats.CanceledTaskCount);
+    TestCheckEqual(1u, stats.YieldCount);
+    TestCheckEqual(static_cast<size_t>(taskCount + 1), stats.MaxQueueDepth);
+    TestCheckEqual(static_cast<uint64_t>(taskCount + 1), stats.WaitTime.Count);
+    TestCheckEqual(static_cast<uint64_t>(taskCount + 1), stats.ExecutionTime.Count);
+    TestCheck(stats.ExecutionTime.Total >= std::chrono::milliseconds(taskCount));
+    TestCheck(stats.ExecutionTime.Max >= 1ms);
+
+    uint64_t bucketTotal{0};
+    for (uint64_t bucket : stats.ExecutionTime.Buckets) {
+      bucketTotal += bucket;
+    }
+
+    TestCheckEqual(stats.ExecutionTime.Count, bucketTotal);
+  }
+
+  TEST_METHOD(Instrumentation_CountsCanceledTasks) {
+    Mso::ManualResetEvent canceled;
+    auto queue = Mso::DispatchQueue::MakeSerialQueue();
+    queue.EnableInstrumentation("CanceledTaskQueue");
+    queue.Shutdown(Mso::PendingTaskAction::Cancel);
+    queue.Post(Mso::MakeDispatchTask([]() noexcept {}, [&]() noexcept { canceled.Set(); }));
+
+    TestCheck(canceled.WaitFor(10s));
+    Mso::DispatchQueueStats stats;
+    TestCheck(queue.TryGetStats(stats));
+    TestCheckEqual(0u, stats.PostedTaskCount);
+    TestCheckEqual(1u, stats.CanceledTaskCount);
+    queue.AwaitTermination();
+  }
+
+  TEST_METHOD(Instrumentation_ReportsAllStatsAsJson) {
+    auto recorder = Mso::DispatchQueue::MakeStatsRecorder("Test\"Recorder");
+    recorder->RecordPost(3);
+    recorder->RecordInvoke(2ms, 5us);
+
+    bool isFound{false};
+    for (auto const &stats : Mso::DispatchQueue::GetAllStats()) {
+      if (stats.Name == "Test\"Recorder") {
+        isFound = true;
+        TestCheckEqual(1u, stats.PostedTaskCount);
+        TestCheckEqual(3u, stats.MaxQueueDepth);
+        TestCheckEqual(1u, stats.WaitTime.Buckets[11]); // 2000us is in [1024, 2048) range.
+        TestCheckEqual(1u, stats.ExecutionTime.Buckets[3]); // 5us is in [4, 8) range.
+      }
+    }
+
+    TestCheck(isFound);
+
+    std::string json = Mso::DispatchQueue::GetAllStatsAsJson();
+    TestCheck(json.front() == '[');
+    TestCheck(json.back() == ']');
+    TestCheck(json.find("\"name\":\"Test\\\"Recorder\"") != std::string::npos);
+    TestCheck(json.find("\"maxQueueDepth\":3") != std::string::npos);
+
+    recorder = nullptr;
+    for (auto const &stats : Mso::DispatchQueue::GetAllStats()) {
+      TestCheck(stats.Name != "Test\"Recorder");
+    }
+  }
+
+  TEST_METHOD(LockFreePost_ContentionBenchmark) {
+    // Compares posting throughput under contention between the locked two-buffer queue and the lock-free queue.
+    // The results are reported as test properties.
+    constexpr int32_t threadCount{8};
+    constexpr int32_t taskCount{20000};
+    auto measure = [](Mso::DispatchQueueOptions options) noexcept {
+      std::atomic<int32_t> invokeCount{0};
+      Mso::ManualResetEvent finished;
+      auto queue = Mso::DispatchQueue::MakeLooperQueue(options);
+      auto startTime = std::chrono::steady_clock::now();
+      std::vector<std::thread> threads;
+      for (int32_t i = 0; i < threadCount; ++i) {
+        threads.emplace_back([&]() noexcept {
+          for (int32_t j = 0; j < taskCount; ++j) {
+            queue.Post([&]() noexcept {
+              if (++invokeCount == threadCount * taskCount) {
+                finished.Set();
+              }
+            });
+          }
+        });
+      }
+
+      for (auto &thread : threads) {
+        thread.join();
+      }
+
+      TestCheck(finished.WaitFor(60s));
+      auto duration = std::chrono::steady_clock::now() - startTime;
+      queue.AwaitTermination();
+      return static_cast<int>(std::chrono::duration_cast<std::chrono::milliseconds>(duration).count());
+    };
+
+    ::testing::Test::RecordProperty("LockedPostMs", measure(Mso::DispatchQueueOptions::None));
+    ::testing::Test::RecordProperty("LockFreePostMs", measure(Mso::DispatchQueueOptions::LockFreePost));
+  }
+
+  TEST_METHOD(SmallBlockPool_PostAllocationBenchmark) {
+    // Tasks with small captures are allocated on the posting thread and freed on the queue thread.
+    // After the warm-up rounds their memory must be reused from the small block pool instead of the heap.
+    // The number of heap allocations per round is reported as a test property.
+    constexpr int32_t roundCount{10};
+    constexpr int32_t warmUpRoundCount{2};
+    constexpr int32_t taskCount{1000};
+    auto queue = Mso::DispatchQueue::MakeSerialQueue();
+    uint64_t heapAllocationCount{0};
+    for (int32_t round = 0; round < roundCount; ++round) {
+      std::atomic<int32_t> invokeCount{0};
+      Mso::ManualResetEvent finished;
+      auto statsBefore = Mso::Memory::GetSmallBlockPoolStats();
+      for (int32_t i = 0; i < taskCount; ++i) {
+        std::array<int32_t, 8> payload{1};
+        queue.Post([&invokeCount, &finished, payload]() noexcept {
+          if ((invokeCount += payload[0]) == taskCount) {
+            finished.Set();
+          }
+        });
+      }
+
+      TestCheck(finished.WaitFor(10s));
+      if (round >= warmUpRoundCount) {
+        auto statsAfter = Mso::Memory::GetSmallBlockPoolStats();
+        heapAllocationCount += statsAfter.HeapAllocationCount - statsBefore.HeapAllocationCount;
+      }
+    }
+
+    queue.AwaitTermination();
+    uint64_t measuredTaskCount = static_cast<uint64_t>(taskCount) * (roundCount - warmUpRoundCount);
+    TestCheck(heapAllocationCount * 10 < measuredTaskCount);
+    ::testing::Test::RecordProperty(
+        "HeapAllocationsPerRound", static_cast<int>(heapAllocationCount / (roundCount - warmUpRoundCount)));
+  }
+
+  TEST_METHOD(SmallBlockPool_ReturnsSurplusSlabsToHeap) {
+    // After a burst, the depot keeps a limited number of free blocks and returns the free slabs to the heap.
+    // The blocks use the biggest size class to avoid interference with other allocations.
+    constexpr int32_t blockCount{4096};
+    auto statsBefore = Mso::Memory::GetSmallBlockPoolStats();
+    std::thread([]() noexcept {
+      std::vector<void *> blocks;
+      blocks.reserve(blockCount);
+      for (int32_t i = 0; i < blockCount; ++i) {
+        blocks.push_back(Mso::Memory::AllocateSmallBlock(Mso::Memory::MaxSmallBlockSize));
+      }
+
+      for (void *block : blocks) {
+        Mso::Memory::FreeSmallBlock(block);
+      }
+    }).join();
+
+    auto statsAfter = Mso::Memory::GetSmallBlockPoolStats();
+    uint64_t heapAllocationCount = statsAfter.HeapAllocationCount - statsBefore.HeapAllocationCount;
+    uint64_t heapFreeCount = statsAfter.HeapFreeCount - statsBefore.HeapFreeCount;
+    TestCheck(heapAllocationCount > 0);
+    TestCheck(heapFreeCount * 4 >= heapAllocationCount * 3);
+  }
+};
+
+} // namespace DispatchQueueTests
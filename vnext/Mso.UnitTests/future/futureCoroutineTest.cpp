@@ -0,0 +1,156 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include "future/futureCoroutine.h"
+#include <optional>
+#include "future/futureWait.h"
+#include "motifCpp/libletAwareMemLeakDetection.h"
+#include "testCheck.h"
+
+namespace FutureTests {
+
+// Increments the counter when a coroutine frame is destroyed.
+struct FrameDestroyCounter {
+  FrameDestroyCounter(int &counter) noexcept : m_counter{counter} {}
+
+  ~FrameDestroyCounter() noexcept {
+    ++m_counter;
+  }
+
+ private:
+  int &m_counter;
+};
+
+static Mso::Future<int> AddAsync(Mso::Future<int> left, Mso::Future<int> right, int &destroyCount) noexcept {
+  FrameDestroyCounter counter{destroyCount};
+  int leftValue = co_await left;
+  int rightValue = co_await right;
+  co_return leftValue + rightValue;
+}
+
+static Mso::Future<int> AwaitPromiseAsync(Mso::Promise<int> const &promise, int &destroyCount) noexcept {
+  FrameDestroyCounter counter{destroyCount};
+  co_return co_await promise.AsFuture();
+}
+
+static Mso::Future<void> SwitchToQueueAsync(Mso::DispatchQueue queue, bool &isInQueue) noexcept {
+  co_await queue;
+  isInQueue = queue.HasThreadAccess();
+}
+
+TEST_CLASS_EX (FutureCoroutineTest, LibletAwareMemLeakDetection) {
+  // MemoryLeakDetectionHook::TrackPerTest m_trackLeakPerTest;
+
+  TEST_METHOD(FutureCoroutine_AwaitPendingFutures) {
+    int destroyCount{0};
+    Mso::Promise<int> left;
+    Mso::Promise<int> right;
+    Mso::Future<int> result = AddAsync(left.AsFuture(), right.AsFuture(), destroyCount);
+    TestCheckEqual(0, destroyCount);
+
+    left.SetValue(2);
+    right.SetValue(3);
+    TestCheckEqual(5, Mso::FutureWaitAndGetValue(result));
+    TestCheckEqual(1, destroyCount);
+  }
+
+  TEST_METHOD(FutureCoroutine_AwaitSucceededFutures) {
+    int destroyCount{0};
+    Mso::Future<int> result = AddAsync(Mso::MakeSucceededFuture(2), Mso::MakeSucceededFuture(3), destroyCount);
+    TestCheckEqual(5, Mso::FutureWaitAndGetValue(result));
+    TestCheckEqual(1, destroyCount);
+  }
+
+  TEST_METHOD(FutureCoroutine_AwaitFailedFutureStopsCoroutine) {
+    int destroyCount{0};
+    Mso::Promise<int> left;
+    Mso::Promise<int> right;
+    Mso::Future<int> result = AddAsync(left.AsFuture(), right.AsFuture(), destroyCount);
+
+    left.SetError(Mso::CancellationErrorProvider().MakeErrorCode(true));
+    TestCheck(Mso::CancellationErrorProvider().IsOwnedErrorCode(Mso::FutureWaitAndGetError(result)));
+    TestCheckEqual(1, destroyCount);
+  }
+
+  TEST_METHOD(FutureCoroutine_AwaitCompletedFailedFutureStopsCoroutine) {
+    int destroyCount{0};
+    Mso::Future<int> result = AddAsync(
+        Mso::MakeFailedFuture<int>(Mso::CancellationErrorProvider().MakeErrorCode(true)),
+        Mso::MakeSucceededFuture(3),
+        destroyCount);
+    TestCheck(Mso::CancellationErrorProvider().IsOwnedErrorCode(Mso::FutureWaitAndGetError(result)));
+    TestCheckEqual(1, destroyCount);
+  }
+
+  TEST_METHOD(FutureCoroutine_AwaitAbandonedPromiseCancelsCoroutine) {
+    // The coroutine does not keep the awaited future alive. Destroying the promise cancels the future and stops the
+    // coroutine the same way as it fails the Future<T>::Then continuations.
+    int destroyCount{0};
+    std::optional<Mso::Promise<int>> promise{std::in_place};
+    Mso::Future<int> result = AwaitPromiseAsync(*promise, destroyCount);
+    TestCheckEqual(0, destroyCount);
+
+    promise.reset();
+    TestCheck(Mso::CancellationErrorProvider().IsOwnedErrorCode(Mso::FutureWaitAndGetError(result)));
+    TestCheckEqual(1, destroyCount);
+  }
+
+  TEST_METHOD(FutureCoroutine_AwaitFutureCompletedInQueue) {
+    // The coroutine is resumed by the queue thread that completes the awaited future.
+    int destroyCount{0};
+    auto queue = Mso::DispatchQueue::MakeSerialQueue();
+    Mso::Future<int> result = AddAsync(
+        Mso::PostFuture(queue, []() noexcept { return 2; }),
+        Mso::PostFuture(queue, []() noexcept { return 3; }),
+        destroyCount);
+    TestCheckEqual(5, Mso::FutureWaitAndGetValue(result));
+  }
+
+  TEST_METHOD(FutureCoroutine_AwaitMaybeReturnsError) {
+    auto coroutine = [](Mso::Future<int> future) noexcept -> Mso::Future<bool> {
+      Mso::Maybe<int> result = co_await Mso::AwaitMaybe(std::move(future));
+      co_return result.IsError();
+    };
+
+    Mso::Promise<int> promise;
+    Mso::Future<bool> result = coroutine(promise.AsFuture());
+    promise.SetError(Mso::CancellationErrorProvider().MakeErrorCode(true));
+    TestCheck(Mso::FutureWaitAndGetValue(result));
+  }
+
+  TEST_METHOD(FutureCoroutine_AwaitQueue) {
+    bool isInQueue{false};
+    Mso::Future<void> result = SwitchToQueueAsync(Mso::DispatchQueue::MakeSerialQueue(), isInQueue);
+    TestCheck(Mso::FutureWaitIsSucceeded(result));
+    TestCheck(isInQueue);
+  }
+
+  TEST_METHOD(FutureCoroutine_AwaitShutdownQueueCancelsCoroutine) {
+    bool isInQueue{false};
+    auto queue = Mso::DispatchQueue::MakeSerialQueue();
+    queue.Shutdown(Mso::PendingTaskAction::Cancel);
+    Mso::Future<void> result = SwitchToQueueAsync(queue, isInQueue);
+    TestCheck(Mso::CancellationErrorProvider().IsOwnedErrorCode(Mso::FutureWaitAndGetError(result)));
+    TestCheck(!isInQueue);
+  }
+
+  TEST_METHOD(FutureCoroutine_CheckCancellation) {
+    auto coroutine = [](Mso::CancellationToken token, bool &isContinued) noexcept -> Mso::Future<void> {
+      co_await Mso::CheckCancellation(token);
+      isContinued = true;
+    };
+
+    Mso::CancellationTokenSource tokenSource;
+    bool isContinued{false};
+    TestCheck(Mso::FutureWaitIsSucceeded(coroutine(tokenSource.GetToken(), isContinued)));
+    TestCheck(isContinued);
+
+    tokenSource.Cancel();
+    isContinued = false;
+    Mso::Future<void> result = coroutine(tokenSource.GetToken(), isContinued);
+    TestCheck(Mso::CancellationErrorProvider().IsOwnedErrorCode(Mso::FutureWaitAndGetError(result)));
+    TestCheck(!isContinued);
+  }
+};
+
+} // namespace FutureTests
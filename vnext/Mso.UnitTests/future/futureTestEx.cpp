@@ -3,6 +3,7 @@
 
 #include "future/future.h"
 #include "future/futureWait.h"
+#include "memoryApi/smallBlockAllocator.h"
 #include "motifCpp/libletAwareMemLeakDetection.h"
 #include "testCheck.h"
 #include "testExecutor.h"
@@ -5162,6 +5163,34 @@ TEST_CLASS_EX (FutureTestEx, LibletAwareMemLeakDetection) {
     Mso::FutureWait(future);
     TestCheck(invoked);
   }
+
+  TEST_METHOD(Future_ThenChain_ReusesPooledStateMemory) {
+    // Future states are allocated from the small block pool. After the first chain warms up the pool,
+    // the next chains must reuse the freed blocks instead of allocating new slabs.
+    constexpr int32_t chainLength{100};
+    auto runChain = [&]() noexcept {
+      Mso::Promise<int> promise;
+      Mso::Future<int> future = promise.AsFuture();
+      for (int32_t i = 0; i < chainLength; ++i) {
+        future = future.Then(Mso::Executors::Inline{}, [](int value) noexcept { return value + 1; });
+      }
+
+      promise.SetValue(0);
+      TestCheckEqual(chainLength, Mso::FutureWaitAndGetValue(future));
+    };
+
+    runChain();
+    auto statsBefore = Mso::Memory::GetSmallBlockPoolStats();
+    for (int32_t i = 0; i < 10; ++i) {
+      runChain();
+    }
+
+    auto statsAfter = Mso::Memory::GetSmallBlockPoolStats();
+    uint64_t hitCount = statsAfter.HitCount - statsBefore.HitCount;
+    uint64_t missCount = statsAfter.MissCount - statsBefore.MissCount;
+    TestCheck(hitCount >= 10 * chainLength);
+    TestCheck(missCount * 100 < hitCount);
+  }
 };
 
 } // namespace FutureTests
@@ -5,9 +5,15 @@
 #ifndef MSO_DISPATCHQUEUE_DISPATCHQUEUE_H
 #define MSO_DISPATCHQUEUE_DISPATCHQUEUE_H
 
+#include <array>
+#include <chrono>
 #include <optional>
+#include <string>
+#include <string_view>
 #include <thread>
+#include <vector>
 #include "functional/functor.h"
+#include "memoryApi/smallBlockAllocator.h"
 #include "object/unknownObject.h"
 #include "span/span.h"
 #include "typeTraits/tags.h"
@@ -24,6 +30,7 @@ struct DispatchLocalValueGuard;
 struct DispatchQueue;
 struct DispatchSuspendGuard;
 struct DispatchTaskBatch;
+struct DispatchTimer;
 template <typename TInvoke, typename TCancel>
 struct DispatchTaskImpl;
 template <typename TInvoke>
@@ -33,12 +40,24 @@ struct IDispatchQueue;
 struct IDispatchQueueScheduler;
 struct IDispatchQueueService;
 struct IDispatchQueueStatic;
+struct IDispatchQueueStatsRecorder;
+struct IDispatchTimer;
 
 //! A reason for a task being invoked to yield.
 enum class TaskYieldReason {
   QueueShutdown,
   QueueSuspended,
   TimeExpired,
+  HigherPriorityTask,
+};
+
+//! Priority of a task posted to a dispatch queue.
+//! Tasks with higher priority are invoked before tasks with lower priority.
+//! To avoid starvation, the lower priority tasks are periodically invoked ahead of the higher priority tasks.
+enum class DispatchTaskPriority : uint32_t {
+  High = 0,
+  Normal = 1,
+  Low = 2,
 };
 
 //! What to do with pending tasks on shutdown.
@@ -47,6 +66,44 @@ enum class PendingTaskAction {
   Cancel,
 };
 
+//! Options for creating a dispatch queue.
+enum class DispatchQueueOptions : uint32_t {
+  None = 0x00,
+  LockFreePost = 0x01, // Post tasks into a lock-free multi-producer single-consumer queue instead of taking a lock.
+};
+
+constexpr inline DispatchQueueOptions operator|(DispatchQueueOptions left, DispatchQueueOptions right) noexcept {
+  return static_cast<DispatchQueueOptions>(static_cast<uint32_t>(left) | static_cast<uint32_t>(right));
+}
+
+constexpr inline bool IsSet(DispatchQueueOptions options, DispatchQueueOptions value) noexcept {
+  return (static_cast<uint32_t>(options) & static_cast<uint32_t>(value)) != 0;
+}
+
+//! Histogram of task durations collected by the dispatch queue instrumentation.
+//! The bucket i counts durations in the [2^(i-1), 2^i) microseconds range. The bucket 0 counts durations under 1us,
+//! and the last bucket also counts all longer durations.
+struct DispatchDurationHistogram {
+  constexpr static size_t BucketCount{32};
+
+  std::array<uint64_t, BucketCount> Buckets{};
+  uint64_t Count{0};
+  std::chrono::microseconds Total{0};
+  std::chrono::microseconds Max{0};
+};
+
+//! Task statistics collected by the dispatch queue instrumentation.
+struct DispatchQueueStats {
+  std::string Name;
+  uint64_t PostedTaskCount{0};
+  uint64_t InvokedTaskCount{0};
+  uint64_t CanceledTaskCount{0};
+  uint64_t YieldCount{0}; // Number of times the running tasks were asked to yield.
+  size_t MaxQueueDepth{0}; // The highest number of tasks waiting in the queue.
+  DispatchDurationHistogram WaitTime; // Time from posting a task to the start of its invocation.
+  DispatchDurationHistogram ExecutionTime; // Task invocation time.
+};
+
 //! Callback type to handle queue local values
 using SwapDispatchLocalValueCallback = void (*)(void **localValue, void **tlsValue) noexcept;
 
@@ -109,38 +166,74 @@ struct DispatchQueue {
   //! If no task running, then it returns a queue with an empty state.
   static DispatchQueue CurrentQueue() noexcept;
 
-  //! Get global concurrent queue which is a thin wrapper on top of platform specific thread pool. It is created on
-  //! demand.
+  //! Get global concurrent queue on top of the portable work stealing thread pool. It is created on demand and is
+  //! never destroyed.
   static DispatchQueue const &ConcurrentQueue() noexcept;
 
   //! Create new serial DispatchQueue on top of platform specific thread pool.
   static DispatchQueue MakeSerialQueue() noexcept;
 
+  //! Create new serial DispatchQueue with the provided options on top of platform specific thread pool.
+  static DispatchQueue MakeSerialQueue(DispatchQueueOptions options) noexcept;
+
   //! Create new looper DispatchQueue on top of new std::thread. It owns the thread until shutdown.
   static DispatchQueue MakeLooperQueue() noexcept;
 
+  //! Create new looper DispatchQueue with the provided options on top of new std::thread.
+  static DispatchQueue MakeLooperQueue(DispatchQueueOptions options) noexcept;
+
   //! Get a dispatch queue for the current UI thread. The result is null if the UI thread has no system UI thread
   //! dispatcher.
   static DispatchQueue GetCurrentUIThreadQueue() noexcept;
 
-  //! Create a concurrent queue on top of platform specific thread pool that uses up to maxThreads threads.
-  //! If maxThreads is zero, then it creates a concurrent queue that has a predefined limit on concurrently submitted
-  //! work items.
-  //! If maxThreads is one, then it calls MakeSerialQueue.
+  //! Create a concurrent queue on top of the portable work stealing thread pool that uses up to maxThreads threads.
+  //! If maxThreads is zero, then the queue may use all thread pool threads.
+  //! If maxThreads is one, then the queue runs its tasks serially.
   //! If maxThreads is two or more, then it creates a concurrent queue with the maxThreads limit for concurrently
   //! running tasks.
+  //! The queue uses the default time slice.
   static DispatchQueue MakeConcurrentQueue(uint32_t maxThreads) noexcept;
 
+  //! Create a concurrent queue on top of the portable work stealing thread pool that uses up to maxThreads threads.
+  //! If maxThreads is zero, then the queue may use all thread pool threads. The thread pool has one thread per core.
+  //! The timeSlice defines how long a thread pool thread invokes queue tasks before yielding to other queues.
+  static DispatchQueue MakeConcurrentQueue(uint32_t maxThreads, std::chrono::milliseconds timeSlice) noexcept;
+
   //! Create a dispatch queue on top of custom IDispatchQueueScheduler.
   //! The IDispatchQueueScheduler defines how the dispatch queue items are handled.
   static DispatchQueue MakeCustomQueue(Mso::CntPtr<IDispatchQueueScheduler> &&scheduler) noexcept;
 
+  //! Create a dispatch queue with the provided options on top of custom IDispatchQueueScheduler.
+  static DispatchQueue MakeCustomQueue(
+      Mso::CntPtr<IDispatchQueueScheduler> &&scheduler,
+      DispatchQueueOptions options) noexcept;
+
+  //! Create a stats recorder for a custom task queue. It reports the statistics together with instrumented queues.
+  static Mso::CntPtr<IDispatchQueueStatsRecorder> MakeStatsRecorder(std::string_view name) noexcept;
+
+  //! Get the task statistics of all instrumented queues and stats recorders.
+  static std::vector<DispatchQueueStats> GetAllStats() noexcept;
+
+  //! Get the task statistics of all instrumented queues and stats recorders as a JSON array.
+  static std::string GetAllStatsAsJson() noexcept;
+
   //! True if state is not empty.
   explicit operator bool() const noexcept;
 
   //! Post the task to the end of the queue for asynchronous invocation.
   void Post(DispatchTask &&task) const noexcept;
 
+  //! Post the task to the end of the queue lane with the provided priority for asynchronous invocation.
+  void PostWithPriority(DispatchTask &&task, DispatchTaskPriority priority) const noexcept;
+
+  //! Post the task to the end of the queue after the delay.
+  //! The returned DispatchTimer can cancel the task before it is posted to the queue.
+  DispatchTimer PostAfter(std::chrono::steady_clock::duration delay, DispatchTask &&task) const noexcept;
+
+  //! Post the task to the end of the queue at the due time. The task is posted immediately if the due time is passed.
+  //! The returned DispatchTimer can cancel the task before it is posted to the queue.
+  DispatchTimer PostAt(std::chrono::steady_clock::time_point dueTime, DispatchTask &&task) const noexcept;
+
   //! Invoke the task immediately if the queue uses the current thread. Otherwise, post it.
   //! The immediate execution ignores the suspend or shutdown states.
   void InvokeElsePost(DispatchTask &&task) const noexcept;
@@ -165,6 +258,14 @@ struct DispatchQueue {
   //! always returns true and the long running task will never make any progress.
   bool ShouldYield(TaskYieldReason *yieldReason = nullptr) const noexcept;
 
+  //! Start collecting task statistics for the queue under the provided name.
+  //! Use stable names to find the queue statistics across runs. The instrumentation cannot be disabled, and
+  //! only the first call sets the name.
+  void EnableInstrumentation(std::string_view name) const noexcept;
+
+  //! Get the task statistics collected for the queue. It returns false if the instrumentation is not enabled.
+  bool TryGetStats(/*out*/ DispatchQueueStats &stats) const noexcept;
+
   //! Start task batching on the current thread for this queue.
   //! All asynchronous task posted to the queue are going to be added to the returned DispatchTaskBatch
   //! until the DispatchTaskBatch is posted or canceled.
@@ -280,6 +381,30 @@ struct DispatchTaskBatch {
   Mso::CntPtr<IDispatchQueueService> m_state;
 };
 
+//! A handle to a task posted to a dispatch queue with a delay.
+//! It can cancel the task before the task is posted to the queue. Releasing the handle does not cancel the task.
+//! DispatchTimer is just a shared pointer to internal state and has size of a pointer. It is OK to copy and move.
+struct DispatchTimer {
+  //! Create empty DispatchTimer.
+  DispatchTimer(std::nullptr_t = nullptr) noexcept;
+
+  //! Create new DispatchTimer with provided state.
+  DispatchTimer(Mso::CntPtr<IDispatchTimer> &&state) noexcept;
+
+  //! True if state is not empty.
+  explicit operator bool() const noexcept;
+
+  //! Cancel the task if it is not posted to the queue yet. It returns true if the task is canceled.
+  bool Cancel() const noexcept;
+
+  //! A 'back-door' to get pointer to the state pointer. I.e. IDispatchTimer**.
+  template <typename TObject>
+  friend auto GetRawState(TObject &&obj) noexcept;
+
+ private:
+  Mso::CntPtr<IDispatchTimer> m_state;
+};
+
 //! A dispatch queue task. The task can be either invoked or canceled.
 MSO_GUID(ICancellationListener, "ec0f1ee4-b72d-4f50-8ba2-3131aeeb3663")
 struct ICancellationListener : IUnknown {
@@ -294,6 +419,34 @@ struct IDispatchQueue : IUnknown {
   virtual void Post(DispatchTask &&task) noexcept = 0;
 };
 
+//! A task waiting in the timer wheel to be posted to a dispatch queue.
+MSO_GUID(IDispatchTimer, "ed592491-efc1-4ef7-bf88-9b9cd91f61d1")
+struct IDispatchTimer : IUnknown {
+  //! Remove the task from the timer wheel and cancel it. It returns false if the task is already posted or canceled.
+  virtual bool Cancel() noexcept = 0;
+};
+
+//! Collects task statistics for the dispatch queue instrumentation.
+MSO_GUID(IDispatchQueueStatsRecorder, "4b8b2f1e-6f44-4d0a-9a3e-3b5d2c8e71a6")
+struct IDispatchQueueStatsRecorder : IUnknown {
+  //! Record a posted task and the number of tasks waiting in the queue after posting it.
+  virtual void RecordPost(size_t queueDepth) noexcept = 0;
+
+  //! Record an invoked task.
+  virtual void RecordInvoke(
+      std::chrono::steady_clock::duration waitTime,
+      std::chrono::steady_clock::duration executionTime) noexcept = 0;
+
+  //! Record a canceled task.
+  virtual void RecordCancel() noexcept = 0;
+
+  //! Record a request for a running task to yield.
+  virtual void RecordYield() noexcept = 0;
+
+  //! Get a snapshot of the collected statistics.
+  virtual DispatchQueueStats GetStats() noexcept = 0;
+};
+
 //! Handles dispatch queue task execution on top of platform-specific scheduler.
 //! A IDispatchQueueScheduler typically has a weak pointer to the IDispatchQueueService and
 //! invokes tasks by calling IDispatchQueue's InvokeOneTask(), InvokeAllTasks(), or InvokeTasksFor() methods.
@@ -324,6 +477,15 @@ struct IDispatchQueueService : IUnknown {
   //! Add task to the end of asynchronous queue for invocation.
   virtual void Post(DispatchTask &&task) noexcept = 0;
 
+  //! Add task to the end of asynchronous queue lane with the provided priority for invocation.
+  virtual void PostWithPriority(DispatchTask &&task, DispatchTaskPriority priority) noexcept = 0;
+
+  //! Add task to the end of asynchronous queue at the due time.
+  //! The task waits in the timer wheel shared by all queues until it is due.
+  virtual Mso::CntPtr<IDispatchTimer> PostAt(
+      std::chrono::steady_clock::time_point dueTime,
+      DispatchTask &&task) noexcept = 0;
+
   //! Invoke the task immediately if the queue uses the current thread. Otherwise, post it.
   //! The immediate execution ignores the suspend or shutdown states.
   virtual void InvokeElsePost(DispatchTask &&task) noexcept = 0;
@@ -344,10 +506,17 @@ struct IDispatchQueueService : IUnknown {
 
   //! Check if a long running task should yield.
   //! If provided yieldReason is not null, then it is assigned with a reason why the task is asked to yield.
+  //! It returns true for a task when a task with higher priority is waiting in the queue.
   //! ShouldYield must not be checked at the start of task invocation because trivial implementation of ShouldYield
   //! always returns true and the long running task will never make any progress.
   virtual bool ShouldYield(TaskYieldReason *yieldReason) noexcept = 0;
 
+  //! Start collecting task statistics under the provided name. Only the first call has effect.
+  virtual void EnableInstrumentation(std::string_view name) noexcept = 0;
+
+  //! Get the task statistics collected for the queue. It returns false if the instrumentation is not enabled.
+  virtual bool TryGetStats(/*out*/ DispatchQueueStats &stats) noexcept = 0;
+
   //! Start collecting all tasks posted to this queue from the current thread into a new batched task.
   virtual void BeginTaskBatching() noexcept = 0;
 
@@ -409,37 +578,69 @@ struct IDispatchQueueStatic : IUnknown {
   //! If no task running, then it returns a queue with an empty state.
   virtual DispatchQueue CurrentQueue() noexcept = 0;
 
-  //! Get global concurrent queue which is a thin wrapper on top of platform specific thread pool. It is created on
-  //! demand.
+  //! Get global concurrent queue on top of the portable work stealing thread pool. It is created on demand and is
+  //! never destroyed.
   virtual DispatchQueue const &ConcurrentQueue() noexcept = 0;
 
   //! Create new serial DispatchQueue on top of platform specific thread pool.
   virtual DispatchQueue MakeSerialQueue() noexcept = 0;
 
+  //! Create new serial DispatchQueue with the provided options on top of platform specific thread pool.
+  virtual DispatchQueue MakeSerialQueue(DispatchQueueOptions options) noexcept = 0;
+
   //! Create new looper DispatchQueue on top of new std::thread. It owns the thread until shutdown.
   virtual DispatchQueue MakeLooperQueue() noexcept = 0;
 
+  //! Create new looper DispatchQueue with the provided options on top of new std::thread.
+  virtual DispatchQueue MakeLooperQueue(DispatchQueueOptions options) noexcept = 0;
+
   //! Get a dispatch queue for the current UI thread. The result is null if the UI thread has no system UI thread
   //! dispatcher.
   virtual DispatchQueue GetCurrentUIThreadQueue() noexcept = 0;
 
-  //! Create a concurrent queue on top of platform specific thread pool that uses up to maxThreads threads.
-  //! If maxThreads is zero, then it creates a concurrent queue that has a predefined limit on concurrently submitted
-  //! work items.
-  //! If maxThreads is one, then it calls MakeSerialQueue.
+  //! Create a concurrent queue on top of the portable work stealing thread pool that uses up to maxThreads threads.
+  //! If maxThreads is zero, then the queue may use all thread pool threads.
+  //! If maxThreads is one, then the queue runs its tasks serially.
   //! If maxThreads is two or more, then it creates a concurrent queue with the maxThreads limit for concurrently
   //! running tasks.
+  //! The queue uses the default time slice.
   virtual DispatchQueue MakeConcurrentQueue(uint32_t maxThreads) noexcept = 0;
 
+  //! Create a concurrent queue on top of the portable work stealing thread pool that uses up to maxThreads threads.
+  //! If maxThreads is zero, then the queue may use all thread pool threads. The thread pool has one thread per core.
+  //! The timeSlice defines how long a thread pool thread invokes queue tasks before yielding to other queues.
+  virtual DispatchQueue MakeConcurrentQueue(uint32_t maxThreads, std::chrono::milliseconds timeSlice) noexcept = 0;
+
   //! Create a dispatch queue on top of custom IDispatchQueueScheduler.
   //! The IDispatchQueueScheduler defines how the dispatch queue items are handled.
   virtual DispatchQueue MakeCustomQueue(Mso::CntPtr<IDispatchQueueScheduler> &&scheduler) noexcept = 0;
+
+  //! Create a dispatch queue with the provided options on top of custom IDispatchQueueScheduler.
+  virtual DispatchQueue MakeCustomQueue(
+      Mso::CntPtr<IDispatchQueueScheduler> &&scheduler,
+      DispatchQueueOptions options) noexcept = 0;
+
+  //! Create a stats recorder for a custom task queue. It reports the statistics together with instrumented queues.
+  virtual Mso::CntPtr<IDispatchQueueStatsRecorder> MakeStatsRecorder(std::string_view name) noexcept = 0;
+
+  //! Get the task statistics of all instrumented queues and stats recorders.
+  virtual std::vector<DispatchQueueStats> GetAllStats() noexcept = 0;
+
+  //! Get the task statistics of all instrumented queues and stats recorders as a JSON array.
+  virtual std::string GetAllStatsAsJson() noexcept = 0;
 };
 
+//! Ref count policy for the dispatch task implementations.
+//! Tasks are allocated from the small block pool to avoid heap allocations for each posted task.
+using DispatchTaskRefCountPolicy = Mso::SimpleRefCountPolicy<Mso::DefaultRefCountedDeleter, Mso::SmallBlockAllocator>;
+
 //! DispatchTask implementation based on invoke and cancel function objects.
 template <typename TInvoke, typename TOnCancel>
 struct DispatchTaskImpl final
-    : Mso::UnknownObject<Mso::QueryCastHidden<Mso::IVoidFunctor>, Mso::ICancellationListener> {
+    : Mso::UnknownObject<
+          DispatchTaskRefCountPolicy,
+          Mso::QueryCastHidden<Mso::IVoidFunctor>,
+          Mso::ICancellationListener> {
   template <typename TInvokeArg, typename TOnCancelArg>
   DispatchTaskImpl(TInvokeArg &&invoke, TOnCancelArg &&onCancel) noexcept;
   ~DispatchTaskImpl() noexcept override;
@@ -456,7 +657,10 @@ struct DispatchTaskImpl final
 //! Dispatch task implementation that runs the same lambda for Invoke() and OnCancel().
 template <typename TInvoke>
 struct DispatchCleanupTaskImpl final
-    : Mso::UnknownObject<Mso::QueryCastHidden<Mso::IVoidFunctor>, Mso::ICancellationListener> {
+    : Mso::UnknownObject<
+          DispatchTaskRefCountPolicy,
+          Mso::QueryCastHidden<Mso::IVoidFunctor>,
+          Mso::ICancellationListener> {
   template <typename TInvokeArg>
   DispatchCleanupTaskImpl(TInvokeArg &&invoke) noexcept;
   void Invoke() noexcept override;
@@ -545,10 +749,18 @@ inline /*static*/ DispatchQueue DispatchQueue::MakeSerialQueue() noexcept {
   return IDispatchQueueStatic::Instance()->MakeSerialQueue();
 }
 
+inline /*static*/ DispatchQueue DispatchQueue::MakeSerialQueue(DispatchQueueOptions options) noexcept {
+  return IDispatchQueueStatic::Instance()->MakeSerialQueue(options);
+}
+
 inline /*static*/ DispatchQueue DispatchQueue::MakeLooperQueue() noexcept {
   return IDispatchQueueStatic::Instance()->MakeLooperQueue();
 }
 
+inline /*static*/ DispatchQueue DispatchQueue::MakeLooperQueue(DispatchQueueOptions options) noexcept {
+  return IDispatchQueueStatic::Instance()->MakeLooperQueue(options);
+}
+
 inline /*static*/ DispatchQueue DispatchQueue::GetCurrentUIThreadQueue() noexcept {
   return IDispatchQueueStatic::Instance()->GetCurrentUIThreadQueue();
 }
@@ -557,11 +769,36 @@ inline /*static*/ DispatchQueue DispatchQueue::MakeConcurrentQueue(uint32_t maxT
   return IDispatchQueueStatic::Instance()->MakeConcurrentQueue(maxThreads);
 }
 
+inline /*static*/ DispatchQueue DispatchQueue::MakeConcurrentQueue(
+    uint32_t maxThreads,
+    std::chrono::milliseconds timeSlice) noexcept {
+  return IDispatchQueueStatic::Instance()->MakeConcurrentQueue(maxThreads, timeSlice);
+}
+
 inline /*static*/ DispatchQueue DispatchQueue::MakeCustomQueue(
     Mso::CntPtr<IDispatchQueueScheduler> &&scheduler) noexcept {
   return IDispatchQueueStatic::Instance()->MakeCustomQueue(std::move(scheduler));
 }
 
+inline /*static*/ DispatchQueue DispatchQueue::MakeCustomQueue(
+    Mso::CntPtr<IDispatchQueueScheduler> &&scheduler,
+    DispatchQueueOptions options) noexcept {
+  return IDispatchQueueStatic::Instance()->MakeCustomQueue(std::move(scheduler), options);
+}
+
+inline /*static*/ Mso::CntPtr<IDispatchQueueStatsRecorder> DispatchQueue::MakeStatsRecorder(
+    std::string_view name) noexcept {
+  return IDispatchQueueStatic::Instance()->MakeStatsRecorder(name);
+}
+
+inline /*static*/ std::vector<DispatchQueueStats> DispatchQueue::GetAllStats() noexcept {
+  return IDispatchQueueStatic::Instance()->GetAllStats();
+}
+
+inline /*static*/ std::string DispatchQueue::GetAllStatsAsJson() noexcept {
+  return IDispatchQueueStatic::Instance()->GetAllStatsAsJson();
+}
+
 inline DispatchQueue::operator bool() const noexcept {
   return m_state != nullptr;
 }
@@ -570,6 +807,22 @@ inline void DispatchQueue::Post(DispatchTask &&task) const noexcept {
   m_state->Post(std::move(task));
 }
 
+inline void DispatchQueue::PostWithPriority(DispatchTask &&task, DispatchTaskPriority priority) const noexcept {
+  m_state->PostWithPriority(std::move(task), priority);
+}
+
+inline DispatchTimer DispatchQueue::PostAfter(
+    std::chrono::steady_clock::duration delay,
+    DispatchTask &&task) const noexcept {
+  return m_state->PostAt(std::chrono::steady_clock::now() + delay, std::move(task));
+}
+
+inline DispatchTimer DispatchQueue::PostAt(
+    std::chrono::steady_clock::time_point dueTime,
+    DispatchTask &&task) const noexcept {
+  return m_state->PostAt(dueTime, std::move(task));
+}
+
 inline void DispatchQueue::InvokeElsePost(DispatchTask &&task) const noexcept {
   m_state->InvokeElsePost(std::move(task));
 }
@@ -594,6 +847,14 @@ inline bool DispatchQueue::ShouldYield(TaskYieldReason *yieldReason /*= nullptr*
   return m_state->ShouldYield(yieldReason);
 }
 
+inline void DispatchQueue::EnableInstrumentation(std::string_view name) const noexcept {
+  m_state->EnableInstrumentation(name);
+}
+
+inline bool DispatchQueue::TryGetStats(/*out*/ DispatchQueueStats &stats) const noexcept {
+  return m_state->TryGetStats(/*out*/ stats);
+}
+
 inline DispatchTaskBatch DispatchQueue::StartTaskBatching() const noexcept {
   return DispatchTaskBatch{m_state};
 }
@@ -660,6 +921,22 @@ inline DispatchSuspendGuard::operator bool() const noexcept {
   return m_state != nullptr;
 }
 
+//=============================================================================
+// DispatchTimer inline implementation
+//=============================================================================
+
+inline DispatchTimer::DispatchTimer(std::nullptr_t) noexcept {}
+
+inline DispatchTimer::DispatchTimer(Mso::CntPtr<IDispatchTimer> &&state) noexcept : m_state{std::move(state)} {}
+
+inline DispatchTimer::operator bool() const noexcept {
+  return m_state != nullptr;
+}
+
+inline bool DispatchTimer::Cancel() const noexcept {
+  return m_state && m_state->Cancel();
+}
+
 //=============================================================================
 // DispatchTaskBatch inline implementation
 //=============================================================================
@@ -9,8 +9,9 @@
   Mso::Functor is a replacement for std::function that uses intrusive reference
   counting and is always non-throwing (even if it is wrapping a throwing function
   object). Mso::Functor has the following semantics:
-  - Always performs a heap allocation when creating a new instance from a function object, unless the function object is
-  stateless.
+  - Always allocates a function object wrapper when creating a new instance from a function object, unless the function
+  object is stateless. Wrappers up to Mso::Memory::MaxSmallBlockSize bytes are allocated from the small block pool
+  that reuses memory without going to the heap.
   - Are small (size of a CntPtr).
   - Cheap to copy and move.
   - There will only be one outstanding copy of the function object given to the Mso::Functor.
@@ -18,11 +19,11 @@
 
   For throwing function objects you can use Mso::FunctorThrow.
 
-  If you want to avoid the heap allocation overhead then you have two other choices:
-  - If the functor is not long lived and won't outlive the function object, use Mso::FunctorRef.
-  - If you need to keep the functor for longer, use Mso::SmallFunctor.
+  If you want to avoid the allocation overhead then use Mso::FunctorRef if the functor is not long lived and won't outlive
+  the function object.
 */
 
+#include <memoryApi/smallBlockAllocator.h>
 #include <object/unknownObject.h>
 #include <functional>
 #include <type_traits>
@@ -153,7 +154,9 @@ struct ConstexprFunctorBase : public TIFunctor {
 //! Function object wrapper. It can be a lambda or a class implementing call operator().
 template <typename TFunc, typename TResult, typename... TArgs>
 class FunctionObjectWrapper final
-    : public Mso::UnknownObject<Mso::RefCountStrategy::SimpleNoQuery, Mso::IFunctor<TResult, TArgs...>> {
+    : public Mso::UnknownObject<
+          Mso::SimpleNoQueryRefCountPolicy<Mso::SmallBlockAllocator>,
+          Mso::IFunctor<TResult, TArgs...>> {
  public:
   FunctionObjectWrapper() = delete;
   MSO_NO_COPY_CTOR_AND_ASSIGNMENT(FunctionObjectWrapper);
@@ -172,7 +175,9 @@ class FunctionObjectWrapper final
 //! Throwing function object wrapper. It can be a lambda or a class implementing call operator().
 template <typename TFunc, typename TResult, typename... TArgs>
 class FunctionObjectWrapperThrow final
-    : public Mso::UnknownObject<Mso::RefCountStrategy::SimpleNoQuery, Mso::IFunctorThrow<TResult, TArgs...>> {
+    : public Mso::UnknownObject<
+          Mso::SimpleNoQueryRefCountPolicy<Mso::SmallBlockAllocator>,
+          Mso::IFunctorThrow<TResult, TArgs...>> {
  public:
   FunctionObjectWrapperThrow() = delete;
   MSO_NO_COPY_CTOR_AND_ASSIGNMENT(FunctionObjectWrapperThrow);
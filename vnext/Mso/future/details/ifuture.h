@@ -61,6 +61,12 @@ struct FutureTraits {
   FutureCatchCallback *TaskCatch; // Catches parent future error.
 };
 
+// IFutureAwaiter is notified when the future it was added to by IFuture::TryAddAwaiter is completed.
+// Coroutines use it to be resumed from the future continuation slot without allocating a continuation future.
+struct IFutureAwaiter {
+  virtual void OnFutureCompleted(_In_ IFuture *future) noexcept = 0;
+};
+
 struct IFuture : IUnknown {
   virtual const FutureTraits &GetTraits() const noexcept = 0;
   virtual ByteArrayView GetTask() noexcept = 0;
@@ -69,6 +75,11 @@ struct IFuture : IUnknown {
 
   virtual void AddContinuation(Mso::CntPtr<IFuture> &&continuation) noexcept = 0;
 
+  // Adds the awaiter to a unique future in place of a continuation. Returns false if the future is already completed.
+  // Otherwise, the awaiter is called once by the thread that completes the future. The awaiter is not owned by the
+  // future and it must stay alive until it is called.
+  virtual bool TryAddAwaiter(IFutureAwaiter &awaiter) noexcept = 0;
+
   _Success_(
       return ) virtual bool TryStartSetValue(_Out_ ByteArrayView &valueBuffer, bool crashIfFailed = false) noexcept = 0;
   virtual void Post() noexcept = 0;
@@ -0,0 +1,289 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#pragma once
+#ifndef MSO_FUTURE_FUTURECOROUTINE_H
+#define MSO_FUTURE_FUTURECOROUTINE_H
+
+/** \file futureCoroutine.h
+Coroutine support for Mso::Future and Mso::DispatchQueue.
+
+A function that returns Mso::Future<T> can be a coroutine:
+
+  Mso::Future<int> LoadAsync(Mso::DispatchQueue queue) noexcept {
+    co_await queue;                            // Resume in the queue.
+    int size = co_await GetSizeAsync();        // Resume when the Mso::Future<int> is completed.
+    Mso::Maybe<void> result = co_await Mso::AwaitMaybe(SaveAsync()); // Observe errors instead of propagating them.
+    co_await Mso::CheckCancellation(token);    // Stop the coroutine if the token is canceled.
+    co_return size;
+  }
+
+The coroutine starts synchronously and runs until its first suspension. The returned future is completed when the
+coroutine returns. The errors follow the Future<T>::Then semantics:
+- If an awaited future fails, then the coroutine is stopped and its future fails with the same error.
+- If a queue cancels the task that resumes the coroutine, e.g. because of the queue shutdown, then the coroutine is
+  stopped and its future fails with the cancellation error.
+- If the cancellation token is canceled at a CheckCancellation point, then the coroutine is stopped and its future
+  fails with the cancellation error.
+- An exception escaping the coroutine body fails the future with the ExceptionErrorProvider error.
+Stopping a coroutine destroys its frame and all local variables without resuming it.
+
+Awaiting a future consumes its value the same way as Future<T>::Then does. Awaiting a future does not allocate:
+a future that is already succeeded is awaited synchronously, and a pending future stores the awaiter in place of its
+continuation and resumes the coroutine in the thread that completes the future. An awaited future cannot get other
+continuations. Use `co_await queue` to switch to the required queue.
+As with Future<T>::Then, the suspended coroutine does not keep the awaited future alive: if its Mso::Promise is
+destroyed without being completed, then the coroutine is stopped and its future fails with the cancellation error.
+
+Mso::Future<T> and Mso::DispatchQueue can be awaited only in coroutines that return Mso::Future<T>.
+*/
+
+#include <optional>
+#include "dispatchQueue/dispatchQueue.h"
+#include "errorCode/exceptionErrorProvider.h"
+#include "future/future.h"
+
+#if defined(__cpp_impl_coroutine) || defined(__cpp_lib_coroutine)
+#include <coroutine>
+#define MSO_COROUTINE_NAMESPACE std
+#else
+#include <experimental/coroutine>
+#define MSO_COROUTINE_NAMESPACE std::experimental
+#endif
+
+namespace Mso::Futures {
+
+template <class T>
+using CoroutineHandle = MSO_COROUTINE_NAMESPACE::coroutine_handle<T>;
+
+//! Common part of the promise type for coroutines that return Mso::Future<T>.
+template <class T>
+struct FutureCoroutinePromiseBase {
+  using ResultType = T;
+
+  Mso::Future<T> get_return_object() const noexcept {
+    return m_promise.AsFuture();
+  }
+
+  MSO_COROUTINE_NAMESPACE::suspend_never initial_suspend() const noexcept {
+    return {};
+  }
+
+  MSO_COROUTINE_NAMESPACE::suspend_never final_suspend() const noexcept {
+    return {};
+  }
+
+  void unhandled_exception() const noexcept {
+    m_promise.SetError(Mso::ExceptionErrorProvider().MakeErrorCode(std::current_exception()));
+  }
+
+  //! Completes the coroutine future with the error and destroys the suspended coroutine frame.
+  template <class TPromise>
+  static void StopCoroutine(CoroutineHandle<TPromise> handle, Mso::ErrorCode &&error) noexcept {
+    handle.promise().m_promise.SetError(std::move(error));
+    handle.destroy();
+  }
+
+ protected:
+  Mso::Promise<T> m_promise;
+};
+
+template <class T>
+struct FutureCoroutinePromise : FutureCoroutinePromiseBase<T> {
+  template <class TValue>
+  void return_value(TValue &&value) const noexcept {
+    this->m_promise.SetValue(std::forward<TValue>(value));
+  }
+};
+
+template <>
+struct FutureCoroutinePromise<void> : FutureCoroutinePromiseBase<void> {
+  void return_void() const noexcept {
+    m_promise.SetValue();
+  }
+};
+
+//! Awaiter for Mso::Future<T>. If PropagateError is true, then it returns the future value and stops the coroutine
+//! on error. Otherwise, it returns the future result as Mso::Maybe<T>.
+//! The awaiter is added to the future state in place of a continuation, and the future resumes the coroutine when it
+//! is completed. No continuation future is allocated.
+template <class T, bool PropagateError>
+struct FutureAwaiter : private IFutureAwaiter {
+  explicit FutureAwaiter(Mso::Future<T> &&future) noexcept : m_future{std::move(future)} {}
+
+  bool await_ready() noexcept {
+    // Succeeded futures are awaited without adding the awaiter.
+    IFuture *future = GetIFuture(m_future);
+    if (!future->IsSucceeded()) {
+      return false;
+    }
+
+    SetResult(future);
+    return true;
+  }
+
+  template <class TPromise>
+  bool await_suspend(CoroutineHandle<TPromise> handle) noexcept {
+    static_assert(
+        std::is_base_of_v<FutureCoroutinePromiseBase<typename TPromise::ResultType>, TPromise>,
+        "Mso::Future can be awaited only in coroutines that return Mso::Future.");
+
+    m_handle = handle;
+    m_stopCoroutine = &StopCoroutine<TPromise>;
+
+    // The added awaiter does not keep the future alive in the same way as a continuation does not keep its parent
+    // future alive. If the promise is abandoned, then the future destructor cancels it and stops the coroutine.
+    // The local future keeps it alive until we return because the awaiter may be destroyed before that.
+    Mso::Future<T> awaitedFuture{std::move(m_future)};
+    IFuture *future = GetIFuture(awaitedFuture);
+    if (future->TryAddAwaiter(*this)) {
+      // OnFutureCompleted resumes the coroutine. It may happen in another thread before we return, or when we release
+      // the awaitedFuture.
+      return true;
+    }
+
+    // The future is completed before we added the awaiter. Resume the coroutine by the caller without growing the
+    // stack.
+    SetResult(future);
+    if (PropagateError && m_result->IsError()) {
+      m_stopCoroutine(m_handle, m_result->TakeError());
+      return true;
+    }
+
+    return false;
+  }
+
+  auto await_resume() noexcept {
+    if constexpr (!PropagateError) {
+      return std::move(*m_result);
+    } else if constexpr (!std::is_void_v<T>) {
+      return m_result->TakeValue();
+    }
+  }
+
+ private:
+  void OnFutureCompleted(IFuture *future) noexcept override {
+    SetResult(future);
+    if (PropagateError && m_result->IsError()) {
+      m_stopCoroutine(m_handle, m_result->TakeError());
+    } else {
+      m_handle.resume();
+    }
+  }
+
+  //! Takes the future result. Awaiting a future consumes its value the same way as Future<T>::Then does.
+  void SetResult(IFuture *future) noexcept {
+    if (future->IsFailed()) {
+      m_result.emplace(future->GetError());
+    } else if constexpr (std::is_void_v<T>) {
+      m_result.emplace();
+    } else {
+      m_result.emplace(std::move(*future->GetValue().template As<T>()));
+    }
+  }
+
+  template <class TPromise>
+  static void StopCoroutine(CoroutineHandle<void> handle, Mso::ErrorCode &&error) noexcept {
+    FutureCoroutinePromiseBase<typename TPromise::ResultType>::StopCoroutine(
+        CoroutineHandle<TPromise>::from_address(handle.address()), std::move(error));
+  }
+
+ private:
+  Mso::Future<T> m_future;
+  std::optional<Mso::Maybe<T>> m_result;
+  CoroutineHandle<void> m_handle;
+  void (*m_stopCoroutine)(CoroutineHandle<void> handle, Mso::ErrorCode &&error) noexcept {nullptr};
+};
+
+//! Awaiter that resumes the coroutine in a dispatch queue.
+struct DispatchQueueAwaiter {
+  explicit DispatchQueueAwaiter(Mso::DispatchQueue const &queue) noexcept : m_queue{queue} {}
+
+  bool await_ready() const noexcept {
+    return false;
+  }
+
+  template <class TPromise>
+  void await_suspend(CoroutineHandle<TPromise> handle) const noexcept {
+    static_assert(
+        std::is_base_of_v<FutureCoroutinePromiseBase<typename TPromise::ResultType>, TPromise>,
+        "Mso::DispatchQueue can be awaited only in coroutines that return Mso::Future.");
+
+    // The queue may cancel the task synchronously and destroy the coroutine frame with this awaiter.
+    Mso::DispatchQueue queue{m_queue};
+    queue.Post(Mso::MakeDispatchTask(
+        [handle]() noexcept { handle.resume(); },
+        [handle]() noexcept {
+          FutureCoroutinePromiseBase<typename TPromise::ResultType>::StopCoroutine(
+              handle, Mso::CancellationErrorProvider().MakeErrorCode(true));
+        }));
+  }
+
+  void await_resume() const noexcept {}
+
+ private:
+  Mso::DispatchQueue m_queue;
+};
+
+//! Awaiter that stops the coroutine if the cancellation token is canceled.
+struct CancellationAwaiter {
+  explicit CancellationAwaiter(Mso::CancellationToken const &token) noexcept : m_token{token} {}
+
+  bool await_ready() const noexcept {
+    return !m_token.IsCanceled();
+  }
+
+  template <class TPromise>
+  void await_suspend(CoroutineHandle<TPromise> handle) const noexcept {
+    static_assert(
+        std::is_base_of_v<FutureCoroutinePromiseBase<typename TPromise::ResultType>, TPromise>,
+        "CheckCancellation can be awaited only in coroutines that return Mso::Future.");
+
+    FutureCoroutinePromiseBase<typename TPromise::ResultType>::StopCoroutine(
+        handle, Mso::CancellationErrorProvider().MakeErrorCode(true));
+  }
+
+  void await_resume() const noexcept {}
+
+ private:
+  Mso::CancellationToken m_token;
+};
+
+} // namespace Mso::Futures
+
+namespace Mso {
+
+//! Awaits the future and returns its value. If the future fails, then the coroutine is stopped, and the coroutine
+//! future fails with the same error.
+template <class T>
+Mso::Futures::FutureAwaiter<T, /*PropagateError:*/ true> operator co_await(Mso::Future<T> future) noexcept {
+  return Mso::Futures::FutureAwaiter<T, /*PropagateError:*/ true>{std::move(future)};
+}
+
+//! Awaits the future and returns its result as Mso::Maybe<T> without stopping the coroutine on error.
+template <class T>
+Mso::Futures::FutureAwaiter<T, /*PropagateError:*/ false> AwaitMaybe(Mso::Future<T> future) noexcept {
+  return Mso::Futures::FutureAwaiter<T, /*PropagateError:*/ false>{std::move(future)};
+}
+
+//! Resumes the coroutine in the queue. If the queue cancels the task, then the coroutine is stopped, and the coroutine
+//! future fails with the cancellation error.
+inline Mso::Futures::DispatchQueueAwaiter operator co_await(Mso::DispatchQueue const &queue) noexcept {
+  return Mso::Futures::DispatchQueueAwaiter{queue};
+}
+
+//! Continues the coroutine if the token is not canceled. Otherwise, the coroutine is stopped, and the coroutine future
+//! fails with the cancellation error.
+inline Mso::Futures::CancellationAwaiter CheckCancellation(Mso::CancellationToken const &token) noexcept {
+  return Mso::Futures::CancellationAwaiter{token};
+}
+
+} // namespace Mso
+
+// Allows to use Mso::Future<T> as a coroutine return type.
+template <class T, class... TArgs>
+struct MSO_COROUTINE_NAMESPACE::coroutine_traits<Mso::Future<T>, TArgs...> {
+  using promise_type = Mso::Futures::FutureCoroutinePromise<T>;
+};
+
+#endif // MSO_FUTURE_FUTURECOROUTINE_H
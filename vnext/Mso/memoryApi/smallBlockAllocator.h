@@ -0,0 +1,61 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+/**
+Pooled allocator for small short-lived objects such as function objects, dispatch tasks, and future states.
+
+Blocks up to MaxSmallBlockSize bytes are grouped into size classes. New blocks are carved from slabs that
+hold a batch of blocks of the same size class. Freed blocks are kept in a per-thread cache and exchanged in
+batches with a process-wide depot. It lets us avoid the heap for the steady state posting and invoking of small
+tasks, even when they are allocated and freed on different threads. The depot keeps a limited number of free
+blocks per size class: after a burst, the slabs that have all their blocks in the depot are returned to the heap.
+Bigger blocks go directly to the heap.
+*/
+#pragma once
+#ifndef MSO_MEMORYAPI_SMALLBLOCKALLOCATOR_H
+#define MSO_MEMORYAPI_SMALLBLOCKALLOCATOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include "compilerAdapters/functionDecorations.h"
+
+namespace Mso {
+namespace Memory {
+
+//! The biggest block size served from the small block pool.
+constexpr size_t MaxSmallBlockSize{512};
+
+//! Statistics of the small block pool. The difference between two snapshots shows the pool efficiency
+//! for the code that runs between them.
+struct SmallBlockPoolStats {
+  uint64_t HitCount{0}; // Allocations served from the free blocks in the pool.
+  uint64_t MissCount{0}; // Allocations that required a new slab.
+  uint64_t HeapAllocationCount{0}; // Slabs and blocks bigger than MaxSmallBlockSize allocated from the heap.
+  uint64_t HeapFreeCount{0}; // Slabs and blocks bigger than MaxSmallBlockSize returned to the heap.
+};
+
+//! Allocate a block from the small block pool. Returns nullptr on failure.
+LIBLET_PUBLICAPI void *AllocateSmallBlock(size_t size) noexcept;
+
+//! Return a block allocated by AllocateSmallBlock to the pool.
+LIBLET_PUBLICAPI void FreeSmallBlock(void *ptr) noexcept;
+
+//! Get the small block pool statistics.
+LIBLET_PUBLICAPI SmallBlockPoolStats GetSmallBlockPoolStats() noexcept;
+
+} // namespace Memory
+
+//! Stateless allocator for Mso::Make that uses the small block pool.
+struct SmallBlockAllocator {
+  static void *Allocate(size_t size) noexcept {
+    return Mso::Memory::AllocateSmallBlock(size);
+  }
+
+  static void Deallocate(void *ptr) noexcept {
+    Mso::Memory::FreeSmallBlock(ptr);
+  }
+};
+
+} // namespace Mso
+
+#endif // MSO_MEMORYAPI_SMALLBLOCKALLOCATOR_H
@@ -97,13 +97,18 @@ struct DefaultRefCountedDeleter {
   }
 };
 
+//! Ref count policy for UnknownObject that implements IUnknown with simple ref counting and an empty
+//! QueryInterface. The TAllocator is used to allocate the object memory.
+template <typename TAllocator = MakeAllocator>
+struct SimpleNoQueryRefCountPolicy;
+
 /**
   Supported Object ref count strategies. They are used to select base class for ref counting and to choose Make
   algorithm. The struct can be changed to a namespace if in future we need many strategies in different files.
 */
 namespace RefCountStrategy {
 using Simple = SimpleRefCountPolicy<DefaultRefCountedDeleter, MakeAllocator>;
-struct SimpleNoQuery;
+using SimpleNoQuery = SimpleNoQueryRefCountPolicy<MakeAllocator>;
 struct NoRefCount;
 struct NoRefCountNoQuery;
 }; // namespace RefCountStrategy
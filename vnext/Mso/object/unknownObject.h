@@ -249,6 +249,9 @@ BEGIN_DISABLE_WARNING_INCONSISTENT_MISSING_OVERRIDE()
         ...
       };
 
+    Use Mso::SimpleNoQueryRefCountPolicy<FooAllocator> instead of Mso::RefCountStrategy::SimpleNoQuery
+    to allocate the object with a custom stateless allocator.
+
 
   10) A class that implements a COM interface but with empty implementations of the IUnknown
     methods (AddRef, Release, QueryInterface).
@@ -450,12 +453,12 @@ class DECLSPEC_NOVTABLE UnknownObject<Mso::SimpleRefCountPolicy<TDeleter, TAlloc
   mutable std::atomic<uint32_t> m_refCount{1};
 };
 
-template <typename TBaseType0, typename... TBaseTypes>
-class DECLSPEC_NOVTABLE UnknownObject<Mso::RefCountStrategy::SimpleNoQuery, TBaseType0, TBaseTypes...>
+template <typename TAllocator, typename TBaseType0, typename... TBaseTypes>
+class DECLSPEC_NOVTABLE UnknownObject<Mso::SimpleNoQueryRefCountPolicy<TAllocator>, TBaseType0, TBaseTypes...>
     : public TBaseType0, public TBaseTypes... {
  public:
   using MakePolicy = Mso::MakePolicy::NoThrowCtor;
-  using RefCountPolicy = Mso::SimpleRefCountPolicy<Mso::DefaultRefCountedDeleter, Mso::MakeAllocator>;
+  using RefCountPolicy = Mso::SimpleRefCountPolicy<Mso::DefaultRefCountedDeleter, TAllocator>;
   friend RefCountPolicy;
 
   using UnknownObjectType = UnknownObject; // To use in derived class as "using Super = UnknownObjectType"
@@ -2,8 +2,12 @@
 // Licensed under the MIT license.
 
 #include "queueService.h"
+#include <algorithm>
+#include <utility>
+#include "queueStats.h"
 #include "taskBatch.h"
 #include "taskContext.h"
+#include "timerWheel.h"
 
 namespace Mso {
 
@@ -11,18 +15,54 @@ namespace Mso {
 // QueueService implementation.
 //=============================================================================
 
-QueueService::QueueService(Mso::CntPtr<IDispatchQueueScheduler> &&scheduler) noexcept
-    : m_scheduler{std::move(scheduler)} {
+QueueService::QueueService(Mso::CntPtr<IDispatchQueueScheduler> &&scheduler, DispatchQueueOptions options) noexcept
+    : m_scheduler{std::move(scheduler)}, m_options{options} {
   m_scheduler->IntializeScheduler(this);
 }
 
 QueueService::~QueueService() noexcept {
   AwaitTermination();
+
+  if (auto stats = m_stats.load()) {
+    stats->Release();
+  }
 }
 
 void QueueService::Post(DispatchTask &&task) noexcept {
+  PostWithPriority(std::move(task), DispatchTaskPriority::Normal);
+}
+
+void QueueService::PostWithPriority(DispatchTask &&task, DispatchTaskPriority priority) noexcept {
   VerifyElseCrashSz(task, "The task is empty");
 
+  // The instrumentation is off until EnableInstrumentation is called. While it is off, this check is its only cost.
+  if (QueueStatsRecorder *stats = m_stats.load(std::memory_order_acquire)) {
+    return PostInstrumentedTask(std::move(task), priority, *stats);
+  }
+
+  PostTask(std::move(task), priority);
+}
+
+void QueueService::PostInstrumentedTask(
+    DispatchTask &&task,
+    DispatchTaskPriority priority,
+    QueueStatsRecorder &stats) noexcept {
+  // The queue depth is tracked by the recorder without the queue lock to keep the lock-free posting lock-free.
+  size_t queueDepth = stats.AddWaitingTask();
+  if (!m_isShutdown) {
+    stats.RecordPost(queueDepth);
+  }
+
+  PostTask(Mso::VoidFunctor(Mso::Make<InstrumentedTask, IVoidFunctor>(std::move(task), Mso::CntPtr{&stats})), priority);
+}
+
+void QueueService::PostTask(DispatchTask &&task, DispatchTaskPriority priority) noexcept {
+  // Task batching requires the lock to find the thread's task batch.
+  if (priority == DispatchTaskPriority::Normal && IsSet(m_options, DispatchQueueOptions::LockFreePost) &&
+      m_taskBatchingCount.load() == 0) {
+    return PostLockFree(std::move(task));
+  }
+
   bool isShutdown = false;
   bool shouldSchedule = false;
 
@@ -34,7 +74,7 @@ void QueueService::Post(DispatchTask &&task) noexcept {
     } else {
       isShutdown = m_shutdownAction.has_value();
       if (!isShutdown) {
-        m_queue.Enqueue(std::move(task));
+        EnqueueTask(std::move(task), priority);
         shouldSchedule = (m_suspendCounter == 0);
       }
     }
@@ -47,11 +87,98 @@ void QueueService::Post(DispatchTask &&task) noexcept {
   }
 }
 
+void QueueService::PostLockFree(DispatchTask &&task) noexcept {
+  if (m_isShutdown) {
+    CancelTask(std::move(task));
+    return;
+  }
+
+  m_lockFreeQueue.Enqueue(std::move(task));
+
+  // The Shutdown could have taken all tasks from the lock-free queue before we added our task: it cancels them or
+  // moves them to the m_queue to complete them. The tasks left in the lock-free queue were posted after the Shutdown
+  // and are canceled in the same way as the PostTask cancels them.
+  // The fence pairs with the fence in Shutdown: either we see the m_isShutdown or the Shutdown sees our task.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (m_isShutdown) {
+    std::vector<DispatchTask> tasksToCancel;
+
+    {
+      std::lock_guard lock{m_mutex};
+      m_lockFreeQueue.DequeueAll(/*out*/ tasksToCancel);
+    }
+
+    for (auto &taskToCancel : tasksToCancel) {
+      CancelTask(std::move(taskToCancel));
+    }
+  }
+
+  // Resume() checks the task count after it changes the suspend counter. Either we or the Resume() schedule the task.
+  if (m_suspendCounter == 0) {
+    m_scheduler->Post();
+  }
+}
+
+Mso::CntPtr<IDispatchTimer> QueueService::PostAt(
+    std::chrono::steady_clock::time_point dueTime,
+    DispatchTask &&task) noexcept {
+  VerifyElseCrashSz(task, "The task is empty");
+  return TimerWheel::Instance().Schedule(Mso::WeakPtr<IDispatchQueueService>{this}, dueTime, std::move(task));
+}
+
 bool QueueService::ShouldYield(TaskYieldReason *yieldReason) noexcept {
   auto setReason = [&](TaskYieldReason reason) noexcept { return yieldReason ? *yieldReason = reason : reason, true; };
-  std::lock_guard lock{m_mutex};
-  return (m_shutdownAction.has_value() && setReason(TaskYieldReason::QueueShutdown)) ||
-      (m_suspendCounter > 0 && setReason(TaskYieldReason::QueueSuspended));
+  auto hasHigherPriorityTask = [this]() noexcept {
+    TaskContext *context = TaskContext::CurrentContext();
+    if (!context || TaskContext::CurrentQueue() != this) {
+      return false;
+    }
+
+    for (size_t lane = 0; lane < static_cast<size_t>(context->Priority()); ++lane) {
+      if (!IsLaneEmpty(static_cast<DispatchTaskPriority>(lane))) {
+        return true;
+      }
+    }
+
+    return false;
+  };
+
+  bool shouldYield{false};
+  {
+    std::lock_guard lock{m_mutex};
+    shouldYield = (m_shutdownAction.has_value() && setReason(TaskYieldReason::QueueShutdown)) ||
+        (m_suspendCounter > 0 && setReason(TaskYieldReason::QueueSuspended)) ||
+        (hasHigherPriorityTask() && setReason(TaskYieldReason::HigherPriorityTask));
+  }
+
+  if (shouldYield) {
+    if (auto stats = m_stats.load(std::memory_order_acquire)) {
+      stats->RecordYield();
+    }
+  }
+
+  return shouldYield;
+}
+
+void QueueService::EnableInstrumentation(std::string_view name) noexcept {
+  if (m_stats.load(std::memory_order_acquire)) {
+    return;
+  }
+
+  auto stats = Mso::Make<QueueStatsRecorder>(name);
+  QueueStatsRecorder *expected{nullptr};
+  if (m_stats.compare_exchange_strong(expected, stats.Get(), std::memory_order_acq_rel)) {
+    stats.Detach(); // m_stats owns the reference now.
+  }
+}
+
+bool QueueService::TryGetStats(/*out*/ DispatchQueueStats &stats) noexcept {
+  if (auto recorder = m_stats.load(std::memory_order_acquire)) {
+    stats = recorder->GetStats();
+    return true;
+  }
+
+  return false;
 }
 
 bool QueueService::IsCurrentQueue() noexcept {
@@ -92,6 +219,8 @@ void QueueService::BeginTaskBatching() noexcept {
   std::lock_guard lock{m_mutex};
   auto result = m_taskBatches.try_emplace(std::this_thread::get_id(), std::move(taskBatch));
   if (result.second) {
+    ++m_taskBatchingCount;
+  } else {
     taskBatch->SetEnclosingBatch(std::move(result.first->second));
     result.first->second = std::move(taskBatch);
   }
@@ -107,6 +236,7 @@ DispatchTask QueueService::EndTaskBatching() noexcept {
       it->second = std::move(enclosingBatch);
     } else {
       m_taskBatches.erase(it);
+      --m_taskBatchingCount;
     }
   } else {
     taskBatch = Mso::Make<TaskBatch>();
@@ -156,7 +286,7 @@ void QueueService::Resume() noexcept {
     VerifyElseCrashSz(m_suspendCounter > 0, "m_suspendCounter must not be negative");
 
     if (--m_suspendCounter == 0) {
-      postCount = m_queue.Size();
+      postCount = TaskCount();
     }
   }
 
@@ -171,8 +301,18 @@ void QueueService::Shutdown(PendingTaskAction pendingTaskAction) noexcept {
   {
     std::lock_guard lock{m_mutex};
     m_shutdownAction = pendingTaskAction;
+    m_isShutdown = true;
+    std::atomic_thread_fence(std::memory_order_seq_cst);
     if (pendingTaskAction == PendingTaskAction::Cancel) {
-      m_queue.DequeueAll(/*out*/ tasksToCancel);
+      DequeueAllTasks(/*out*/ tasksToCancel);
+    } else if (IsSet(m_options, DispatchQueueOptions::LockFreePost)) {
+      // Move the tasks posted before the shutdown out of the lock-free queue to complete them.
+      // The tasks posted to the lock-free queue after this point are canceled by PostLockFree.
+      std::vector<DispatchTask> tasksToComplete;
+      m_lockFreeQueue.DequeueAll(/*out*/ tasksToComplete);
+      for (auto &task : tasksToComplete) {
+        m_queue.Enqueue(std::move(task));
+      }
     }
   }
 
@@ -190,18 +330,18 @@ void QueueService::AwaitTermination() noexcept {
 
 bool QueueService::HasTasks() noexcept {
   std::lock_guard lock{m_mutex};
-  return m_suspendCounter == 0 && !m_queue.IsEmpty();
+  return m_suspendCounter == 0 && !HasNoTasks();
 }
 
 bool QueueService::TryDequeTask(/*out*/ DispatchTask &task) noexcept {
   std::lock_guard lock{m_mutex};
-  return m_suspendCounter == 0 && m_queue.TryDequeue(/*out*/ task);
+  return m_suspendCounter == 0 && TryDequeueTask(/*out*/ task, /*out*/ tls_dequeuedTaskPriority);
 }
 
 void QueueService::InvokeTask(
     DispatchTask &&task,
     std::optional<std::chrono::steady_clock::time_point> endTime) noexcept {
-  TaskContext context{this, endTime};
+  TaskContext context{this, endTime, std::exchange(tls_dequeuedTaskPriority, DispatchTaskPriority::Normal)};
   DispatchTask taskToInvoke{std::move(task)};
   taskToInvoke.Get()->Invoke(); // Call Get()->Invoke instead of operator() to flatten call stack
 
@@ -217,6 +357,100 @@ void QueueService::CancelTask(DispatchTask &&task) noexcept {
   }
 }
 
+void QueueService::EnqueueTask(DispatchTask &&task, DispatchTaskPriority priority) noexcept {
+  switch (priority) {
+    case DispatchTaskPriority::High:
+      m_highPriorityQueue.Enqueue(std::move(task));
+      break;
+    case DispatchTaskPriority::Low:
+      m_lowPriorityQueue.Enqueue(std::move(task));
+      break;
+    default:
+      if (IsSet(m_options, DispatchQueueOptions::LockFreePost)) {
+        m_lockFreeQueue.Enqueue(std::move(task));
+      } else {
+        m_queue.Enqueue(std::move(task));
+      }
+      break;
+  }
+}
+
+bool QueueService::TryDequeueTask(/*out*/ DispatchTask &task, /*out*/ DispatchTaskPriority &priority) noexcept {
+  // Lanes are checked from the highest to the lowest priority. To avoid starvation, a non-empty lane that was skipped
+  // MaxLaneSkipCount times is checked first. The lowest priority lane wins if both lower lanes are starving.
+  std::array<DispatchTaskPriority, LaneCount> lanes{
+      DispatchTaskPriority::High, DispatchTaskPriority::Normal, DispatchTaskPriority::Low};
+  for (size_t i = LaneCount - 1; i > 0; --i) {
+    if (m_laneSkipCounts[static_cast<size_t>(lanes[i])] >= MaxLaneSkipCount && !IsLaneEmpty(lanes[i])) {
+      std::rotate(lanes.begin(), lanes.begin() + i, lanes.begin() + i + 1);
+      break;
+    }
+  }
+
+  for (DispatchTaskPriority lane : lanes) {
+    if (TryDequeueLaneTask(lane, /*out*/ task)) {
+      priority = lane;
+      for (size_t i = 0; i < LaneCount; ++i) {
+        if (static_cast<DispatchTaskPriority>(i) == lane) {
+          m_laneSkipCounts[i] = 0;
+        } else if (!IsLaneEmpty(static_cast<DispatchTaskPriority>(i))) {
+          ++m_laneSkipCounts[i];
+        }
+      }
+
+      return true;
+    }
+  }
+
+  return false;
+}
+
+bool QueueService::TryDequeueLaneTask(DispatchTaskPriority priority, /*out*/ DispatchTask &task) noexcept {
+  switch (priority) {
+    case DispatchTaskPriority::High:
+      return m_highPriorityQueue.TryDequeue(/*out*/ task);
+    case DispatchTaskPriority::Low:
+      return m_lowPriorityQueue.TryDequeue(/*out*/ task);
+    default:
+      // With the DispatchQueueOptions::LockFreePost the m_queue has only the tasks moved there by the Shutdown.
+      // After the Shutdown the tasks in the lock-free queue are to be canceled, not invoked.
+      if (m_queue.TryDequeue(/*out*/ task)) {
+        return true;
+      }
+
+      return IsSet(m_options, DispatchQueueOptions::LockFreePost) && !m_shutdownAction &&
+          m_lockFreeQueue.TryDequeue(/*out*/ task);
+  }
+}
+
+bool QueueService::DequeueAllTasks(/*out*/ std::vector<DispatchTask> &tasks) noexcept {
+  bool result = m_highPriorityQueue.DequeueAll(/*out*/ tasks);
+  result = m_queue.DequeueAll(/*out*/ tasks) || result;
+  result = m_lockFreeQueue.DequeueAll(/*out*/ tasks) || result;
+  result = m_lowPriorityQueue.DequeueAll(/*out*/ tasks) || result;
+  return result;
+}
+
+bool QueueService::IsLaneEmpty(DispatchTaskPriority priority) const noexcept {
+  switch (priority) {
+    case DispatchTaskPriority::High:
+      return m_highPriorityQueue.IsEmpty();
+    case DispatchTaskPriority::Low:
+      return m_lowPriorityQueue.IsEmpty();
+    default:
+      return m_queue.IsEmpty() && (m_shutdownAction || m_lockFreeQueue.IsEmpty());
+  }
+}
+
+size_t QueueService::TaskCount() const noexcept {
+  return m_highPriorityQueue.Size() + m_queue.Size() + m_lockFreeQueue.Size() + m_lowPriorityQueue.Size();
+}
+
+bool QueueService::HasNoTasks() const noexcept {
+  return IsLaneEmpty(DispatchTaskPriority::High) && IsLaneEmpty(DispatchTaskPriority::Normal) &&
+      IsLaneEmpty(DispatchTaskPriority::Low);
+}
+
 //=============================================================================
 // LocalValueEntry implementation.
 //=============================================================================
@@ -263,24 +497,59 @@ DispatchQueue DispatchQueueStatic::CurrentQueue() noexcept {
 }
 
 DispatchQueue const &DispatchQueueStatic::ConcurrentQueue() noexcept {
-  static auto concurrentQueue{Mso::Make<QueueService, IDispatchQueueService>(MakeThreadPoolScheduler(0))};
-  return *static_cast<DispatchQueue *>(static_cast<void *>(&concurrentQueue));
+  // The queue is never destroyed in the same way as the work stealing thread pool that runs its tasks:
+  // releasing it from a static destructor could wait for the pool threads under the loader lock.
+  static auto concurrentQueue{new Mso::CntPtr<IDispatchQueueService>{
+      Mso::Make<QueueService, IDispatchQueueService>(MakeWorkStealingScheduler(0, DefaultTimeSlice))}};
+  return *static_cast<DispatchQueue *>(static_cast<void *>(concurrentQueue));
 }
 
 DispatchQueue DispatchQueueStatic::MakeSerialQueue() noexcept {
-  return Mso::Make<QueueService, IDispatchQueueService>(MakeThreadPoolScheduler(/*maxThreads:*/ 1));
+  return MakeSerialQueue(DispatchQueueOptions::None);
+}
+
+DispatchQueue DispatchQueueStatic::MakeSerialQueue(DispatchQueueOptions options) noexcept {
+  return Mso::Make<QueueService, IDispatchQueueService>(MakeThreadPoolScheduler(/*maxThreads:*/ 1), options);
 }
 
 DispatchQueue DispatchQueueStatic::MakeLooperQueue() noexcept {
-  return Mso::Make<QueueService, IDispatchQueueService>(MakeLooperScheduler());
+  return MakeLooperQueue(DispatchQueueOptions::None);
+}
+
+DispatchQueue DispatchQueueStatic::MakeLooperQueue(DispatchQueueOptions options) noexcept {
+  return Mso::Make<QueueService, IDispatchQueueService>(MakeLooperScheduler(), options);
 }
 
 DispatchQueue DispatchQueueStatic::MakeConcurrentQueue(uint32_t maxThreads) noexcept {
-  return Mso::Make<QueueService, IDispatchQueueService>(MakeThreadPoolScheduler(maxThreads));
+  return MakeConcurrentQueue(maxThreads, DefaultTimeSlice);
+}
+
+DispatchQueue DispatchQueueStatic::MakeConcurrentQueue(
+    uint32_t maxThreads,
+    std::chrono::milliseconds timeSlice) noexcept {
+  return Mso::Make<QueueService, IDispatchQueueService>(MakeWorkStealingScheduler(maxThreads, timeSlice));
 }
 
 DispatchQueue DispatchQueueStatic::MakeCustomQueue(Mso::CntPtr<IDispatchQueueScheduler> &&scheduler) noexcept {
-  return Mso::Make<QueueService, IDispatchQueueService>(std::move(scheduler));
+  return MakeCustomQueue(std::move(scheduler), DispatchQueueOptions::None);
+}
+
+DispatchQueue DispatchQueueStatic::MakeCustomQueue(
+    Mso::CntPtr<IDispatchQueueScheduler> &&scheduler,
+    DispatchQueueOptions options) noexcept {
+  return Mso::Make<QueueService, IDispatchQueueService>(std::move(scheduler), options);
+}
+
+Mso::CntPtr<IDispatchQueueStatsRecorder> DispatchQueueStatic::MakeStatsRecorder(std::string_view name) noexcept {
+  return Mso::Make<QueueStatsRecorder, IDispatchQueueStatsRecorder>(name);
+}
+
+std::vector<DispatchQueueStats> DispatchQueueStatic::GetAllStats() noexcept {
+  return QueueStatsRegistry::Instance().GetAllStats();
+}
+
+std::string DispatchQueueStatic::GetAllStatsAsJson() noexcept {
+  return QueueStatsRegistry::ToJson(GetAllStats());
 }
 
 } // namespace Mso
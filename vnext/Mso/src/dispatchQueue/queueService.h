@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <array>
 #include <map>
 #include <thread>
 #include "eventWaitHandle/eventWaitHandle.h"
@@ -14,6 +15,7 @@ namespace Mso {
 // Forward declarations
 struct QueueLocalValueEntry;
 struct QueueService;
+struct QueueStatsRecorder;
 struct TaskBatch;
 
 enum class LocalValueSwapAction {
@@ -23,7 +25,9 @@ enum class LocalValueSwapAction {
 
 // A base class for serial dispatch queues
 struct QueueService : Mso::UnknownObject<Mso::RefCountStrategy::WeakRef, IDispatchQueueService, IDispatchQueue> {
-  QueueService(Mso::CntPtr<IDispatchQueueScheduler> &&scheduler) noexcept;
+  QueueService(
+      Mso::CntPtr<IDispatchQueueScheduler> &&scheduler,
+      DispatchQueueOptions options = DispatchQueueOptions::None) noexcept;
   ~QueueService() noexcept override;
 
   QueueService(QueueService const &other) = delete;
@@ -31,7 +35,12 @@ struct QueueService : Mso::UnknownObject<Mso::RefCountStrategy::WeakRef, IDispat
 
  public: // IDispatchQueueService
   void Post(DispatchTask &&task) noexcept override;
+  void PostWithPriority(DispatchTask &&task, DispatchTaskPriority priority) noexcept override;
+  Mso::CntPtr<IDispatchTimer> PostAt(std::chrono::steady_clock::time_point dueTime, DispatchTask &&task) noexcept
+      override;
   bool ShouldYield(TaskYieldReason *yieldReason) noexcept override;
+  void EnableInstrumentation(std::string_view name) noexcept override;
+  bool TryGetStats(/*out*/ DispatchQueueStats &stats) noexcept override;
   bool IsCurrentQueue() noexcept override;
   bool IsSerial() noexcept override;
   bool HasThreadAccess() noexcept override;
@@ -57,14 +66,49 @@ struct QueueService : Mso::UnknownObject<Mso::RefCountStrategy::WeakRef, IDispat
       void **tlsValue,
       LocalValueSwapAction action) noexcept;
 
+  // Wraps the task to record its statistics when the instrumentation is enabled.
+  void PostInstrumentedTask(
+      DispatchTask &&task,
+      DispatchTaskPriority priority,
+      QueueStatsRecorder &stats) noexcept;
+  void PostTask(DispatchTask &&task, DispatchTaskPriority priority) noexcept;
+
+  // Lock-free Post that is used for the DispatchQueueOptions::LockFreePost when no thread is batching tasks.
+  void PostLockFree(DispatchTask &&task) noexcept;
+
+  // Helper methods to access the task queue lanes. The normal priority lane uses the lock-free queue for the
+  // DispatchQueueOptions::LockFreePost. The consumer methods must be called under the m_mutex lock.
+  void EnqueueTask(DispatchTask &&task, DispatchTaskPriority priority) noexcept;
+  bool TryDequeueTask(/*out*/ DispatchTask &task, /*out*/ DispatchTaskPriority &priority) noexcept;
+  bool TryDequeueLaneTask(DispatchTaskPriority priority, /*out*/ DispatchTask &task) noexcept;
+  bool DequeueAllTasks(/*out*/ std::vector<DispatchTask> &tasks) noexcept;
+  bool IsLaneEmpty(DispatchTaskPriority priority) const noexcept;
+  size_t TaskCount() const noexcept;
+  bool HasNoTasks() const noexcept;
+
+  // Number of times a non-empty lane can be skipped in favor of higher priority lanes before it is served first.
+  constexpr static uint32_t MaxLaneSkipCount{16};
+  constexpr static size_t LaneCount{3};
+
  private:
   const Mso::CntPtr<IDispatchQueueScheduler> m_scheduler;
+  const DispatchQueueOptions m_options;
   ThreadMutex m_mutex;
   TaskQueue m_queue{static_cast<IDispatchQueue *>(this)};
+  TaskQueue m_highPriorityQueue{static_cast<IDispatchQueue *>(this)};
+  TaskQueue m_lowPriorityQueue{static_cast<IDispatchQueue *>(this)};
+  LockFreeTaskQueue m_lockFreeQueue{static_cast<IDispatchQueue *>(this)};
+  std::array<uint32_t, LaneCount> m_laneSkipCounts{};
   std::optional<PendingTaskAction> m_shutdownAction;
-  int32_t m_suspendCounter{0};
+  std::atomic<bool> m_isShutdown{false}; // Mirrors m_shutdownAction to be checked without the lock.
+  std::atomic<int32_t> m_suspendCounter{0};
+  std::atomic<int32_t> m_taskBatchingCount{0}; // Number of threads that batch tasks.
   std::map<std::thread::id, Mso::CntPtr<TaskBatch>> m_taskBatches;
   std::map<ptrdiff_t, QueueLocalValueEntry> m_localValues;
+  std::atomic<QueueStatsRecorder *> m_stats{nullptr}; // Owns a reference when instrumentation is enabled.
+
+  // Priority of the task returned by TryDequeTask in this thread. It is passed to the TaskContext in InvokeTask.
+  inline static thread_local DispatchTaskPriority tls_dequeuedTaskPriority{DispatchTaskPriority::Normal};
 };
 
 // Stores a queue local value
@@ -83,15 +127,30 @@ struct DispatchQueueStatic : Mso::UnknownObject<Mso::RefCountStrategy::NoRefCoun
   static DispatchQueueStatic *Instance() noexcept;
   static Mso::CntPtr<IDispatchQueueScheduler> MakeLooperScheduler() noexcept;
   static Mso::CntPtr<IDispatchQueueScheduler> MakeThreadPoolScheduler(uint32_t maxThreads) noexcept;
+  static Mso::CntPtr<IDispatchQueueScheduler> MakeWorkStealingScheduler(
+      uint32_t maxThreads,
+      std::chrono::milliseconds timeSlice) noexcept;
+
+  //! Default time slice for a thread pool scheduler to invoke queue tasks before yielding the thread.
+  constexpr static std::chrono::milliseconds DefaultTimeSlice{100};
 
  public: // IDispatchQueueStatic
   DispatchQueue CurrentQueue() noexcept override;
   DispatchQueue const &ConcurrentQueue() noexcept override;
   DispatchQueue MakeSerialQueue() noexcept override;
+  DispatchQueue MakeSerialQueue(DispatchQueueOptions options) noexcept override;
   DispatchQueue MakeLooperQueue() noexcept override;
+  DispatchQueue MakeLooperQueue(DispatchQueueOptions options) noexcept override;
   DispatchQueue GetCurrentUIThreadQueue() noexcept override;
   DispatchQueue MakeConcurrentQueue(uint32_t maxThreads) noexcept override;
+  DispatchQueue MakeConcurrentQueue(uint32_t maxThreads, std::chrono::milliseconds timeSlice) noexcept override;
   DispatchQueue MakeCustomQueue(Mso::CntPtr<IDispatchQueueScheduler> &&scheduler) noexcept override;
+  DispatchQueue MakeCustomQueue(
+      Mso::CntPtr<IDispatchQueueScheduler> &&scheduler,
+      DispatchQueueOptions options) noexcept override;
+  Mso::CntPtr<IDispatchQueueStatsRecorder> MakeStatsRecorder(std::string_view name) noexcept override;
+  std::vector<DispatchQueueStats> GetAllStats() noexcept override;
+  std::string GetAllStatsAsJson() noexcept override;
 };
 
 } // namespace Mso
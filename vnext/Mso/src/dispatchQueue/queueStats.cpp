@@ -0,0 +1,239 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include "queueStats.h"
+#include <algorithm>
+#include <cstdio>
+
+namespace Mso {
+
+namespace {
+
+void AtomicMax(std::atomic<uint64_t> &target, uint64_t value) noexcept {
+  uint64_t current = target.load(std::memory_order_relaxed);
+  while (current < value && !target.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+  }
+}
+
+void AppendJsonString(std::string &json, std::string_view value) noexcept {
+  json += '"';
+  for (char ch : value) {
+    switch (ch) {
+      case '"':
+        json += "\\\"";
+        break;
+      case '\\':
+        json += "\\\\";
+        break;
+      default:
+        if (static_cast<unsigned char>(ch) < 0x20) {
+          char buffer[8];
+          snprintf(buffer, sizeof(buffer), "\\u%04x", static_cast<unsigned int>(ch));
+          json += buffer;
+        } else {
+          json += ch;
+        }
+        break;
+    }
+  }
+
+  json += '"';
+}
+
+void AppendJsonProperty(std::string &json, std::string_view name, uint64_t value) noexcept {
+  AppendJsonString(json, name);
+  json += ':';
+  json += std::to_string(value);
+}
+
+void AppendJsonHistogram(std::string &json, std::string_view name, DispatchDurationHistogram const &histogram) noexcept {
+  AppendJsonString(json, name);
+  json += ":{";
+  AppendJsonProperty(json, "count", histogram.Count);
+  json += ',';
+  AppendJsonProperty(json, "totalUs", static_cast<uint64_t>(histogram.Total.count()));
+  json += ',';
+  AppendJsonProperty(json, "maxUs", static_cast<uint64_t>(histogram.Max.count()));
+  json += ",\"buckets\":[";
+  for (size_t i = 0; i < histogram.Buckets.size(); ++i) {
+    json += (i > 0) ? "," : "";
+    json += std::to_string(histogram.Buckets[i]);
+  }
+
+  json += "]}";
+}
+
+} // namespace
+
+//=============================================================================
+// DurationHistogramRecorder implementation
+//=============================================================================
+
+void DurationHistogramRecorder::Record(std::chrono::steady_clock::duration duration) noexcept {
+  uint64_t us = static_cast<uint64_t>(
+      std::max<int64_t>(std::chrono::duration_cast<std::chrono::microseconds>(duration).count(), 0));
+
+  size_t bucket{0};
+  for (uint64_t value = us; value && bucket < DispatchDurationHistogram::BucketCount - 1; value >>= 1) {
+    ++bucket;
+  }
+
+  m_buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+  m_count.fetch_add(1, std::memory_order_relaxed);
+  m_totalUs.fetch_add(us, std::memory_order_relaxed);
+  AtomicMax(m_maxUs, us);
+}
+
+DispatchDurationHistogram DurationHistogramRecorder::GetHistogram() const noexcept {
+  DispatchDurationHistogram histogram;
+  for (size_t i = 0; i < m_buckets.size(); ++i) {
+    histogram.Buckets[i] = m_buckets[i].load(std::memory_order_relaxed);
+  }
+
+  histogram.Count = m_count.load(std::memory_order_relaxed);
+  histogram.Total = std::chrono::microseconds(m_totalUs.load(std::memory_order_relaxed));
+  histogram.Max = std::chrono::microseconds(m_maxUs.load(std::memory_order_relaxed));
+  return histogram;
+}
+
+//=============================================================================
+// QueueStatsRecorder implementation
+//=============================================================================
+
+QueueStatsRecorder::QueueStatsRecorder(std::string_view name) noexcept : m_name{name} {
+  QueueStatsRegistry::Instance().Register(this);
+}
+
+QueueStatsRecorder::~QueueStatsRecorder() noexcept {
+  QueueStatsRegistry::Instance().Unregister(this);
+}
+
+void QueueStatsRecorder::RecordPost(size_t queueDepth) noexcept {
+  m_postedTaskCount.fetch_add(1, std::memory_order_relaxed);
+  size_t maxQueueDepth = m_maxQueueDepth.load(std::memory_order_relaxed);
+  while (maxQueueDepth < queueDepth &&
+         !m_maxQueueDepth.compare_exchange_weak(maxQueueDepth, queueDepth, std::memory_order_relaxed)) {
+  }
+}
+
+size_t QueueStatsRecorder::AddWaitingTask() noexcept {
+  return m_waitingTaskCount.fetch_add(1, std::memory_order_relaxed) + 1;
+}
+
+void QueueStatsRecorder::RemoveWaitingTask() noexcept {
+  m_waitingTaskCount.fetch_sub(1, std::memory_order_relaxed);
+}
+
+void QueueStatsRecorder::RecordInvoke(
+    std::chrono::steady_clock::duration waitTime,
+    std::chrono::steady_clock::duration executionTime) noexcept {
+  m_invokedTaskCount.fetch_add(1, std::memory_order_relaxed);
+  m_waitTime.Record(waitTime);
+  m_executionTime.Record(executionTime);
+}
+
+void QueueStatsRecorder::RecordCancel() noexcept {
+  m_canceledTaskCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+void QueueStatsRecorder::RecordYield() noexcept {
+  m_yieldCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+DispatchQueueStats QueueStatsRecorder::GetStats() noexcept {
+  DispatchQueueStats stats;
+  stats.Name = m_name;
+  stats.PostedTaskCount = m_postedTaskCount.load(std::memory_order_relaxed);
+  stats.InvokedTaskCount = m_invokedTaskCount.load(std::memory_order_relaxed);
+  stats.CanceledTaskCount = m_canceledTaskCount.load(std::memory_order_relaxed);
+  stats.YieldCount = m_yieldCount.load(std::memory_order_relaxed);
+  stats.MaxQueueDepth = m_maxQueueDepth.load(std::memory_order_relaxed);
+  stats.WaitTime = m_waitTime.GetHistogram();
+  stats.ExecutionTime = m_executionTime.GetHistogram();
+  return stats;
+}
+
+//=============================================================================
+// QueueStatsRegistry implementation
+//=============================================================================
+
+/*static*/ QueueStatsRegistry &QueueStatsRegistry::Instance() noexcept {
+  static QueueStatsRegistry instance;
+  return instance;
+}
+
+void QueueStatsRegistry::Register(QueueStatsRecorder *recorder) noexcept {
+  std::lock_guard lock{m_mutex};
+  m_recorders.push_back(recorder);
+}
+
+void QueueStatsRegistry::Unregister(QueueStatsRecorder *recorder) noexcept {
+  std::lock_guard lock{m_mutex};
+  m_recorders.erase(std::remove(m_recorders.begin(), m_recorders.end(), recorder), m_recorders.end());
+}
+
+std::vector<DispatchQueueStats> QueueStatsRegistry::GetAllStats() noexcept {
+  // The recorders cannot be destroyed while we hold the lock because their destructor unregisters them.
+  std::lock_guard lock{m_mutex};
+  std::vector<DispatchQueueStats> result;
+  result.reserve(m_recorders.size());
+  for (QueueStatsRecorder *recorder : m_recorders) {
+    result.push_back(recorder->GetStats());
+  }
+
+  return result;
+}
+
+/*static*/ std::string QueueStatsRegistry::ToJson(std::vector<DispatchQueueStats> const &stats) noexcept {
+  std::string json{"["};
+  for (size_t i = 0; i < stats.size(); ++i) {
+    DispatchQueueStats const &queueStats = stats[i];
+    json += (i > 0) ? ",{" : "{";
+    AppendJsonString(json, "name");
+    json += ':';
+    AppendJsonString(json, queueStats.Name);
+    json += ',';
+    AppendJsonProperty(json, "postedTaskCount", queueStats.PostedTaskCount);
+    json += ',';
+    AppendJsonProperty(json, "invokedTaskCount", queueStats.InvokedTaskCount);
+    json += ',';
+    AppendJsonProperty(json, "canceledTaskCount", queueStats.CanceledTaskCount);
+    json += ',';
+    AppendJsonProperty(json, "yieldCount", queueStats.YieldCount);
+    json += ',';
+    AppendJsonProperty(json, "maxQueueDepth", queueStats.MaxQueueDepth);
+    json += ',';
+    AppendJsonHistogram(json, "waitTime", queueStats.WaitTime);
+    json += ',';
+    AppendJsonHistogram(json, "executionTime", queueStats.ExecutionTime);
+    json += '}';
+  }
+
+  json += ']';
+  return json;
+}
+
+//=============================================================================
+// InstrumentedTask implementation
+//=============================================================================
+
+InstrumentedTask::InstrumentedTask(DispatchTask &&task, Mso::CntPtr<QueueStatsRecorder> &&stats) noexcept
+    : m_task{std::move(task)}, m_stats{std::move(stats)}, m_postTime{std::chrono::steady_clock::now()} {}
+
+void InstrumentedTask::Invoke() noexcept {
+  m_stats->RemoveWaitingTask();
+  auto startTime = std::chrono::steady_clock::now();
+  m_task.Get()->Invoke();
+  m_stats->RecordInvoke(startTime - m_postTime, std::chrono::steady_clock::now() - startTime);
+}
+
+void InstrumentedTask::OnCancel() noexcept {
+  m_stats->RemoveWaitingTask();
+  m_stats->RecordCancel();
+  DispatchTask task{std::move(m_task)};
+  if (auto cancellation = query_cast<ICancellationListener *>(task.Get())) {
+    cancellation->OnCancel();
+  }
+}
+
+} // namespace Mso
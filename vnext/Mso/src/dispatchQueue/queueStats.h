@@ -0,0 +1,94 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+#include "dispatchQueue/dispatchQueue.h"
+
+namespace Mso {
+
+//! Thread safe collector of a DispatchDurationHistogram.
+struct DurationHistogramRecorder {
+  void Record(std::chrono::steady_clock::duration duration) noexcept;
+  DispatchDurationHistogram GetHistogram() const noexcept;
+
+ private:
+  std::array<std::atomic<uint64_t>, DispatchDurationHistogram::BucketCount> m_buckets{};
+  std::atomic<uint64_t> m_count{0};
+  std::atomic<uint64_t> m_totalUs{0};
+  std::atomic<uint64_t> m_maxUs{0};
+};
+
+//! Thread safe collector of the dispatch queue task statistics.
+//! It is registered in the QueueStatsRegistry for its lifetime.
+struct QueueStatsRecorder final : Mso::UnknownObject<IDispatchQueueStatsRecorder> {
+  QueueStatsRecorder(std::string_view name) noexcept;
+  ~QueueStatsRecorder() noexcept override;
+
+ public: // IDispatchQueueStatsRecorder
+  void RecordPost(size_t queueDepth) noexcept override;
+  void RecordInvoke(
+      std::chrono::steady_clock::duration waitTime,
+      std::chrono::steady_clock::duration executionTime) noexcept override;
+  void RecordCancel() noexcept override;
+  void RecordYield() noexcept override;
+  DispatchQueueStats GetStats() noexcept override;
+
+ public:
+  //! Add a task to the number of waiting tasks and return the new number.
+  //! The queue calls it for each posted instrumented task instead of counting its tasks under the queue lock.
+  //! Tasks posted before the instrumentation was enabled are not counted.
+  size_t AddWaitingTask() noexcept;
+
+  //! Remove a task from the number of waiting tasks when it is invoked or canceled.
+  void RemoveWaitingTask() noexcept;
+
+ private:
+  const std::string m_name;
+  std::atomic<uint64_t> m_postedTaskCount{0};
+  std::atomic<uint64_t> m_invokedTaskCount{0};
+  std::atomic<uint64_t> m_canceledTaskCount{0};
+  std::atomic<uint64_t> m_yieldCount{0};
+  std::atomic<size_t> m_maxQueueDepth{0};
+  std::atomic<size_t> m_waitingTaskCount{0};
+  DurationHistogramRecorder m_waitTime;
+  DurationHistogramRecorder m_executionTime;
+};
+
+//! Process-wide list of the live stats recorders.
+struct QueueStatsRegistry {
+  static QueueStatsRegistry &Instance() noexcept;
+
+  void Register(QueueStatsRecorder *recorder) noexcept;
+  void Unregister(QueueStatsRecorder *recorder) noexcept;
+  std::vector<DispatchQueueStats> GetAllStats() noexcept;
+
+  static std::string ToJson(std::vector<DispatchQueueStats> const &stats) noexcept;
+
+ private:
+  std::mutex m_mutex;
+  std::vector<QueueStatsRecorder *> m_recorders;
+};
+
+//! Dispatch task wrapper that records the task wait and execution time.
+//! It forwards the cancellation to the wrapped task.
+struct InstrumentedTask final
+    : Mso::UnknownObject<
+          DispatchTaskRefCountPolicy,
+          Mso::QueryCastHidden<Mso::IVoidFunctor>,
+          Mso::ICancellationListener> {
+  InstrumentedTask(DispatchTask &&task, Mso::CntPtr<QueueStatsRecorder> &&stats) noexcept;
+
+  void Invoke() noexcept override;
+  void OnCancel() noexcept override;
+
+ private:
+  DispatchTask m_task;
+  const Mso::CntPtr<QueueStatsRecorder> m_stats;
+  const std::chrono::steady_clock::time_point m_postTime;
+};
+
+} // namespace Mso
@@ -7,8 +7,9 @@ namespace Mso {
 
 TaskContext::TaskContext(
     IDispatchQueueService *queue,
-    std::optional<std::chrono::steady_clock::time_point> endTime) noexcept
-    : m_prevContext{tls_context}, m_queue{queue}, m_endTime{endTime} {
+    std::optional<std::chrono::steady_clock::time_point> endTime,
+    DispatchTaskPriority priority) noexcept
+    : m_prevContext{tls_context}, m_queue{queue}, m_endTime{endTime}, m_priority{priority} {
   tls_context = this;
 }
 
@@ -24,6 +25,10 @@ DispatchTask TaskContext::TakeNextDeferredTask() noexcept {
   return m_readIndex < m_deferQueue.size() ? std::move(m_deferQueue[m_readIndex++]) : DispatchTask{};
 }
 
+DispatchTaskPriority TaskContext::Priority() const noexcept {
+  return m_priority;
+}
+
 /*static*/ TaskContext *TaskContext::CurrentContext() noexcept {
   return tls_context;
 }
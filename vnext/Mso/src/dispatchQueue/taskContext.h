@@ -11,11 +11,15 @@ namespace Mso {
 //! Establishes a unique-per-thread task execution context.
 //! Manages execution of deferred tasks.
 struct TaskContext {
-  TaskContext(IDispatchQueueService *queue, std::optional<std::chrono::steady_clock::time_point> endTime) noexcept;
+  TaskContext(
+      IDispatchQueueService *queue,
+      std::optional<std::chrono::steady_clock::time_point> endTime,
+      DispatchTaskPriority priority = DispatchTaskPriority::Normal) noexcept;
   ~TaskContext() noexcept;
 
   void Defer(DispatchTask &&task) noexcept;
   DispatchTask TakeNextDeferredTask() noexcept;
+  DispatchTaskPriority Priority() const noexcept;
   static TaskContext *CurrentContext() noexcept;
   static IDispatchQueueService *CurrentQueue() noexcept;
 
@@ -26,6 +30,7 @@ struct TaskContext {
   size_t m_readIndex{0};
   IDispatchQueueService *m_queue;
   std::optional<std::chrono::steady_clock::time_point> m_endTime;
+  DispatchTaskPriority m_priority;
 };
 
 } // namespace Mso
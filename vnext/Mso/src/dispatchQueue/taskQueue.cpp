@@ -97,4 +97,106 @@ bool TaskQueue::IsEmpty() const noexcept {
   return m_readBuffer.IsEmpty() && m_writeBuffer.empty();
 }
 
+//=============================================================================
+// LockFreeTaskQueue implementation.
+//=============================================================================
+
+LockFreeTaskQueue::LockFreeTaskQueue(IUnknown *owner) noexcept : m_owner{owner} {}
+
+LockFreeTaskQueue::~LockFreeTaskQueue() noexcept {
+  VerifyElseCrashSz(IsEmpty(), "Queue must be empty before destruction.");
+}
+
+void LockFreeTaskQueue::Enqueue(DispatchTask &&task) noexcept {
+  // Size is incremented before the node is visible to the consumer, so the consumer never decrements it below zero.
+  if (m_size.fetch_add(1) == 0) {
+    m_owner->AddRef();
+  }
+
+  Node *node = new Node{};
+  VerifyElseCrashSz(node, "Cannot allocate the task queue node.");
+  node->Task = std::move(task);
+  PushNode(node);
+  m_enqueuedCount.fetch_add(1, std::memory_order_release);
+}
+
+bool LockFreeTaskQueue::TryDequeue(/*out*/ DispatchTask &task) noexcept {
+  if (Node *node = TryPopNode()) {
+    task = std::move(node->Task);
+    delete node;
+    m_dequeuedCount.fetch_add(1, std::memory_order_relaxed);
+    if (m_size.fetch_sub(1) == 1) {
+      m_owner->Release();
+    }
+
+    return true;
+  }
+
+  return false;
+}
+
+bool LockFreeTaskQueue::DequeueAll(/*out*/ std::vector<DispatchTask> &tasks) noexcept {
+  bool result{false};
+  DispatchTask task;
+  while (TryDequeue(/*out*/ task)) {
+    tasks.push_back(std::move(task));
+    result = true;
+  }
+
+  return result;
+}
+
+size_t LockFreeTaskQueue::Size() const noexcept {
+  // The consumer can dequeue a linked node before its producer increments the m_enqueuedCount.
+  size_t dequeuedCount = m_dequeuedCount.load(std::memory_order_relaxed);
+  size_t enqueuedCount = m_enqueuedCount.load(std::memory_order_acquire);
+  return enqueuedCount > dequeuedCount ? enqueuedCount - dequeuedCount : 0;
+}
+
+bool LockFreeTaskQueue::IsEmpty() const noexcept {
+  return m_size.load() == 0;
+}
+
+void LockFreeTaskQueue::PushNode(Node *node) noexcept {
+  Node *prevHead = m_head.exchange(node, std::memory_order_acq_rel);
+  prevHead->Next.store(node, std::memory_order_release);
+}
+
+LockFreeTaskQueue::Node *LockFreeTaskQueue::TryPopNode() noexcept {
+  Node *tail = m_tail;
+  Node *next = tail->Next.load(std::memory_order_acquire);
+
+  // Skip the stub node.
+  if (tail == &m_stub) {
+    if (!next) {
+      return nullptr;
+    }
+
+    m_tail = next;
+    tail = next;
+    next = next->Next.load(std::memory_order_acquire);
+  }
+
+  if (next) {
+    m_tail = next;
+    return tail;
+  }
+
+  // The tail is the last linked node. If it is not the head, then a producer has not linked its node yet.
+  if (tail != m_head.load(std::memory_order_acquire)) {
+    return nullptr;
+  }
+
+  // Push back the stub node to be able to return the last node.
+  m_stub.Next.store(nullptr, std::memory_order_relaxed);
+  PushNode(&m_stub);
+  next = tail->Next.load(std::memory_order_acquire);
+  if (next) {
+    m_tail = next;
+    return tail;
+  }
+
+  return nullptr;
+}
+
 } // namespace Mso
@@ -3,8 +3,10 @@
 
 #pragma once
 
+#include <atomic>
 #include <vector>
 #include "dispatchQueue/dispatchQueue.h"
+#include "memoryApi/smallBlockAllocator.h"
 #include "threadMutex.h"
 
 namespace Mso {
@@ -55,4 +57,53 @@ struct TaskQueue {
   Mso::CntPtr<IUnknown> m_strongOwnerPtr; // Keep strong reference to the owner when queu is not empty;
 };
 
+//! Intrusive multi-producer single-consumer queue that enqueues items without taking a lock.
+//! Enqueue can be called from any thread concurrently. TryDequeue and DequeueAll must not be called concurrently.
+//!
+//! Each task is stored in its own node allocated from the small block pool. Producers atomically exchange the head
+//! node and then link the previous head to the new node. The consumer follows the links starting from the tail node.
+//! While a producer is between the exchange and the link, the consumer cannot see its node and all nodes after it.
+//! Size() counts only the tasks whose Enqueue has returned.
+struct LockFreeTaskQueue {
+  LockFreeTaskQueue(IUnknown *owner) noexcept;
+
+  ~LockFreeTaskQueue() noexcept;
+
+  // Prohibit copy and move
+  LockFreeTaskQueue(LockFreeTaskQueue const &other) = delete;
+  LockFreeTaskQueue &operator=(LockFreeTaskQueue const &other) = delete;
+
+  void Enqueue(DispatchTask &&task) noexcept;
+  bool TryDequeue(DispatchTask &task) noexcept;
+  bool DequeueAll(/*out*/ std::vector<DispatchTask> &tasks) noexcept;
+  size_t Size() const noexcept;
+  bool IsEmpty() const noexcept;
+
+ private:
+  struct Node {
+    static void *operator new(size_t size) noexcept {
+      return SmallBlockAllocator::Allocate(size);
+    }
+
+    static void operator delete(void *ptr) noexcept {
+      SmallBlockAllocator::Deallocate(ptr);
+    }
+
+    std::atomic<Node *> Next{nullptr};
+    DispatchTask Task;
+  };
+
+  void PushNode(Node *node) noexcept;
+  Node *TryPopNode() noexcept;
+
+ private:
+  Node m_stub; // To separate head and tail when the queue is empty.
+  std::atomic<Node *> m_head{&m_stub}; // Producers add nodes here.
+  Node *m_tail{&m_stub}; // Consumer removes nodes from here.
+  std::atomic<size_t> m_size{0}; // Includes the nodes that are not linked yet.
+  std::atomic<size_t> m_enqueuedCount{0}; // Incremented after the node is linked.
+  std::atomic<size_t> m_dequeuedCount{0};
+  IUnknown *m_owner; // The owner is AddRef-ed while the queue is not empty.
+};
+
 } // namespace Mso
@@ -4,8 +4,6 @@
 #include "dispatchQueue/dispatchQueue.h"
 #include "queueService.h"
 
-using namespace std::chrono_literals;
-
 namespace Mso {
 
 struct ThreadPoolWorkDeleter {
@@ -80,7 +78,7 @@ ThreadPoolSchedulerWin::~ThreadPoolSchedulerWin() noexcept {
   ThreadPoolSchedulerWin *self = static_cast<ThreadPoolSchedulerWin *>(context);
 
   if (auto queue = self->m_queue.GetStrongPtr()) {
-    auto endTime = std::chrono::steady_clock::now() + 100ms;
+    auto endTime = std::chrono::steady_clock::now() + DispatchQueueStatic::DefaultTimeSlice;
     DispatchTask task;
     while (queue->TryDequeTask(task)) {
       ThreadAccessGuard guard{self};
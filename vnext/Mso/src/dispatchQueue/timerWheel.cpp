@@ -0,0 +1,250 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include "timerWheel.h"
+#include <algorithm>
+#include <thread>
+
+namespace Mso {
+
+//=============================================================================
+// TimerWheelEntry implementation
+//=============================================================================
+
+TimerWheelEntry::TimerWheelEntry(
+    TimerWheel &wheel,
+    Mso::WeakPtr<IDispatchQueueService> &&queue,
+    DispatchTask &&task) noexcept
+    : m_wheel{wheel}, m_queue{std::move(queue)}, m_task{std::move(task)} {}
+
+bool TimerWheelEntry::Cancel() noexcept {
+  return m_wheel.Cancel(*this);
+}
+
+//=============================================================================
+// TimerWheel implementation
+//=============================================================================
+
+TimerWheel::TimerWheel() noexcept : m_startTime{std::chrono::steady_clock::now()} {
+  // The thread is detached because the wheel is never destroyed.
+  std::thread([this]() noexcept { Run(); }).detach();
+}
+
+/*static*/ TimerWheel &TimerWheel::Instance() noexcept {
+  static TimerWheel *instance{new TimerWheel()};
+  return *instance;
+}
+
+Mso::CntPtr<IDispatchTimer> TimerWheel::Schedule(
+    Mso::WeakPtr<IDispatchQueueService> &&queue,
+    std::chrono::steady_clock::time_point dueTime,
+    DispatchTask &&task) noexcept {
+  auto entry = Mso::Make<TimerWheelEntry>(*this, std::move(queue), std::move(task));
+  bool shouldWakeUp{false};
+  {
+    std::lock_guard lock{m_mutex};
+    entry->m_dueTick = std::max(ToDueTick(dueTime), m_currentTick);
+    entry->AddRef();
+    AddEntry(entry.Get());
+
+    // Wake up the timer thread only if it sleeps past the new due tick.
+    if (entry->m_dueTick < m_wakeUpTick) {
+      m_wakeUpTick = entry->m_dueTick;
+      shouldWakeUp = true;
+    }
+  }
+
+  if (shouldWakeUp) {
+    m_wakeUpCondition.notify_one();
+  }
+
+  return entry;
+}
+
+bool TimerWheel::Cancel(TimerWheelEntry &entry) noexcept {
+  DispatchTask task;
+  {
+    std::lock_guard lock{m_mutex};
+    if (!entry.m_isScheduled) {
+      return false;
+    }
+
+    RemoveEntry(&entry);
+    task = std::move(entry.m_task);
+  }
+
+  // Release the wheel reference after the entry is removed. The caller holds another reference to the entry.
+  entry.Release();
+  CancelTask(std::move(task));
+  return true;
+}
+
+void TimerWheel::Run() noexcept {
+  std::unique_lock lock{m_mutex};
+  for (;;) {
+    std::vector<Mso::CntPtr<TimerWheelEntry>> dueEntries;
+    uint64_t currentTick = CurrentTick();
+    for (std::optional<uint64_t> nextTick = NextEventTick(); nextTick && *nextTick <= currentTick;
+         nextTick = NextEventTick()) {
+      ProcessTick(*nextTick, /*out*/ dueEntries);
+      m_currentTick = *nextTick + 1;
+    }
+
+    // There are no events up to the current tick. Skip it to reduce the number of cascades for the new timers.
+    m_currentTick = std::max(m_currentTick, currentTick + 1);
+
+    if (!dueEntries.empty()) {
+      lock.unlock();
+      for (auto &entry : dueEntries) {
+        if (auto queue = entry->m_queue.GetStrongPtr()) {
+          queue->Post(std::move(entry->m_task));
+        } else {
+          CancelTask(std::move(entry->m_task));
+        }
+      }
+
+      dueEntries.clear();
+      lock.lock();
+      continue;
+    }
+
+    if (std::optional<uint64_t> nextTick = NextEventTick()) {
+      m_wakeUpTick = *nextTick;
+      m_wakeUpCondition.wait_until(lock, ToTime(*nextTick));
+    } else {
+      m_wakeUpTick = UINT64_MAX;
+      m_wakeUpCondition.wait(lock);
+    }
+  }
+}
+
+void TimerWheel::AddEntry(TimerWheelEntry *entry) noexcept {
+  // Timers that do not fit into the wheel are put into the last level slot that is processed the last. They are
+  // added again when the slot is cascaded.
+  uint64_t dueTick = entry->m_dueTick;
+  uint64_t delta = dueTick - std::min(dueTick, m_currentTick);
+  uint32_t level{0};
+  while (level < LevelCount - 1 && delta >= (uint64_t{1} << (SlotBits * (level + 1)))) {
+    ++level;
+  }
+
+  if (delta >= (uint64_t{1} << (SlotBits * LevelCount))) {
+    dueTick = m_currentTick + (uint64_t{1} << (SlotBits * LevelCount)) - 1;
+  }
+
+  uint32_t slot = static_cast<uint32_t>((dueTick >> (SlotBits * level)) & (SlotCount - 1));
+  TimerWheelEntry *&head = m_slots[level][slot];
+  entry->m_level = level;
+  entry->m_slot = slot;
+  entry->m_prev = nullptr;
+  entry->m_next = head;
+  if (head) {
+    head->m_prev = entry;
+  }
+
+  head = entry;
+  entry->m_isScheduled = true;
+  m_nonEmptySlots[level] |= uint64_t{1} << slot;
+}
+
+void TimerWheel::RemoveEntry(TimerWheelEntry *entry) noexcept {
+  TimerWheelEntry *&head = m_slots[entry->m_level][entry->m_slot];
+  if (entry->m_prev) {
+    entry->m_prev->m_next = entry->m_next;
+  } else {
+    head = entry->m_next;
+  }
+
+  if (entry->m_next) {
+    entry->m_next->m_prev = entry->m_prev;
+  }
+
+  if (!head) {
+    m_nonEmptySlots[entry->m_level] &= ~(uint64_t{1} << entry->m_slot);
+  }
+
+  entry->m_prev = nullptr;
+  entry->m_next = nullptr;
+  entry->m_isScheduled = false;
+}
+
+std::optional<uint64_t> TimerWheel::NextEventTick() const noexcept {
+  // A slot on level L is processed at the first tick after the current tick that has zeros in its lower L * SlotBits
+  // bits, and the slot index in the next SlotBits bits.
+  std::optional<uint64_t> result;
+  for (uint32_t level = 0; level < LevelCount; ++level) {
+    uint64_t nonEmptySlots = m_nonEmptySlots[level];
+    if (!nonEmptySlots) {
+      continue;
+    }
+
+    uint32_t shift = SlotBits * level;
+    uint64_t lowerMask = (uint64_t{1} << shift) - 1;
+    uint64_t base = (m_currentTick >> shift) + ((m_currentTick & lowerMask) ? 1 : 0);
+    uint32_t baseSlot = static_cast<uint32_t>(base & (SlotCount - 1));
+    for (uint32_t distance = 0; distance < SlotCount; ++distance) {
+      if (nonEmptySlots & (uint64_t{1} << ((baseSlot + distance) & (SlotCount - 1)))) {
+        uint64_t tick = (base + distance) << shift;
+        if (!result || tick < *result) {
+          result = tick;
+        }
+
+        break;
+      }
+    }
+  }
+
+  return result;
+}
+
+void TimerWheel::ProcessTick(uint64_t tick, /*out*/ std::vector<Mso::CntPtr<TimerWheelEntry>> &dueEntries) noexcept {
+  m_currentTick = tick;
+
+  // Cascade the higher level slots to the lower levels.
+  for (uint32_t level = 1; level < LevelCount; ++level) {
+    uint32_t shift = SlotBits * level;
+    if (tick & ((uint64_t{1} << shift) - 1)) {
+      break;
+    }
+
+    uint32_t slot = static_cast<uint32_t>((tick >> shift) & (SlotCount - 1));
+    TimerWheelEntry *head = std::exchange(m_slots[level][slot], nullptr);
+    m_nonEmptySlots[level] &= ~(uint64_t{1} << slot);
+    while (head) {
+      TimerWheelEntry *entry = head;
+      head = head->m_next;
+      AddEntry(entry);
+    }
+  }
+
+  uint32_t slot = static_cast<uint32_t>(tick & (SlotCount - 1));
+  while (TimerWheelEntry *entry = m_slots[0][slot]) {
+    RemoveEntry(entry);
+    dueEntries.push_back(Mso::CntPtr<TimerWheelEntry>{entry, Mso::AttachTag});
+  }
+}
+
+uint64_t TimerWheel::ToDueTick(std::chrono::steady_clock::time_point dueTime) const noexcept {
+  // Round up to never post tasks before their due time.
+  auto ticks = std::chrono::ceil<std::chrono::milliseconds>(dueTime - m_startTime) / TickDuration;
+  return static_cast<uint64_t>(std::max<decltype(ticks)>(ticks, 0));
+}
+
+uint64_t TimerWheel::CurrentTick() const noexcept {
+  auto ticks = std::chrono::floor<std::chrono::milliseconds>(std::chrono::steady_clock::now() - m_startTime) /
+      TickDuration;
+  return static_cast<uint64_t>(std::max<decltype(ticks)>(ticks, 0));
+}
+
+std::chrono::steady_clock::time_point TimerWheel::ToTime(uint64_t tick) const noexcept {
+  return m_startTime + tick * TickDuration;
+}
+
+/*static*/ void TimerWheel::CancelTask(DispatchTask &&task) noexcept {
+  DispatchTask taskToCancel{std::move(task)};
+  if (auto cancellation = query_cast<ICancellationListener *>(taskToCancel.Get())) {
+    cancellation->OnCancel();
+  }
+}
+
+} // namespace Mso
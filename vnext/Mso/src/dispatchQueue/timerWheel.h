@@ -0,0 +1,97 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#pragma once
+
+#include <array>
+#include <condition_variable>
+#include <mutex>
+#include <optional>
+#include <vector>
+#include "dispatchQueue/dispatchQueue.h"
+
+namespace Mso {
+
+// Forward declarations
+struct TimerWheel;
+
+//! A task waiting in the TimerWheel to be posted to a dispatch queue.
+//! The entry is linked into a TimerWheel slot while it is scheduled. All fields except the constant ones
+//! are protected by the TimerWheel mutex.
+struct TimerWheelEntry final : Mso::UnknownObject<IDispatchTimer> {
+  TimerWheelEntry(TimerWheel &wheel, Mso::WeakPtr<IDispatchQueueService> &&queue, DispatchTask &&task) noexcept;
+
+ public: // IDispatchTimer
+  bool Cancel() noexcept override;
+
+ private:
+  friend TimerWheel;
+
+  TimerWheel &m_wheel;
+  Mso::WeakPtr<IDispatchQueueService> m_queue;
+  DispatchTask m_task;
+  uint64_t m_dueTick{0};
+  TimerWheelEntry *m_prev{nullptr};
+  TimerWheelEntry *m_next{nullptr};
+  uint32_t m_level{0};
+  uint32_t m_slot{0};
+  bool m_isScheduled{false};
+};
+
+//! Hierarchical timer wheel shared by all dispatch queues to post delayed tasks.
+//! Each of the LevelCount levels has SlotCount slots. A level 0 slot covers one tick, and a slot on the next level
+//! covers all slots of the previous level. A timer is added to the lowest level that can fit its due time, and it is
+//! moved to the lower levels as the wheel turns. It gives us O(1) insert and cancel operations.
+//! The wheel is driven by a single thread that sleeps until the next non-empty slot is due.
+//! Due tasks are posted to their queues. The tasks are canceled if their queues are already destroyed.
+//! The process-wide instance is intentionally leaked: its thread is never joined, because joining it from a static
+//! destructor at DLL unload or process exit can deadlock under the loader lock.
+struct TimerWheel {
+  TimerWheel() noexcept;
+  ~TimerWheel() = delete;
+
+  TimerWheel(TimerWheel const &other) = delete;
+  TimerWheel &operator=(TimerWheel const &other) = delete;
+
+  static TimerWheel &Instance() noexcept;
+
+  //! Schedule posting the task to the queue at the due time.
+  Mso::CntPtr<IDispatchTimer> Schedule(
+      Mso::WeakPtr<IDispatchQueueService> &&queue,
+      std::chrono::steady_clock::time_point dueTime,
+      DispatchTask &&task) noexcept;
+
+  //! Remove the entry from the wheel and cancel its task. It returns false if the entry is not scheduled.
+  bool Cancel(TimerWheelEntry &entry) noexcept;
+
+  constexpr static uint32_t SlotBits{6};
+  constexpr static uint32_t SlotCount{1u << SlotBits};
+  constexpr static uint32_t LevelCount{4};
+  constexpr static std::chrono::milliseconds TickDuration{1};
+
+ private:
+  void Run() noexcept;
+
+  // Methods below must be called under the m_mutex lock.
+  void AddEntry(TimerWheelEntry *entry) noexcept;
+  void RemoveEntry(TimerWheelEntry *entry) noexcept;
+  std::optional<uint64_t> NextEventTick() const noexcept;
+  void ProcessTick(uint64_t tick, /*out*/ std::vector<Mso::CntPtr<TimerWheelEntry>> &dueEntries) noexcept;
+
+  uint64_t ToDueTick(std::chrono::steady_clock::time_point dueTime) const noexcept;
+  uint64_t CurrentTick() const noexcept;
+  std::chrono::steady_clock::time_point ToTime(uint64_t tick) const noexcept;
+
+  static void CancelTask(DispatchTask &&task) noexcept;
+
+ private:
+  const std::chrono::steady_clock::time_point m_startTime;
+  std::mutex m_mutex;
+  std::condition_variable m_wakeUpCondition;
+  std::array<std::array<TimerWheelEntry *, SlotCount>, LevelCount> m_slots{};
+  std::array<uint64_t, LevelCount> m_nonEmptySlots{}; // One bit per non-empty slot.
+  uint64_t m_currentTick{0}; // All ticks before the current tick are processed.
+  uint64_t m_wakeUpTick{UINT64_MAX}; // Tick when the timer thread wakes up.
+};
+
+} // namespace Mso
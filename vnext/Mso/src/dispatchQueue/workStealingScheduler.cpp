@@ -0,0 +1,340 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include "dispatchQueue/dispatchQueue.h"
+#include "queueService.h"
+
+namespace Mso {
+
+struct WorkStealingScheduler;
+
+//! Portable thread pool shared by all work stealing schedulers.
+//! Each worker thread has its own deque of work items. Work posted from a worker thread goes to its own deque,
+//! and work posted from other threads goes to the shared injection queue. Worker threads take work from the back of
+//! their own deque, then from the injection queue, and then steal from the front of other workers' deques.
+//! Idle workers are parked on a condition variable until new work arrives.
+//! The process-wide instance is intentionally leaked: its worker threads are never joined, because joining them from
+//! a static destructor at DLL unload or process exit can deadlock under the loader lock.
+struct WorkStealingThreadPool {
+  WorkStealingThreadPool(uint32_t threadCount) noexcept;
+  ~WorkStealingThreadPool() = delete;
+
+  WorkStealingThreadPool(WorkStealingThreadPool const &other) = delete;
+  WorkStealingThreadPool &operator=(WorkStealingThreadPool const &other) = delete;
+
+  static WorkStealingThreadPool &Instance() noexcept;
+
+  //! Submit work for execution. The yielded work that used up its time slice is always added to the injection
+  //! queue to let work in the local deque make progress.
+  void Submit(Mso::CntPtr<WorkStealingScheduler> &&work, bool isYielded) noexcept;
+
+  uint32_t ThreadCount() const noexcept;
+
+ private:
+  struct Worker {
+    std::mutex Mutex;
+    std::deque<Mso::CntPtr<WorkStealingScheduler>> Deque;
+  };
+
+  void RunWorker(uint32_t workerIndex) noexcept;
+  bool TryTakeWork(uint32_t workerIndex, /*out*/ Mso::CntPtr<WorkStealingScheduler> &work) noexcept;
+  void WakeUpWorker() noexcept;
+
+ private:
+  std::vector<std::unique_ptr<Worker>> m_workers;
+  std::mutex m_injectionMutex;
+  std::deque<Mso::CntPtr<WorkStealingScheduler>> m_injectionQueue;
+  std::mutex m_parkMutex;
+  std::condition_variable m_parkCondition;
+  std::atomic<uint32_t> m_parkedCount{0};
+  std::atomic<size_t> m_pendingCount{0};
+
+  inline static thread_local WorkStealingThreadPool *tls_pool{nullptr};
+  inline static thread_local uint32_t tls_workerIndex{0};
+};
+
+//! Scheduler for a dispatch queue on top of the WorkStealingThreadPool.
+//! It limits the number of pool threads concurrently used by the queue, and
+//! invokes queue tasks for up to the time slice before yielding the worker thread.
+struct WorkStealingScheduler : Mso::UnknownObject<IDispatchQueueScheduler> {
+  WorkStealingScheduler(uint32_t maxThreads, std::chrono::milliseconds timeSlice) noexcept;
+  ~WorkStealingScheduler() noexcept override;
+
+  //! Called by WorkStealingThreadPool to invoke queue tasks.
+  void RunWork() noexcept;
+
+ public: // IDispatchQueueScheduler
+  void IntializeScheduler(Mso::WeakPtr<IDispatchQueueService> &&queue) noexcept override;
+  bool HasThreadAccess() noexcept override;
+  bool IsSerial() noexcept override;
+  void Post() noexcept override;
+  void Shutdown() noexcept override;
+  void AwaitTermination() noexcept override;
+
+ private:
+  void PostWork(bool isYielded) noexcept;
+  void OnWorkCompleted() noexcept;
+
+  struct ThreadAccessGuard {
+    ThreadAccessGuard(WorkStealingScheduler *scheduler) noexcept;
+    ~ThreadAccessGuard() noexcept;
+
+    static bool HasThreadAccess(WorkStealingScheduler *scheduler) noexcept;
+
+   private:
+    WorkStealingScheduler *m_prevScheduler{nullptr};
+    inline static thread_local WorkStealingScheduler *tls_scheduler{nullptr};
+  };
+
+ private:
+  Mso::WeakPtr<IDispatchQueueService> m_queue;
+  const uint32_t m_maxThreads{1};
+  const std::chrono::milliseconds m_timeSlice;
+  std::atomic<uint32_t> m_usedThreads{0};
+  std::mutex m_terminationMutex;
+  std::condition_variable m_terminationCondition;
+};
+
+//=============================================================================
+// WorkStealingThreadPool implementation
+//=============================================================================
+
+WorkStealingThreadPool::WorkStealingThreadPool(uint32_t threadCount) noexcept {
+  m_workers.reserve(threadCount);
+  for (uint32_t i = 0; i < threadCount; ++i) {
+    m_workers.push_back(std::make_unique<Worker>());
+  }
+
+  // Start threads after all workers are created because they steal work from each other.
+  // The threads are detached because the pool is never destroyed.
+  for (uint32_t i = 0; i < threadCount; ++i) {
+    std::thread([this, i]() noexcept { RunWorker(i); }).detach();
+  }
+}
+
+/*static*/ WorkStealingThreadPool &WorkStealingThreadPool::Instance() noexcept {
+  static WorkStealingThreadPool *instance{
+      new WorkStealingThreadPool{std::max(2u, std::thread::hardware_concurrency())}};
+  return *instance;
+}
+
+uint32_t WorkStealingThreadPool::ThreadCount() const noexcept {
+  return static_cast<uint32_t>(m_workers.size());
+}
+
+void WorkStealingThreadPool::Submit(Mso::CntPtr<WorkStealingScheduler> &&work, bool isYielded) noexcept {
+  if (tls_pool == this && !isYielded) {
+    auto &worker = *m_workers[tls_workerIndex];
+    std::lock_guard lock{worker.Mutex};
+    worker.Deque.push_back(std::move(work));
+  } else {
+    std::lock_guard lock{m_injectionMutex};
+    m_injectionQueue.push_back(std::move(work));
+  }
+
+  // The pending count is incremented after the work is added to make sure that a worker can find it.
+  m_pendingCount.fetch_add(1);
+  if (m_parkedCount.load() > 0) {
+    WakeUpWorker();
+  }
+}
+
+void WorkStealingThreadPool::WakeUpWorker() noexcept {
+  // Notify under the lock to avoid missed signals in case if a worker is between
+  // checking the pending count and starting to wait.
+  std::lock_guard lock{m_parkMutex};
+  m_parkCondition.notify_one();
+}
+
+bool WorkStealingThreadPool::TryTakeWork(
+    uint32_t workerIndex,
+    /*out*/ Mso::CntPtr<WorkStealingScheduler> &work) noexcept {
+  auto takeWork = [&](std::deque<Mso::CntPtr<WorkStealingScheduler>> &deque, bool fromBack) noexcept {
+    if (deque.empty()) {
+      return false;
+    }
+
+    if (fromBack) {
+      work = std::move(deque.back());
+      deque.pop_back();
+    } else {
+      work = std::move(deque.front());
+      deque.pop_front();
+    }
+
+    m_pendingCount.fetch_sub(1);
+    return true;
+  };
+
+  {
+    auto &worker = *m_workers[workerIndex];
+    std::lock_guard lock{worker.Mutex};
+    if (takeWork(worker.Deque, /*fromBack:*/ true)) {
+      return true;
+    }
+  }
+
+  {
+    std::lock_guard lock{m_injectionMutex};
+    if (takeWork(m_injectionQueue, /*fromBack:*/ false)) {
+      return true;
+    }
+  }
+
+  const uint32_t workerCount = ThreadCount();
+  for (uint32_t i = 1; i < workerCount; ++i) {
+    auto &victim = *m_workers[(workerIndex + i) % workerCount];
+    std::lock_guard lock{victim.Mutex};
+    if (takeWork(victim.Deque, /*fromBack:*/ false)) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+void WorkStealingThreadPool::RunWorker(uint32_t workerIndex) noexcept {
+  tls_pool = this;
+  tls_workerIndex = workerIndex;
+
+  for (;;) {
+    Mso::CntPtr<WorkStealingScheduler> work;
+    if (TryTakeWork(workerIndex, /*out*/ work)) {
+      work->RunWork();
+      continue;
+    }
+
+    std::unique_lock lock{m_parkMutex};
+    ++m_parkedCount;
+    m_parkCondition.wait(lock, [this]() noexcept { return m_pendingCount.load() > 0; });
+    --m_parkedCount;
+  }
+}
+
+//=============================================================================
+// WorkStealingScheduler implementation
+//=============================================================================
+
+WorkStealingScheduler::WorkStealingScheduler(uint32_t maxThreads, std::chrono::milliseconds timeSlice) noexcept
+    : m_maxThreads{maxThreads == 0 ? WorkStealingThreadPool::Instance().ThreadCount() : maxThreads},
+      m_timeSlice{timeSlice} {}
+
+WorkStealingScheduler::~WorkStealingScheduler() noexcept {
+  AwaitTermination();
+}
+
+void WorkStealingScheduler::RunWork() noexcept {
+  if (auto queue = m_queue.GetStrongPtr()) {
+    auto endTime = std::chrono::steady_clock::now() + m_timeSlice;
+    DispatchTask task;
+    while (queue->TryDequeTask(task)) {
+      ThreadAccessGuard guard{this};
+      queue->InvokeTask(std::move(task), endTime);
+
+      if (std::chrono::steady_clock::now() > endTime) {
+        break;
+      }
+    }
+
+    OnWorkCompleted();
+
+    if (queue->HasTasks()) {
+      PostWork(/*isYielded:*/ true);
+    }
+  } else {
+    OnWorkCompleted();
+  }
+}
+
+void WorkStealingScheduler::OnWorkCompleted() noexcept {
+  {
+    std::lock_guard lock{m_terminationMutex};
+    --m_usedThreads; // We finished using this thread.
+  }
+
+  m_terminationCondition.notify_all();
+}
+
+void WorkStealingScheduler::IntializeScheduler(Mso::WeakPtr<IDispatchQueueService> &&queue) noexcept {
+  m_queue = std::move(queue);
+}
+
+bool WorkStealingScheduler::HasThreadAccess() noexcept {
+  return ThreadAccessGuard::HasThreadAccess(this);
+}
+
+bool WorkStealingScheduler::IsSerial() noexcept {
+  return m_maxThreads == 1;
+}
+
+void WorkStealingScheduler::Post() noexcept {
+  PostWork(/*isYielded:*/ false);
+}
+
+void WorkStealingScheduler::PostWork(bool isYielded) noexcept {
+  //! Submit work to the thread pool if number of used threads is below m_maxThreads
+  uint32_t usedThreads = m_usedThreads.load(std::memory_order_relaxed);
+  do {
+    if (usedThreads == m_maxThreads) {
+      return;
+    }
+  } while (!m_usedThreads.compare_exchange_weak(
+      usedThreads, usedThreads + 1, std::memory_order_release, std::memory_order_relaxed));
+
+  WorkStealingThreadPool::Instance().Submit(Mso::CntPtr{this}, isYielded);
+}
+
+void WorkStealingScheduler::Shutdown() noexcept {
+  // It is not used by this scheduler
+}
+
+void WorkStealingScheduler::AwaitTermination() noexcept {
+  // We cannot wait for our own work to complete from inside of it.
+  if (HasThreadAccess()) {
+    return;
+  }
+
+  std::unique_lock lock{m_terminationMutex};
+  m_terminationCondition.wait(lock, [this]() noexcept { return m_usedThreads.load() == 0; });
+}
+
+//=============================================================================
+// WorkStealingScheduler::ThreadAccessGuard implementation
+//=============================================================================
+
+WorkStealingScheduler::ThreadAccessGuard::ThreadAccessGuard(WorkStealingScheduler *scheduler) noexcept
+    : m_prevScheduler{tls_scheduler} {
+  tls_scheduler = scheduler;
+}
+
+WorkStealingScheduler::ThreadAccessGuard::~ThreadAccessGuard() noexcept {
+  tls_scheduler = m_prevScheduler;
+}
+
+/*static*/ bool WorkStealingScheduler::ThreadAccessGuard::HasThreadAccess(WorkStealingScheduler *scheduler) noexcept {
+  return tls_scheduler == scheduler;
+}
+
+//=============================================================================
+// DispatchQueueStatic::MakeWorkStealingScheduler implementation
+//=============================================================================
+
+/*static*/ Mso::CntPtr<IDispatchQueueScheduler> DispatchQueueStatic::MakeWorkStealingScheduler(
+    uint32_t maxThreads,
+    std::chrono::milliseconds timeSlice) noexcept {
+  return Mso::Make<WorkStealingScheduler, IDispatchQueueScheduler>(maxThreads, timeSlice);
+}
+
+#if defined(MS_TARGET_POSIX)
+// There is no platform thread pool outside of Windows. Use the work stealing thread pool instead.
+/*static*/ Mso::CntPtr<IDispatchQueueScheduler> DispatchQueueStatic::MakeThreadPoolScheduler(
+    uint32_t maxThreads) noexcept {
+  return MakeWorkStealingScheduler(maxThreads, DefaultTimeSlice);
+}
+#endif
+
+} // namespace Mso
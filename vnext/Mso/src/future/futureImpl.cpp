@@ -3,6 +3,7 @@
 
 #include "futureImpl.h"
 #include <thread>
+#include <utility>
 #include "eventWaitHandle/eventWaitHandle.h"
 #include "future/future.h"
 
@@ -94,7 +95,10 @@ MakeFuture(const FutureTraits &traits, size_t taskSize, _Out_opt_ ByteArrayView
       "taskBuffer pointer must not be null for not zero taskSize",
       0x012ca39b /* tag_blko1 */);
 
-  void *memory = Mso::Memory::FailFast::AllocateEx(memorySize, Mso::Memory::AllocFlags::ShutdownLeak);
+  void *memory = FutureAllocator::Allocate(memorySize);
+  if (memory == nullptr)
+    CrashWithRecoveryOnOOM();
+
   VerifyElseCrashSzTag(IsAligned(memory), "memory for FutureImpl must be aligned.", 0x012ca39d /* tag_blko3 */);
 
   ::new (memory) FutureWeakRef();
@@ -131,6 +135,12 @@ MakeFuture(const FutureTraits &traits, size_t taskSize, _Out_opt_ ByteArrayView
 const FutureImpl *const FuturePackedData::ContinuationInvoked =
     reinterpret_cast<FutureImpl *>(static_cast<uintptr_t>(-1) & ContinuationMask);
 
+// ContinuationAwaiter is a special placeholder address aligned by 8 bytes that we use instead of real continuation
+// address when a coroutine awaits the future. The awaiter is kept in the FutureImpl::m_awaiter field, and it is called
+// in place of posting the continuation. This way co_await does not allocate a continuation future.
+const FutureImpl *const FuturePackedData::ContinuationAwaiter =
+    reinterpret_cast<FutureImpl *>((static_cast<uintptr_t>(-1) & ContinuationMask) - (StateMask + 1));
+
 FutureState FuturePackedData::GetState() const noexcept {
   return static_cast<FutureState>(Value & StateMask);
 }
@@ -329,6 +339,10 @@ void FutureImpl::AddContinuation(Mso::CntPtr<IFuture> &&continuation) noexcept {
           isShared || (contIsShared && contUsesParentValue),
           "AddContinuation called more than once for unique future.",
           0x012ca3c1 /* tag_blkpb */);
+      VerifyElseCrashSzTag(
+          currentContinuation != FuturePackedData::ContinuationAwaiter,
+          "AddContinuation called for awaited future.",
+          0x01605642 /* tag_byfzc */);
     }
 
     //
@@ -376,6 +390,32 @@ void FutureImpl::AddContinuation(Mso::CntPtr<IFuture> &&continuation) noexcept {
   }
 }
 
+bool FutureImpl::TryAddAwaiter(IFutureAwaiter &awaiter) noexcept {
+  VerifyElseCrashSzTag(
+      !IsSet(m_traits.Options, FutureOptions::IsShared),
+      "Awaiter can be added only to unique future.",
+      0x01605643 /* tag_byfzd */);
+
+  FuturePackedData currentData = m_stateAndContinuation.load(std::memory_order_acquire);
+  for (;;) {
+    VerifyElseCrashSzTag(
+        currentData.GetContinuation() == nullptr,
+        "AddContinuation called more than once for unique future.",
+        0x01605644 /* tag_byfze */);
+
+    if (currentData.IsDone()) {
+      return false;
+    }
+
+    // The m_awaiter is published by the compare_exchange_weak. It is read only after the future is completed.
+    m_awaiter = &awaiter;
+    FuturePackedData newData = FuturePackedData::Make(currentData.GetState(), FuturePackedData::ContinuationAwaiter);
+    if (m_stateAndContinuation.compare_exchange_weak(currentData, newData)) {
+      return true;
+    }
+  }
+}
+
 bool FutureImpl::TrySetInvoking(bool crashIfFailed) noexcept {
   // We can start Invoking either from Posting or from Posted states.
   // From Posting state we must do it synchronously, while from Posted it can be done asynchronously.
@@ -672,7 +712,7 @@ bool FutureImpl::TrySetSuccess(bool crashIfFailed) noexcept {
           "Continuation must not be invoked yet.",
           0x012ca3c6 /* tag_blkpg */);
 
-      PostContinuation(Mso::CntPtr<FutureImpl>{continuation, AttachTag});
+      NotifyContinuation(continuation);
 
       return true;
     }
@@ -778,7 +818,7 @@ void FutureImpl::SetFailed() noexcept {
           "Continuation must not be invoked yet.",
           0x012ca3c9 /* tag_blkpj */);
 
-      PostContinuation(Mso::CntPtr<FutureImpl>{continuation, AttachTag});
+      NotifyContinuation(continuation);
 
       return;
     }
@@ -921,6 +961,16 @@ void FutureImpl::PostContinuation(Mso::CntPtr<FutureImpl> &&continuation) noexce
   }
 }
 
+void FutureImpl::NotifyContinuation(FutureImpl *continuation) noexcept {
+  if (continuation == FuturePackedData::ContinuationAwaiter) {
+    // The awaiter may resume a coroutine that destroys the awaiter. The awaiter does not own a reference to this future:
+    // it may be called from the destructor when an abandoned promise cancels the future.
+    std::exchange(m_awaiter, nullptr)->OnFutureCompleted(this);
+  } else {
+    PostContinuation(Mso::CntPtr<FutureImpl>{continuation, AttachTag});
+  }
+}
+
 void FutureImpl::DestroyTask(bool isAfterInvoke) noexcept {
   if (m_taskSize > 0 && m_traits.TaskDestroy) {
     if (!isAfterInvoke || IsSet(m_traits.Options, FutureOptions::DestroyTaskAfterInvoke)) {
@@ -1040,7 +1090,7 @@ void FutureWeakRef::ReleaseWeakRef() const noexcept {
   Debug(VerifyElseCrashSzTag(
       static_cast<int32_t>(weakRefCount) >= 0, "Weak ref count must not be negative.", 0x01605604 /* tag_byfye */));
   if (weakRefCount == 0) {
-    Mso::MakeAllocator::Deallocate(const_cast<FutureWeakRef *>(this));
+    FutureAllocator::Deallocate(const_cast<FutureWeakRef *>(this));
   }
 }
 
@@ -5,11 +5,17 @@
 
 #include "dispatchQueue/dispatchQueue.h"
 #include "future/details/ifuture.h"
+#include "memoryApi/smallBlockAllocator.h"
 #include "object/unknownObject.h"
 
 namespace Mso {
 namespace Futures {
 
+// Allocator for the memory block that has FutureWeakRef, FutureImpl, FutureCallback, value, and task.
+// Continuation chains create and destroy futures at a high rate. The small block pool serves them from per-thread
+// slab caches instead of the heap.
+using FutureAllocator = Mso::SmallBlockAllocator;
+
 // The FutureState must be limited to 8 states to ensure that it can be fit into three bits.
 // It allows us to store FutureState along with a continuation pointer in the same atomic variable.
 // This way we can avoid using locks. It also requires that all continuation pointers are aligned by 8 bytes.
@@ -173,6 +179,9 @@ struct FuturePackedData {
   // A fake pointer to indicate that the continuation was already invoked. Must be aligned by 8.
   static const FutureImpl *const ContinuationInvoked;
 
+  // A fake pointer to indicate that the continuation is the FutureImpl::m_awaiter. Must be aligned by 8.
+  static const FutureImpl *const ContinuationAwaiter;
+
  public:
   uintptr_t Value;
 };
@@ -224,6 +233,7 @@ class FutureImpl final : public Mso::QueryCastList<Mso::QueryCastDerived<FutureI
   const ErrorCode &GetError() const noexcept override;
 
   void AddContinuation(Mso::CntPtr<IFuture> &&continuation) noexcept override;
+  bool TryAddAwaiter(IFutureAwaiter &awaiter) noexcept override;
 
   _Success_(
       return ) bool TryStartSetValue(_Out_ ByteArrayView &valueBuffer, bool crashIfFailed = false) noexcept override;
@@ -252,6 +262,7 @@ class FutureImpl final : public Mso::QueryCastList<Mso::QueryCastDerived<FutureI
 
   bool TryPostInternal(FutureImpl *parent, Mso::CntPtr<FutureImpl> &next, bool crashIfFailed = false) noexcept;
   void PostContinuation(Mso::CntPtr<FutureImpl> &&continuation) noexcept;
+  void NotifyContinuation(FutureImpl *continuation) noexcept;
 
   void DestroyTask(bool isAfterInvoke) noexcept;
 
@@ -274,6 +285,9 @@ class FutureImpl final : public Mso::QueryCastList<Mso::QueryCastDerived<FutureI
   // field for two different modes: keeping the continuation graph, and invoking continuation tasks.
   Mso::CntPtr<FutureImpl> m_link;
 
+  // The coroutine awaiter that is stored in place of continuation when the continuation is ContinuationAwaiter.
+  IFutureAwaiter *m_awaiter{nullptr};
+
   ErrorCode m_error;
 
   size_t m_taskSize{0};
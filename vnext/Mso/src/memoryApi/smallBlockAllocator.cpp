@@ -0,0 +1,435 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include "memoryApi/smallBlockAllocator.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <vector>
+#include "memoryApi/memoryApi.h"
+
+namespace Mso {
+namespace Memory {
+
+namespace {
+
+// Each block starts with a header that keeps its size class. It keeps the returned memory 16 byte aligned.
+constexpr size_t BlockHeaderSize{16};
+
+// Size classes use 16 byte steps up to 256 bytes, and 64 byte steps for the bigger blocks.
+constexpr size_t FineGranularity{16};
+constexpr size_t FineMaxBlockSize{256};
+constexpr size_t CoarseGranularity{64};
+constexpr uint32_t FineSizeClassCount{static_cast<uint32_t>(FineMaxBlockSize / FineGranularity)};
+constexpr uint32_t SizeClassCount{
+    FineSizeClassCount + static_cast<uint32_t>((MaxSmallBlockSize - FineMaxBlockSize) / CoarseGranularity)};
+constexpr uint32_t LargeBlockSizeClass{UINT32_MAX};
+
+// Thread caches exchange blocks with the depot in batches to reduce the lock contention.
+// New blocks are carved from a slab that has one batch of blocks.
+// When the depot has more than MaxDepotBlockCount free blocks of a size class after a burst, it returns the slabs
+// that have all their blocks in the depot to the heap until it has no more than DepotBlockCountAfterTrim blocks.
+constexpr uint32_t TransferBatchSize{32};
+constexpr uint32_t MaxThreadCacheBlockCount{2 * TransferBatchSize};
+constexpr uint32_t SlabBlockCount{TransferBatchSize};
+constexpr uint32_t MaxDepotBlockCount{16 * SlabBlockCount};
+constexpr uint32_t DepotBlockCountAfterTrim{MaxDepotBlockCount / 2};
+
+// Each slab starts with a header. It keeps the blocks 16 byte aligned.
+constexpr size_t SlabHeaderSize{16};
+
+struct BlockHeader {
+  BlockHeader *Next;
+  uint32_t SizeClass;
+  uint32_t SlabIndex; // Index of the block in its slab.
+};
+
+//! The slab header is only changed under the depot lock of the slab size class.
+struct SlabHeader {
+  SlabHeader *NextReleased; // Links the slabs that are being returned to the heap.
+  uint32_t DepotBlockCount; // Number of the slab blocks in the depot.
+};
+
+static_assert(sizeof(BlockHeader) <= BlockHeaderSize, "BlockHeader must fit into BlockHeaderSize");
+static_assert(sizeof(SlabHeader) <= SlabHeaderSize, "SlabHeader must fit into SlabHeaderSize");
+static_assert(MaxSmallBlockSize % CoarseGranularity == 0, "MaxSmallBlockSize must be a multiple of CoarseGranularity");
+
+uint32_t GetSizeClass(size_t size) noexcept {
+  if (size <= FineMaxBlockSize) {
+    return static_cast<uint32_t>((std::max<size_t>(size, 1) - 1) / FineGranularity);
+  }
+
+  return FineSizeClassCount + static_cast<uint32_t>((size - FineMaxBlockSize - 1) / CoarseGranularity);
+}
+
+size_t GetBlockSize(uint32_t sizeClass) noexcept {
+  if (sizeClass < FineSizeClassCount) {
+    return (sizeClass + 1) * FineGranularity;
+  }
+
+  return FineMaxBlockSize + (sizeClass - FineSizeClassCount + 1) * CoarseGranularity;
+}
+
+void *ToUserMemory(BlockHeader *block) noexcept {
+  return reinterpret_cast<uint8_t *>(block) + BlockHeaderSize;
+}
+
+BlockHeader *FromUserMemory(void *ptr) noexcept {
+  return reinterpret_cast<BlockHeader *>(static_cast<uint8_t *>(ptr) - BlockHeaderSize);
+}
+
+size_t GetBlockStride(uint32_t sizeClass) noexcept {
+  return BlockHeaderSize + GetBlockSize(sizeClass);
+}
+
+SlabHeader *GetSlab(BlockHeader *block) noexcept {
+  return reinterpret_cast<SlabHeader *>(
+      reinterpret_cast<uint8_t *>(block) - SlabHeaderSize - GetBlockStride(block->SizeClass) * block->SlabIndex);
+}
+
+std::atomic<uint64_t> s_heapAllocationCount{0};
+std::atomic<uint64_t> s_heapFreeCount{0};
+
+//! Singly linked list of free blocks of the same size class.
+struct FreeBlockList {
+  void Push(BlockHeader *block) noexcept {
+    block->Next = m_head;
+    m_head = block;
+    ++m_count;
+  }
+
+  BlockHeader *Pop() noexcept {
+    BlockHeader *block = m_head;
+    if (block) {
+      m_head = block->Next;
+      --m_count;
+    }
+
+    return block;
+  }
+
+  uint32_t Count() const noexcept {
+    return m_count;
+  }
+
+  //! Remove all blocks for which the predicate returns true. The order of other blocks is kept.
+  template <class TPredicate>
+  void RemoveIf(TPredicate &&predicate) noexcept {
+    BlockHeader **next = &m_head;
+    while (BlockHeader *block = *next) {
+      if (predicate(block)) {
+        *next = block->Next;
+        --m_count;
+      } else {
+        next = &block->Next;
+      }
+    }
+  }
+
+ private:
+  BlockHeader *m_head{nullptr};
+  uint32_t m_count{0};
+};
+
+//! Allocate a slab from the heap and add all its blocks to the list.
+bool AllocateSlab(uint32_t sizeClass, FreeBlockList &list) noexcept {
+  const size_t blockStride = GetBlockStride(sizeClass);
+  SlabHeader *slab = static_cast<SlabHeader *>(
+      Mso::Memory::AllocateEx(SlabHeaderSize + blockStride * SlabBlockCount, Mso::Memory::AllocFlags::IgnoreLeak));
+  if (!slab) {
+    return false;
+  }
+
+  s_heapAllocationCount.fetch_add(1, std::memory_order_relaxed);
+  slab->NextReleased = nullptr;
+  slab->DepotBlockCount = 0;
+  uint8_t *blocks = reinterpret_cast<uint8_t *>(slab) + SlabHeaderSize;
+  for (uint32_t i = SlabBlockCount; i > 0; --i) {
+    BlockHeader *block = reinterpret_cast<BlockHeader *>(blocks + blockStride * (i - 1));
+    block->SizeClass = sizeClass;
+    block->SlabIndex = i - 1;
+    list.Push(block);
+  }
+
+  return true;
+}
+
+//! Counter that is changed only by its owner thread and can be read by any thread.
+struct ThreadCounter {
+  void Increment() noexcept {
+    m_value.store(m_value.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+  }
+
+  uint64_t Get() const noexcept {
+    return m_value.load(std::memory_order_relaxed);
+  }
+
+ private:
+  std::atomic<uint64_t> m_value{0};
+};
+
+//! Per-thread cache of the free blocks. It returns all its blocks to the depot when the thread exits.
+struct ThreadBlockCache {
+  ThreadBlockCache() noexcept;
+  ~ThreadBlockCache() noexcept;
+
+  std::array<FreeBlockList, SizeClassCount> Lists;
+  ThreadCounter HitCount;
+  ThreadCounter MissCount;
+};
+
+//! Process-wide store of the free blocks and the thread cache statistics.
+//! It is never destroyed because thread caches may return their blocks during the process shutdown.
+struct BlockDepot {
+  static BlockDepot &Instance() noexcept {
+    static BlockDepot *instance{new BlockDepot()};
+    return *instance;
+  }
+
+  //! Move up to TransferBatchSize blocks to the target list.
+  void TakeBatch(uint32_t sizeClass, FreeBlockList &target) noexcept {
+    std::lock_guard lock{m_mutexes[sizeClass]};
+    FreeBlockList &source = m_lists[sizeClass];
+    for (uint32_t i = 0; i < TransferBatchSize; ++i) {
+      BlockHeader *block = source.Pop();
+      if (!block) {
+        break;
+      }
+
+      --GetSlab(block)->DepotBlockCount;
+      target.Push(block);
+    }
+
+    // Lower the trim threshold that was raised because of the spread slabs as the list becomes shorter.
+    uint32_t &trimThreshold = m_trimThresholds[sizeClass];
+    trimThreshold = std::max(MaxDepotBlockCount, std::min(trimThreshold, source.Count() + DepotBlockCountAfterTrim));
+  }
+
+  //! Move up to blockCount blocks from the source list.
+  void PutBatch(uint32_t sizeClass, FreeBlockList &source, uint32_t blockCount) noexcept {
+    SlabHeader *releasedSlabs{nullptr};
+
+    {
+      std::lock_guard lock{m_mutexes[sizeClass]};
+      FreeBlockList &target = m_lists[sizeClass];
+      for (uint32_t i = 0; i < blockCount; ++i) {
+        BlockHeader *block = source.Pop();
+        if (!block) {
+          break;
+        }
+
+        ++GetSlab(block)->DepotBlockCount;
+        target.Push(block);
+      }
+
+      // If the list is still long after the trim, then the next trim waits until the list grows again,
+      // so that a list with spread slabs is not scanned for every batch.
+      uint32_t &trimThreshold = m_trimThresholds[sizeClass];
+      if (target.Count() > trimThreshold) {
+        releasedSlabs = TakeFreeSlabs(target);
+        trimThreshold = std::max(MaxDepotBlockCount, target.Count() + DepotBlockCountAfterTrim);
+      }
+    }
+
+    // Return the slabs to the heap outside of the lock.
+    while (SlabHeader *slab = releasedSlabs) {
+      releasedSlabs = slab->NextReleased;
+      s_heapFreeCount.fetch_add(1, std::memory_order_relaxed);
+      Mso::Memory::Free(slab);
+    }
+  }
+
+  void RegisterCache(ThreadBlockCache *cache) noexcept {
+    std::lock_guard lock{m_statsMutex};
+    m_caches.push_back(cache);
+  }
+
+  //! Remove the cache and keep its counters. It is called from the thread cache destructor.
+  void UnregisterCache(ThreadBlockCache *cache) noexcept {
+    std::lock_guard lock{m_statsMutex};
+    m_caches.erase(std::remove(m_caches.begin(), m_caches.end(), cache), m_caches.end());
+    m_retiredHitCount += cache->HitCount.Get();
+    m_retiredMissCount += cache->MissCount.Get();
+  }
+
+  void RecordUncachedHit() noexcept {
+    std::lock_guard lock{m_statsMutex};
+    ++m_retiredHitCount;
+  }
+
+  void RecordUncachedMiss() noexcept {
+    std::lock_guard lock{m_statsMutex};
+    ++m_retiredMissCount;
+  }
+
+  void GetStats(SmallBlockPoolStats &stats) noexcept {
+    std::lock_guard lock{m_statsMutex};
+    stats.HitCount = m_retiredHitCount;
+    stats.MissCount = m_retiredMissCount;
+    for (ThreadBlockCache *cache : m_caches) {
+      stats.HitCount += cache->HitCount.Get();
+      stats.MissCount += cache->MissCount.Get();
+    }
+  }
+
+ private:
+  static std::array<uint32_t, SizeClassCount> MakeTrimThresholds() noexcept {
+    std::array<uint32_t, SizeClassCount> thresholds;
+    thresholds.fill(MaxDepotBlockCount);
+    return thresholds;
+  }
+
+  //! Remove the slabs that have all their blocks in the list until the list has no more than
+  //! DepotBlockCountAfterTrim blocks. Blocks of a slab can be spread over the thread caches, so the list may
+  //! keep more blocks when it has not enough free slabs. Returns the removed slabs linked by NextReleased.
+  static SlabHeader *TakeFreeSlabs(FreeBlockList &list) noexcept {
+    SlabHeader *releasedSlabs{nullptr};
+    uint32_t remainingCount = list.Count();
+    list.RemoveIf([&](BlockHeader *block) noexcept {
+      SlabHeader *slab = GetSlab(block);
+      if (slab->DepotBlockCount == SlabBlockCount && remainingCount > DepotBlockCountAfterTrim) {
+        // Mark the slab as released, so that its other blocks are removed too.
+        slab->DepotBlockCount = UINT32_MAX;
+        slab->NextReleased = releasedSlabs;
+        releasedSlabs = slab;
+        remainingCount -= SlabBlockCount;
+      }
+
+      return slab->DepotBlockCount == UINT32_MAX;
+    });
+
+    return releasedSlabs;
+  }
+
+  std::array<std::mutex, SizeClassCount> m_mutexes;
+  std::array<FreeBlockList, SizeClassCount> m_lists;
+  std::array<uint32_t, SizeClassCount> m_trimThresholds{MakeTrimThresholds()};
+
+  std::mutex m_statsMutex;
+  std::vector<ThreadBlockCache *> m_caches;
+  uint64_t m_retiredHitCount{0};
+  uint64_t m_retiredMissCount{0};
+};
+
+// The cache may be used by other thread local destructors after it is destroyed. In that case we bypass it.
+// The flag is trivially destructible and thus it is valid for the whole thread lifetime.
+thread_local bool tls_isThreadBlockCacheDestroyed{false};
+thread_local ThreadBlockCache tls_threadBlockCache;
+
+ThreadBlockCache::ThreadBlockCache() noexcept {
+  BlockDepot::Instance().RegisterCache(this);
+}
+
+ThreadBlockCache::~ThreadBlockCache() noexcept {
+  tls_isThreadBlockCacheDestroyed = true;
+  BlockDepot &depot = BlockDepot::Instance();
+  for (uint32_t sizeClass = 0; sizeClass < SizeClassCount; ++sizeClass) {
+    FreeBlockList &list = Lists[sizeClass];
+    depot.PutBatch(sizeClass, list, list.Count());
+  }
+
+  depot.UnregisterCache(this);
+}
+
+BlockHeader *AllocateLargeBlock(size_t size) noexcept {
+  Debug(Mso::Memory::AutoIgnoreLeakScope lazy);
+  BlockHeader *block = static_cast<BlockHeader *>(
+      Mso::Memory::AllocateEx(BlockHeaderSize + size, Mso::Memory::AllocFlags::ShutdownLeak));
+  if (block) {
+    s_heapAllocationCount.fetch_add(1, std::memory_order_relaxed);
+    block->SizeClass = LargeBlockSizeClass;
+  }
+
+  return block;
+}
+
+//! Allocate a block when the thread cache is already destroyed.
+BlockHeader *AllocateUncachedBlock(uint32_t sizeClass) noexcept {
+  BlockDepot &depot = BlockDepot::Instance();
+  FreeBlockList list;
+  depot.TakeBatch(sizeClass, list);
+  if (list.Count()) {
+    depot.RecordUncachedHit();
+  } else {
+    depot.RecordUncachedMiss();
+    if (!AllocateSlab(sizeClass, list)) {
+      return nullptr;
+    }
+  }
+
+  BlockHeader *block = list.Pop();
+  depot.PutBatch(sizeClass, list, list.Count());
+  return block;
+}
+
+} // namespace
+
+void *AllocateSmallBlock(size_t size) noexcept {
+  if (size > MaxSmallBlockSize) {
+    BlockHeader *block = AllocateLargeBlock(size);
+    return block ? ToUserMemory(block) : nullptr;
+  }
+
+  uint32_t sizeClass = GetSizeClass(size);
+  if (tls_isThreadBlockCacheDestroyed) {
+    BlockHeader *block = AllocateUncachedBlock(sizeClass);
+    return block ? ToUserMemory(block) : nullptr;
+  }
+
+  ThreadBlockCache &cache = tls_threadBlockCache;
+  FreeBlockList &list = cache.Lists[sizeClass];
+  if (!list.Count()) {
+    BlockDepot::Instance().TakeBatch(sizeClass, list);
+  }
+
+  if (list.Count()) {
+    cache.HitCount.Increment();
+  } else {
+    cache.MissCount.Increment();
+    if (!AllocateSlab(sizeClass, list)) {
+      return nullptr;
+    }
+  }
+
+  return ToUserMemory(list.Pop());
+}
+
+void FreeSmallBlock(void *ptr) noexcept {
+  if (!ptr) {
+    return;
+  }
+
+  BlockHeader *block = FromUserMemory(ptr);
+  uint32_t sizeClass = block->SizeClass;
+  if (sizeClass == LargeBlockSizeClass) {
+    s_heapFreeCount.fetch_add(1, std::memory_order_relaxed);
+    Mso::Memory::Free(block);
+    return;
+  }
+
+  if (tls_isThreadBlockCacheDestroyed) {
+    FreeBlockList list;
+    list.Push(block);
+    BlockDepot::Instance().PutBatch(sizeClass, list, 1);
+    return;
+  }
+
+  // Threads that only free blocks allocated by other threads return them to the depot in batches.
+  FreeBlockList &list = tls_threadBlockCache.Lists[sizeClass];
+  list.Push(block);
+  if (list.Count() > MaxThreadCacheBlockCount) {
+    BlockDepot::Instance().PutBatch(sizeClass, list, TransferBatchSize);
+  }
+}
+
+SmallBlockPoolStats GetSmallBlockPoolStats() noexcept {
+  SmallBlockPoolStats stats;
+  BlockDepot::Instance().GetStats(stats);
+  stats.HeapAllocationCount = s_heapAllocationCount.load(std::memory_order_relaxed);
+  stats.HeapFreeCount = s_heapFreeCount.load(std::memory_order_relaxed);
+  return stats;
+}
+
+} // namespace Memory
+} // namespace Mso
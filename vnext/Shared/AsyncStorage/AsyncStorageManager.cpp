@@ -12,8 +12,8 @@ namespace react {
 const folly::dynamic noError;
 const std::vector<folly::dynamic> noErrorVector = {noError};
 
-AsyncStorageManager::AsyncStorageManager(const WCHAR *storageFileName)
-    : m_aofKVStorage{make_unique<KeyValueStorage>(storageFileName)},
+AsyncStorageManager::AsyncStorageManager(const WCHAR *storageFileName, chrono::milliseconds syncInterval)
+    : m_aofKVStorage{make_unique<KeyValueStorage>(storageFileName, syncInterval)},
       m_stopConsumer{false},
       m_consumerTask{std::async(std::launch::async, &AsyncStorageManager::consumeSetRequest, this)} {}
 
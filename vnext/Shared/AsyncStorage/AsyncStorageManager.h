@@ -16,7 +16,10 @@ namespace facebook {
 namespace react {
 class AsyncStorageManager {
  public:
-  AsyncStorageManager(const WCHAR *storageFileName);
+  // See KeyValueStorage for the syncInterval durability trade-off.
+  AsyncStorageManager(
+      const WCHAR *storageFileName,
+      std::chrono::milliseconds syncInterval = KeyValueStorage::DefaultSyncInterval);
   ~AsyncStorageManager();
 
   enum class AsyncStorageOperation { multiGet, multiSet, multiRemove, clear, multiMerge, getAllKeys };
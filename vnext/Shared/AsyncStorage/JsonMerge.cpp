@@ -0,0 +1,34 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+
+#include <AsyncStorage/JsonMerge.h>
+#include <folly/json.h>
+
+namespace facebook {
+namespace react {
+void JsonMerge::mergeDynamic(folly::dynamic &target, folly::dynamic &&patch) {
+  if (!target.isObject() || !patch.isObject()) {
+    target = std::move(patch);
+    return;
+  }
+
+  // Only the patched members are touched. The rest of the target is not copied.
+  for (auto &item : patch.items()) {
+    auto it = target.find(item.first);
+    if (it != target.items().end()) {
+      mergeDynamic(it->second, std::move(item.second));
+    } else {
+      target.insert(item.first, std::move(item.second));
+    }
+  }
+}
+
+std::string JsonMerge::mergeJson(const std::string &value, const std::string &patch) {
+  folly::dynamic target = folly::parseJson(value);
+  mergeDynamic(target, folly::parseJson(patch));
+  return folly::toJson(target);
+}
+} // namespace react
+} // namespace facebook
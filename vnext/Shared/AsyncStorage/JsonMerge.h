@@ -0,0 +1,24 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <folly/dynamic.h>
+
+#include <string>
+
+namespace facebook {
+namespace react {
+// Deep merge used by AsyncStorage.mergeItem. The members of the nested objects are merged
+// recursively, and all other patch values replace the existing values. It matches the merge
+// done by the AsyncStorage modules on other platforms.
+class JsonMerge {
+ public:
+  // Merges the patch into the target in place.
+  static void mergeDynamic(folly::dynamic &target, folly::dynamic &&patch);
+
+  // Merges the JSON patch into the JSON value. Throws if either of them is not a valid JSON.
+  static std::string mergeJson(const std::string &value, const std::string &patch);
+};
+} // namespace react
+} // namespace facebook
@@ -5,13 +5,18 @@
 
 #include <AsyncStorage/KeyValueStorage.h>
 
+#include <AsyncStorage/JsonMerge.h>
+#include <algorithm>
+
 using namespace std;
 
 namespace facebook {
 namespace react {
 
-KeyValueStorage::KeyValueStorage(const WCHAR *storageFileName)
-    : m_fileIOHelper{make_unique<StorageFileIO>(storageFileName)}, m_kvMap{map<string, string>()} {
+KeyValueStorage::KeyValueStorage(const WCHAR *storageFileName, chrono::milliseconds syncInterval)
+    : m_fileIOHelper{make_unique<StorageFileIO>(storageFileName)},
+      m_syncInterval{syncInterval},
+      m_kvMap{map<string, string>()} {
   // start the load procedure
   m_storageFileLoaded = CreateEventEx(nullptr, nullptr, CREATE_EVENT_MANUAL_RESET, SYNCHRONIZE | EVENT_MODIFY_STATE);
   if (m_storageFileLoaded == NULL)
@@ -20,66 +25,173 @@ KeyValueStorage::KeyValueStorage(const WCHAR *storageFileName)
   m_storageFileLoader = async(launch::async, &KeyValueStorage::load, this);
 }
 
+KeyValueStorage::~KeyValueStorage() {
+  // The loader may start a compaction, so it must complete first.
+  if (m_storageFileLoader.valid())
+    m_storageFileLoader.wait();
+  if (m_compaction.valid())
+    m_compaction.wait();
+
+  lock_guard<mutex> lock{m_fileMutex};
+  if (m_isSyncPending) {
+    try {
+      m_fileIOHelper->sync();
+    } catch (const std::exception &) {
+      // The records are already flushed to the OS. There is nobody to report the error to.
+    }
+  }
+}
+
 void KeyValueStorage::setStorageLoadedEvent() {
   if (!SetEvent(m_storageFileLoaded))
     StorageFileIO::throwLastErrorMessage();
 }
 
 void KeyValueStorage::load() {
-  bool saveRequired = false; // this flag is used to indicate whether the file
-                             // needs to be cleaned up.
-
-  string currentKey;
-  string unescapedLine;
-
-  std::string line;
-  line.reserve(EstimatedValueSize);
-
-  m_fileIOHelper->resetLine();
-
-  while (m_fileIOHelper->getLine(line)) {
-    if (line.size() > 0) {
-      char prefix = line.at(0);
-      line.erase(0, 1);
-      unescapeString(line); // get the line without the prefix ($, %, R) and
-                            // unescapes the \n and \ chars
-      switch (prefix) { // switch on first char in line
-        case KeyPrefix:
-          currentKey = line;
-          break;
-
-        case ValuePrefix:
-          if (m_kvMap.count(currentKey))
-            saveRequired = true;
-          m_kvMap[currentKey] = line;
-          break;
-
-        case RemovePrefix:
-          saveRequired = true;
-          m_kvMap.erase(currentKey);
-          break;
-
-        default:
-          m_fileIOHelper->clear();
-          setStorageLoadedEvent();
-          throw std::exception("Corrupt storage file. Unexpected prefix on line. Storage file cleared.");
-          break;
-      }
-    }
+  {
+    lock_guard<mutex> lock{m_loadIndexMutex};
+    m_fileView = m_fileIOHelper->mapView();
+  }
+
+  if (!m_fileView) {
+    setStorageLoadedEvent(); // the storage file is empty
+    return;
+  }
+
+  bool isTailTorn = false;
+  indexFileView(isTailTorn);
+
+  // Only the latest records of the existing keys are unescaped and copied to the table.
+  for (auto const &entry : m_loadIndex) {
+    if (entry.second.IsRemoved)
+      continue;
+
+    string value = readIndexedValue(entry.second);
+    m_liveSize += recordSize(entry.first, value);
+    m_kvMap.emplace(entry.first, std::move(value));
+  }
+
+  {
+    lock_guard<mutex> fileLock{m_fileMutex};
+    m_logSize = m_fileView->size();
   }
 
-  if (saveRequired) // cleanup the AOF by dumping the in memory map
   {
+    // Release the view before the file can be truncated.
+    lock_guard<mutex> lock{m_loadIndexMutex};
+    m_loadIndex.clear();
+    m_fileView = nullptr;
+  }
+
+  if (isTailTorn) {
+    // The last record was not completely written. Drop it before appending new records after it.
     saveTable();
+  } else {
+    compactIfNeeded();
   }
+
   setStorageLoadedEvent();
 }
 
+// Index the records from the end of the file to the beginning. The first record found for a key
+// is the latest one, and all records for the key before it are skipped.
+void KeyValueStorage::indexFileView(bool &isTailTorn) {
+  const char *begin = m_fileView->data();
+  const char *end = begin + m_fileView->size();
+
+  // Skip the last line if it does not end with the line break.
+  const char *position = end;
+  while (position != begin && position[-1] != '\n')
+    position--;
+  isTailTorn = position != end;
+
+  // The value or remove record that waits for its key record.
+  bool hasPendingValue = false;
+  LoadIndexEntry pendingValue{};
+
+  while (position != begin) {
+    const char *lineEnd = position - 1;
+    const char *lineBegin = lineEnd;
+    while (lineBegin != begin && lineBegin[-1] != '\n')
+      lineBegin--;
+    position = lineBegin;
+
+    if (lineBegin == lineEnd)
+      continue;
+
+    switch (*lineBegin) { // switch on first char in line
+      case ValuePrefix:
+      case RemovePrefix:
+        // Only the last value record after a key record is applied.
+        if (!hasPendingValue) {
+          hasPendingValue = true;
+          pendingValue.ValueOffset = static_cast<uint32_t>(lineBegin + 1 - begin);
+          pendingValue.ValueSize = static_cast<uint32_t>(lineEnd - lineBegin - 1);
+          pendingValue.IsRemoved = *lineBegin == RemovePrefix;
+        }
+        break;
+
+      case KeyPrefix:
+        if (hasPendingValue) {
+          hasPendingValue = false;
+          string key{lineBegin + 1, lineEnd};
+          unescapeString(key);
+
+          lock_guard<mutex> lock{m_loadIndexMutex};
+          m_loadIndex.try_emplace(std::move(key), pendingValue);
+        }
+        break;
+
+      default: {
+        {
+          lock_guard<mutex> lock{m_loadIndexMutex};
+          m_loadIndex.clear();
+          m_fileView = nullptr;
+        }
+
+        m_fileIOHelper->clear();
+        setStorageLoadedEvent();
+        throw std::exception("Corrupt storage file. Unexpected prefix on line. Storage file cleared.");
+      }
+    }
+  }
+}
+
+string KeyValueStorage::readIndexedValue(const LoadIndexEntry &entry) const {
+  string value{m_fileView->data() + entry.ValueOffset, entry.ValueSize};
+  unescapeString(value);
+  return value;
+}
+
+// Returns true if the load index has the latest records for all keys.
+// The index is available only while the storage file is loaded.
+bool KeyValueStorage::tryGetIndexed(const vector<string> &keys, vector<tuple<string, string>> &result) {
+  lock_guard<mutex> lock{m_loadIndexMutex};
+  if (!m_fileView)
+    return false;
+
+  for (auto const &k : keys) {
+    auto it = m_loadIndex.find(k);
+    if (it == m_loadIndex.end()) {
+      result.clear();
+      return false; // the key may be found later by the scan
+    }
+
+    if (!it->second.IsRemoved)
+      result.emplace_back(k, readIndexedValue(it->second));
+  }
+
+  return true;
+}
+
 void KeyValueStorage::saveTable() {
-  m_fileIOHelper->clear();
+  rewriteFile(serializeTable(m_kvMap));
+}
+
+string KeyValueStorage::serializeTable(const map<string, string> &table) {
   stringstream cleanedUpFile;
 
-  for (auto const &entry : m_kvMap) // convert in memory map to a string
+  for (auto const &entry : table) // convert in memory map to a string
   {
     string key = entry.first;
     string value = entry.second;
@@ -90,8 +202,75 @@ void KeyValueStorage::saveTable() {
     cleanedUpFile << KeyPrefix << key << '\n' << ValuePrefix << value << '\n';
   }
 
-  m_fileIOHelper->append(cleanedUpFile.str());
+  return cleanedUpFile.str();
+}
+
+void KeyValueStorage::appendRecords(const string &records) {
+  lock_guard<mutex> lock{m_fileMutex};
+  m_fileIOHelper->append(records);
   m_fileIOHelper->flush();
+  m_logSize += records.size();
+
+  if (m_isCompacting)
+    m_compactionTail += records;
+
+  // Batch the disk writes: a burst of small writes costs one sync per m_syncInterval.
+  auto now = chrono::steady_clock::now();
+  if (now - m_lastSyncTime >= m_syncInterval) {
+    m_fileIOHelper->sync();
+    m_lastSyncTime = now;
+    m_isSyncPending = false;
+  } else {
+    m_isSyncPending = true;
+  }
+}
+
+void KeyValueStorage::compactIfNeeded() {
+  {
+    lock_guard<mutex> lock{m_fileMutex};
+    if (m_isCompacting || m_logSize < MinCompactionFileSize || m_logSize < m_compactionRetryLogSize ||
+        m_liveSize > m_logSize * (1 - CompactionGarbageRatio))
+      return;
+
+    m_isCompacting = true;
+  }
+
+  // The snapshot is taken in the writing thread. Writes done after this point are
+  // appended to m_compactionTail and replayed on top of the snapshot.
+  m_compaction = async(launch::async, &KeyValueStorage::compact, this, m_kvMap);
+}
+
+void KeyValueStorage::compact(map<string, string> snapshot) {
+  try {
+    string fileContent = serializeTable(snapshot);
+    snapshot.clear();
+    rewriteFile(std::move(fileContent));
+  } catch (const std::exception &e) {
+    // The records are still in the log, so the failure is not reported to the writes. Log it and let a later write
+    // retry the compaction after the log grows by MinCompactionFileSize.
+    string message = string("AsyncStorage compaction failed: ") + e.what() + "\r\n";
+    OutputDebugStringA(message.c_str());
+
+    lock_guard<mutex> lock{m_fileMutex};
+    m_compactionTail = string();
+    m_isCompacting = false;
+    m_compactionRetryLogSize = m_logSize + MinCompactionFileSize;
+  }
+}
+
+void KeyValueStorage::rewriteFile(string &&fileContent) {
+  lock_guard<mutex> lock{m_fileMutex};
+  fileContent += m_compactionTail;
+  m_compactionTail = string();
+  m_isCompacting = false;
+
+  // The log is replaced atomically, so it still has all records if the replace fails.
+  m_fileIOHelper->replace(fileContent);
+
+  m_logSize = fileContent.size();
+  m_compactionRetryLogSize = 0;
+  m_lastSyncTime = chrono::steady_clock::now();
+  m_isSyncPending = false;
 }
 
 void KeyValueStorage::waitForStorageLoadComplete() {
@@ -106,10 +285,18 @@ void KeyValueStorage::waitForStorageLoadComplete() {
     m_storageFileLoader.get();
 }
 
+void KeyValueStorage::waitForCompactionComplete() {
+  if (m_compaction.valid())
+    m_compaction.wait();
+}
+
 vector<tuple<string, string>> KeyValueStorage::multiGet(const vector<string> &keys) {
+  vector<tuple<string, string>> result;
+  if (tryGetIndexed(keys, result))
+    return result;
+
   waitForStorageLoadComplete();
 
-  vector<tuple<string, string>> result;
   for (auto const &k : keys) {
     if (m_kvMap.find(k) != m_kvMap.end()) {
       result.emplace_back(k, m_kvMap[k]);
@@ -132,41 +319,93 @@ void KeyValueStorage::multiSet(const vector<tuple<string, string>> &keyValuePair
     // check if we need to modify the storage file
     // 1. if key does not exist
     // 2. if keys exists and value is different
-    if (m_kvMap.find(key) == m_kvMap.end() || m_kvMap[key] != value) {
+    auto it = m_kvMap.find(key);
+    if (it == m_kvMap.end() || it->second != value) {
       // update the in-memory map
-      m_kvMap[key] = value;
+      if (it != m_kvMap.end()) {
+        m_liveSize -= recordSize(it->first, it->second);
+        it->second = value;
+      } else {
+        m_kvMap.emplace(key, value);
+      }
+
       fUpdateStorageFile = true;
       escapeString(key);
       escapeString(value);
       appendEntry << KeyPrefix << key << '\n' << ValuePrefix << value << '\n';
+      m_liveSize += key.size() + value.size() + 4;
     }
   }
 
   if (fUpdateStorageFile) {
-    // write the new keys to the file
-    saveTable();
+    // append the new records to the file
+    appendRecords(appendEntry.str());
+    compactIfNeeded();
   }
 }
 
 void KeyValueStorage::multiRemove(const vector<string> &keys) {
   waitForStorageLoadComplete();
 
+  stringstream appendEntry;
+  bool fUpdateStorageFile = false;
+
   for (auto const &k : keys) {
-    m_kvMap.erase(k);
+    auto it = m_kvMap.find(k);
+    if (it == m_kvMap.end())
+      continue;
+
+    m_liveSize -= recordSize(it->first, it->second);
+    m_kvMap.erase(it);
+
+    fUpdateStorageFile = true;
+    string key = k;
+    escapeString(key);
+    appendEntry << KeyPrefix << key << '\n' << RemovePrefix << '\n';
   }
 
-  saveTable();
+  if (fUpdateStorageFile) {
+    appendRecords(appendEntry.str());
+    compactIfNeeded();
+  }
 }
 
 void KeyValueStorage::multiMerge(const vector<tuple<string, string>> &keyValuePairs) {
-  throw std::exception("Error: not implemented.");
+  waitForStorageLoadComplete();
+
+  // Merge all values before the write, so that an invalid JSON fails the whole batch.
+  // The merged values are appended to the log by one write.
+  vector<tuple<string, string>> mergedPairs;
+  mergedPairs.reserve(keyValuePairs.size());
+  for (auto const &kvTuple : keyValuePairs) {
+    auto const &key = get<0>(kvTuple);
+    auto const &patch = get<1>(kvTuple);
+
+    // Merge with the value merged earlier in the same batch.
+    auto merged =
+        find_if(mergedPairs.rbegin(), mergedPairs.rend(), [&key](auto const &kv) { return get<0>(kv) == key; });
+    if (merged != mergedPairs.rend()) {
+      get<1>(*merged) = JsonMerge::mergeJson(get<1>(*merged), patch);
+      continue;
+    }
+
+    auto it = m_kvMap.find(key);
+    mergedPairs.emplace_back(key, it != m_kvMap.end() ? JsonMerge::mergeJson(it->second, patch) : patch);
+  }
+
+  multiSet(mergedPairs);
 }
 
 void KeyValueStorage::clear() {
   waitForStorageLoadComplete();
+  waitForCompactionComplete();
 
   m_kvMap.clear();
+  m_liveSize = 0;
+
+  lock_guard<mutex> lock{m_fileMutex};
   m_fileIOHelper->clear();
+  m_logSize = 0;
 }
 
 vector<string> KeyValueStorage::getAllKeys() {
@@ -179,6 +418,22 @@ vector<string> KeyValueStorage::getAllKeys() {
   return keys;
 }
 
+// Size of the escaped string in the storage file.
+uint64_t KeyValueStorage::escapedSize(const string &rawString) {
+  uint64_t size = rawString.size();
+  for (auto const &c : rawString) {
+    if (c == '\n' || c == '\\')
+      size++;
+  }
+
+  return size;
+}
+
+// Size of the key and value records with their prefixes and line breaks.
+uint64_t KeyValueStorage::recordSize(const string &key, const string &value) {
+  return escapedSize(key) + escapedSize(value) + 4;
+}
+
 void KeyValueStorage::escapeString(string &rawString) {
   int cSpecialChars = 0;
   for (auto const &c : rawString) {
@@ -3,18 +3,34 @@
 
 #pragma once
 
+#include <chrono>
 #include <future>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
 #include <vector>
 
 #include <AsyncStorage/StorageFileIO.h>
 
 namespace facebook {
 namespace react {
+// The storage file is an append-only log of key, value, and remove records.
+// Writes append their records, and the file is compacted in background when
+// most of it is taken by overwritten and removed records. The compacted file is
+// written next to the log and renamed over it, so a failed compaction loses no records.
+// The file is loaded through a memory mapped view. It is scanned from the end, so
+// multiGet can return the keys that are already indexed before the scan completes.
+//
+// Appended records are flushed to the OS right away, so they survive an app crash. They are written to the disk
+// at most once per syncInterval, so an OS crash or a power loss can lose the writes done in the last syncInterval.
+// Use a zero syncInterval to write every change to the disk before the write returns.
 class KeyValueStorage {
  public:
-  KeyValueStorage(const WCHAR *storageFileName);
+  static constexpr std::chrono::milliseconds DefaultSyncInterval{1000};
+
+  KeyValueStorage(const WCHAR *storageFileName, std::chrono::milliseconds syncInterval = DefaultSyncInterval);
+  ~KeyValueStorage();
 
   std::vector<std::tuple<std::string, std::string>> multiGet(const std::vector<std::string> &keys);
   void multiSet(const std::vector<std::tuple<std::string, std::string>> &keyValuePairs);
@@ -28,23 +44,64 @@ class KeyValueStorage {
   static const uint32_t EstimatedValueSize = 200;
   static const char KeyPrefix = '$';
   static const char ValuePrefix = '%';
-  static const char RemovePrefix = 'R'; // Keep RemovePrefix to be backward compatible for the storage file format
+  static const char RemovePrefix = 'R';
+
+  // The file is compacted when at least this part of it is garbage and it is bigger than MinCompactionFileSize.
+  static constexpr double CompactionGarbageRatio = 0.5;
+  static const uint64_t MinCompactionFileSize = 64 * 1024;
 
  private:
   std::map<std::string, std::string> m_kvMap;
   std::unique_ptr<StorageFileIO> m_fileIOHelper;
+  const std::chrono::milliseconds m_syncInterval;
   HANDLE m_storageFileLoaded;
   std::future<void> m_storageFileLoader;
 
+  // Position of the latest value record for a key in the mapped storage file.
+  struct LoadIndexEntry {
+    uint32_t ValueOffset;
+    uint32_t ValueSize;
+    bool IsRemoved;
+  };
+
+  // m_loadIndexMutex guards the index and the view while the storage file is loaded.
+  std::mutex m_loadIndexMutex;
+  std::unordered_map<std::string, LoadIndexEntry> m_loadIndex;
+  std::unique_ptr<StorageFileView> m_fileView;
+
+  // Size of the records for the m_kvMap entries, i.e. the file size after compaction.
+  uint64_t m_liveSize{0};
+
+  // m_fileMutex guards the file and the fields below. They are shared with the background compaction.
+  std::mutex m_fileMutex;
+  uint64_t m_logSize{0};
+  std::chrono::steady_clock::time_point m_lastSyncTime;
+  bool m_isSyncPending{false};
+  bool m_isCompacting{false};
+  uint64_t m_compactionRetryLogSize{0}; // The log size to retry the compaction after it failed.
+  std::string m_compactionTail; // Records appended after the compaction took the table snapshot.
+  std::future<void> m_compaction;
+
  private:
   static void escapeString(std::string &unescapedString);
   static void unescapeString(std::string &escapedString);
+  static uint64_t escapedSize(const std::string &rawString);
+  static uint64_t recordSize(const std::string &key, const std::string &value);
+  static std::string serializeTable(const std::map<std::string, std::string> &table);
 
  private:
   void load();
+  void indexFileView(bool &isTailTorn);
+  std::string readIndexedValue(const LoadIndexEntry &entry) const;
+  bool tryGetIndexed(const std::vector<std::string> &keys, std::vector<std::tuple<std::string, std::string>> &result);
   void waitForStorageLoadComplete();
   void setStorageLoadedEvent();
   void saveTable();
+  void appendRecords(const std::string &records);
+  void compactIfNeeded();
+  void compact(std::map<std::string, std::string> snapshot);
+  void rewriteFile(std::string &&fileContent);
+  void waitForCompactionComplete();
 };
 } // namespace react
 } // namespace facebook
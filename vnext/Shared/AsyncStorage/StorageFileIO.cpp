@@ -22,6 +22,41 @@
 
 namespace facebook {
 namespace react {
+StorageFileView::StorageFileView(HANDLE fileHandle, uint32_t fileSize)
+    : m_fileMapping{nullptr, &CloseHandle}, m_fileData{nullptr, &UnmapViewOfFile}, m_fileSize{fileSize} {
+#ifdef WINRT
+  m_fileMapping.reset(CreateFileMappingFromApp(
+      fileHandle, nullptr /* SecurityAttributes */, PAGE_READONLY, m_fileSize, nullptr /* Name */));
+#else
+  m_fileMapping.reset(CreateFileMapping(
+      fileHandle,
+      nullptr /* lpAttributes */,
+      PAGE_READONLY,
+      0 /* dwMaximumSizeHigh */,
+      m_fileSize,
+      nullptr /* lpName */));
+#endif
+  if (!m_fileMapping)
+    StorageFileIO::throwLastErrorMessage();
+
+#ifdef WINRT
+  m_fileData.reset(MapViewOfFileFromApp(m_fileMapping.get(), FILE_MAP_READ, 0 /* FileOffset */, m_fileSize));
+#else
+  m_fileData.reset(MapViewOfFile(
+      m_fileMapping.get(), FILE_MAP_READ, 0 /* dwFileOffsetHigh */, 0 /* dwFileOffsetLow */, m_fileSize));
+#endif
+  if (!m_fileData)
+    StorageFileIO::throwLastErrorMessage();
+}
+
+const char *StorageFileView::data() const {
+  return static_cast<const char *>(m_fileData.get());
+}
+
+size_t StorageFileView::size() const {
+  return m_fileSize;
+}
+
 StorageFileIO::StorageFileIO(const WCHAR *storageFileName) {
   if (storageFileName == nullptr || storageFileName[0] == 0)
     throw std::exception("Storage File name is empty.");
@@ -55,42 +90,61 @@ StorageFileIO::StorageFileIO(const WCHAR *storageFileName) {
   if (!CreateDirectoryW(strStorageFolderFullPath.c_str(), nullptr) && GetLastError() != ERROR_ALREADY_EXISTS)
     throwLastErrorMessage();
 
-    // The FILE_FLAG_WRITE_THROUGH can be specified to ensure any writes are
-    // written to the disk right away but it causes IO to be much slower (~10x).
+  m_storageFilePath = strStorageFileFullPath;
+  openStorageFile();
+}
+
+StorageFileIO::~StorageFileIO() {}
+
+HANDLE StorageFileIO::openFile(const std::wstring &filePath, DWORD creationDisposition) {
+  // The FILE_FLAG_WRITE_THROUGH can be specified to ensure any writes are
+  // written to the disk right away but it causes IO to be much slower (~10x).
 #ifdef WINRT
   CREATEFILE2_EXTENDED_PARAMETERS extendedParams = {};
   extendedParams.dwSize = sizeof(CREATEFILE2_EXTENDED_PARAMETERS);
   extendedParams.dwFileAttributes = FILE_ATTRIBUTE_NORMAL;
-  m_storageFileHandle = CreateFile2(
-      strStorageFileFullPath.c_str(),
+  HANDLE fileHandle = CreateFile2(
+      filePath.c_str(),
       GENERIC_READ | GENERIC_WRITE,
       FILE_SHARE_READ | FILE_SHARE_WRITE,
-      OPEN_ALWAYS,
+      creationDisposition,
       &extendedParams);
 #else
-  m_storageFileHandle = CreateFileW(
-      strStorageFileFullPath.c_str(),
+  HANDLE fileHandle = CreateFileW(
+      filePath.c_str(),
       GENERIC_READ | GENERIC_WRITE,
       FILE_SHARE_READ | FILE_SHARE_WRITE,
       nullptr,
-      OPEN_ALWAYS,
+      creationDisposition,
       FILE_ATTRIBUTE_NORMAL,
       nullptr);
 #endif
-  if (m_storageFileHandle == INVALID_HANDLE_VALUE)
+  if (fileHandle == INVALID_HANDLE_VALUE)
     throwLastErrorMessage();
 
+  return fileHandle;
+}
+
+void StorageFileIO::openStorageFile() {
+  m_storageFileHandle = openFile(m_storageFilePath, OPEN_ALWAYS);
+
   int fdFileDescriptor = _open_osfhandle((intptr_t)m_storageFileHandle, _O_RDWR);
-  if (fdFileDescriptor == -1)
+  if (fdFileDescriptor == -1) {
+    CloseHandle(m_storageFileHandle);
     throwLastErrorMessage();
+  }
 
   m_storageFile =
       std::unique_ptr<FILE, std::function<void(FILE *)>>(_fdopen(fdFileDescriptor, "r+"), [](FILE *f) { fclose(f); });
-  if (m_storageFile == nullptr)
+  if (m_storageFile == nullptr) {
+    _close(fdFileDescriptor);
     throwLastErrorMessage();
-}
+  }
 
-StorageFileIO::~StorageFileIO() {}
+  m_fileBufferInited = false;
+  m_fileBufferIdx = 0;
+  m_fileBufferSize = IOHelperBufferSize;
+}
 
 bool StorageFileIO::getLine(std::string &line) {
   line = "";
@@ -135,15 +189,81 @@ void StorageFileIO::clear() {
     throwLastErrorMessage();
 }
 
-// Append assumes the file seek pointer is at the end of the file.
 void StorageFileIO::append(const std::string &fileContent) {
+  // The stream may be positioned after the last read line. Reads and writes must be separated by a seek.
+  if (fseek(m_storageFile.get(), 0, SEEK_END))
+    throwLastErrorMessage();
+
   fwrite(fileContent.c_str(), sizeof(char), fileContent.size(), m_storageFile.get());
 }
 
+// Replaces the file content without truncating the file first. The content is written to a temporary file that is
+// renamed over the storage file, so the file has either the old or the new content if the replace fails.
+void StorageFileIO::replace(const std::string &fileContent) {
+  if (fileContent.size() > MAXDWORD)
+    throw std::exception("Storage file content is too big to be written.");
+
+  const std::wstring tempFilePath = m_storageFilePath + L".tmp";
+  {
+    std::unique_ptr<void, decltype(&CloseHandle)> tempFile{openFile(tempFilePath, CREATE_ALWAYS), &CloseHandle};
+    DWORD bytesWritten = 0;
+    if (!WriteFile(
+            tempFile.get(), fileContent.data(), static_cast<DWORD>(fileContent.size()), &bytesWritten, nullptr) ||
+        bytesWritten != fileContent.size() || !FlushFileBuffers(tempFile.get())) {
+      DWORD error = GetLastError();
+      tempFile = nullptr;
+      DeleteFileW(tempFilePath.c_str());
+      SetLastError(error);
+      throwLastErrorMessage();
+    }
+  }
+
+  // The storage file must be closed to be replaced. It is reopened even if the rename fails.
+  m_storageFile = nullptr;
+  bool success = MoveFileExW(
+      tempFilePath.c_str(), m_storageFilePath.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH);
+  DWORD error = GetLastError();
+
+  openStorageFile();
+  if (!success) {
+    DeleteFileW(tempFilePath.c_str());
+    SetLastError(error);
+    throwLastErrorMessage();
+  }
+}
+
 void StorageFileIO::flush() {
   fflush(m_storageFile.get());
 }
 
+// Unlike flush, which only hands the buffered data to the OS, sync waits until the data is written to the disk.
+void StorageFileIO::sync() {
+  flush();
+  if (!FlushFileBuffers(m_storageFileHandle))
+    throwLastErrorMessage();
+}
+
+uint64_t StorageFileIO::size() {
+  flush();
+  LARGE_INTEGER fileSize;
+  if (!GetFileSizeEx(m_storageFileHandle, &fileSize))
+    throwLastErrorMessage();
+
+  return static_cast<uint64_t>(fileSize.QuadPart);
+}
+
+// Returns nullptr for an empty file because it cannot be mapped.
+std::unique_ptr<StorageFileView> StorageFileIO::mapView() {
+  uint64_t fileSize = size();
+  if (fileSize == 0)
+    return nullptr;
+
+  if (fileSize > UINT32_MAX)
+    throw std::exception("Storage file is too big to be mapped.");
+
+  return std::make_unique<StorageFileView>(m_storageFileHandle, static_cast<uint32_t>(fileSize));
+}
+
 void StorageFileIO::throwLastErrorMessage() {
   char errorMessageBuffer[IOHelperBufferSize + 1] = {0};
   FormatMessageA(
@@ -12,6 +12,21 @@
 
 namespace facebook {
 namespace react {
+// Read-only memory mapped view of the storage file.
+// The file cannot be truncated while the view exists.
+class StorageFileView {
+ public:
+  StorageFileView(HANDLE fileHandle, uint32_t fileSize);
+
+  const char *data() const;
+  size_t size() const;
+
+ private:
+  std::unique_ptr<void, decltype(&CloseHandle)> m_fileMapping;
+  std::unique_ptr<void, decltype(&UnmapViewOfFile)> m_fileData;
+  uint32_t m_fileSize = 0;
+};
+
 class StorageFileIO {
  public:
   StorageFileIO(const WCHAR *storageFileName);
@@ -19,13 +34,22 @@ class StorageFileIO {
 
   void clear();
   void append(const std::string &fileContent);
+  void replace(const std::string &fileContent);
   void resetLine();
   bool getLine(std::string &line);
   void flush();
+  void sync();
+  uint64_t size();
+  std::unique_ptr<StorageFileView> mapView();
 
   static void throwLastErrorMessage();
 
  private:
+  static HANDLE openFile(const std::wstring &filePath, DWORD creationDisposition);
+  void openStorageFile();
+
+ private:
+  std::wstring m_storageFilePath;
   HANDLE m_storageFileHandle;
   std::unique_ptr<FILE, std::function<void(FILE *)>> m_storageFile;
 
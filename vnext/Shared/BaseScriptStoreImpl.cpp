@@ -4,9 +4,14 @@
 #include "pch.h"
 
 #include "BaseScriptStoreImpl.h"
+#include "MemoryMappedBuffer.h"
 
+#include <cstring>
+#include <filesystem>
 #include <fstream>
 
+namespace fs = std::filesystem;
+
 namespace facebook {
 namespace react {
 
@@ -53,7 +58,7 @@ class BufferViewBuffer : public facebook::jsi::Buffer {
     return const_cast<uint8_t *>(buffer_->data()) + offset_;
   }
 
-  BufferViewBuffer(std::unique_ptr<const facebook::jsi::Buffer> buffer, size_t offset, size_t size)
+  BufferViewBuffer(std::shared_ptr<const facebook::jsi::Buffer> buffer, size_t offset, size_t size)
       : buffer_(std::move(buffer)), offset_(offset), size_(size) {
     if (size_ > buffer_->size() - offset)
       std::terminate();
@@ -66,7 +71,7 @@ class BufferViewBuffer : public facebook::jsi::Buffer {
   BufferViewBuffer(const BufferViewBuffer &) = delete;
   BufferViewBuffer &operator=(const BufferViewBuffer &) = delete;
 
-  std::unique_ptr<const facebook::jsi::Buffer> buffer_;
+  std::shared_ptr<const facebook::jsi::Buffer> buffer_;
   size_t offset_;
   size_t size_;
 };
@@ -91,8 +96,118 @@ struct PreparedScriptSuffix {
   char eof[length__(PERSIST_EOF)];
 };
 
+constexpr char ContentAddressedMagic[8] = {'R', 'N', 'W', 'P', 'R', 'E', 'P', '2'};
+constexpr const char *PreparedScriptsDirectory = "PreparedScripts";
+constexpr const char *PreparedScriptExtension = ".prep";
+
+struct ContentAddressedEntryHeader {
+  char magic[sizeof(ContentAddressedMagic)];
+  jsi::ScriptVersion_t scriptVersion;
+  jsi::JSRuntimeVersion_t runtimeVersion;
+  uint64_t sizeInBytes;
+  uint64_t checksum; // Content hash of the prepared script.
+};
+
+static_assert(sizeof(ContentAddressedEntryHeader) == 40, "The entry header must not have padding");
+
+constexpr uint64_t HashPrime1 = 0x9E3779B185EBCA87ULL;
+constexpr uint64_t HashPrime2 = 0xC2B2AE3D27D4EB4FULL;
+constexpr uint64_t HashPrime3 = 0x165667B19E3779F9ULL;
+constexpr uint64_t HashPrime4 = 0x85EBCA77C2B2AE63ULL;
+constexpr uint64_t HashPrime5 = 0x27D4EB2F165667C5ULL;
+
+inline uint64_t RotateLeft(uint64_t value, int bits) noexcept {
+  return (value << bits) | (value >> (64 - bits));
+}
+
+inline uint64_t Read64(const uint8_t *data) noexcept {
+  uint64_t value;
+  memcpy(&value, data, sizeof(value));
+  return value;
+}
+
+inline uint32_t Read32(const uint8_t *data) noexcept {
+  uint32_t value;
+  memcpy(&value, data, sizeof(value));
+  return value;
+}
+
+inline uint64_t HashRound(uint64_t accumulator, uint64_t input) noexcept {
+  accumulator += input * HashPrime2;
+  accumulator = RotateLeft(accumulator, 31);
+  return accumulator * HashPrime1;
+}
+
+inline uint64_t HashMergeRound(uint64_t accumulator, uint64_t value) noexcept {
+  accumulator ^= HashRound(0, value);
+  return accumulator * HashPrime1 + HashPrime4;
+}
+
 } // namespace
 
+uint64_t ComputeContentHash(const uint8_t *data, size_t size) noexcept {
+  const uint8_t *const end = data + size;
+  uint64_t hash;
+
+  if (size >= 32) {
+    uint64_t v1 = HashPrime1 + HashPrime2;
+    uint64_t v2 = HashPrime2;
+    uint64_t v3 = 0;
+    uint64_t v4 = 0 - HashPrime1;
+
+    for (const uint8_t *const limit = end - 32; data <= limit; data += 32) {
+      v1 = HashRound(v1, Read64(data));
+      v2 = HashRound(v2, Read64(data + 8));
+      v3 = HashRound(v3, Read64(data + 16));
+      v4 = HashRound(v4, Read64(data + 24));
+    }
+
+    hash = RotateLeft(v1, 1) + RotateLeft(v2, 7) + RotateLeft(v3, 12) + RotateLeft(v4, 18);
+    hash = HashMergeRound(hash, v1);
+    hash = HashMergeRound(hash, v2);
+    hash = HashMergeRound(hash, v3);
+    hash = HashMergeRound(hash, v4);
+  } else {
+    hash = HashPrime5;
+  }
+
+  hash += static_cast<uint64_t>(size);
+
+  for (; data + 8 <= end; data += 8) {
+    hash ^= HashRound(0, Read64(data));
+    hash = RotateLeft(hash, 27) * HashPrime1 + HashPrime4;
+  }
+
+  if (data + 4 <= end) {
+    hash ^= static_cast<uint64_t>(Read32(data)) * HashPrime1;
+    hash = RotateLeft(hash, 23) * HashPrime2 + HashPrime3;
+    data += 4;
+  }
+
+  for (; data < end; ++data) {
+    hash ^= (*data) * HashPrime5;
+    hash = RotateLeft(hash, 11) * HashPrime1;
+  }
+
+  hash ^= hash >> 33;
+  hash *= HashPrime2;
+  hash ^= hash >> 29;
+  hash *= HashPrime3;
+  hash ^= hash >> 32;
+
+  // 0 is reserved for the unknown script version.
+  return hash != 0 ? hash : 1;
+}
+
+jsi::ScriptVersion_t LocalFileSimpleScriptVersionProvider::getVersion(const std::string &url) noexcept {
+  try {
+    auto buffer = Microsoft::JSI::MakeMemoryMappedBuffer(fs::path(url).c_str());
+    return ComputeContentHash(buffer->data(), buffer->size());
+  } catch (const std::exception &) {
+    return 0;
+  }
+}
+
 jsi::VersionedBuffer BaseScriptStoreImpl::getVersionedScript(const std::string &url) noexcept {
   std::ifstream file(url, std::ios::binary | std::ios::ate);
 
@@ -110,23 +225,16 @@ jsi::VersionedBuffer BaseScriptStoreImpl::getVersionedScript(const std::string &
 
   file.close();
 
-  return {std::move(buffer), versionProvider_ ? versionProvider_->getVersion(url) : static_cast<uint64_t>(size)};
+  jsi::ScriptVersion_t version =
+      versionProvider_ ? versionProvider_->getVersion(url) : ComputeContentHash(buffer->data(), buffer->size());
+  return {std::move(buffer), version};
 }
 
 jsi::ScriptVersion_t BaseScriptStoreImpl::getScriptVersion(const std::string &url) noexcept {
   if (versionProvider_) {
     return versionProvider_->getVersion(url);
   } else {
-    std::ifstream file(url, std::ios::binary | std::ios::ate);
-
-    if (!file) {
-      return 0;
-    }
-
-    std::streamsize size = file.tellg();
-    file.seekg(0, std::ios::beg);
-
-    return static_cast<uint64_t>(size);
+    return LocalFileSimpleScriptVersionProvider().getVersion(url);
   }
 }
 
@@ -297,5 +405,187 @@ void BasePreparedScriptStoreImpl::persistPreparedScript(
   bufferStore_->persistBuffer(preparedScriptFilePath, std::move(newBuffer));
 }
 
+ContentAddressedPreparedScriptStore::ContentAddressedPreparedScriptStore(
+    const std::string &storeDirectory,
+    uint64_t diskBudget)
+    : storeDirectory_(storeDirectory), diskBudget_(diskBudget) {}
+
+std::string ContentAddressedPreparedScriptStore::getEntryFileName(
+    const jsi::ScriptSignature &scriptSignature,
+    const jsi::JSRuntimeSignature &runtimeSignature,
+    const char *prepareTag) {
+  // <runtime_name>_<runtime_version>_<preparation_tag>_<script_version>.prep
+  std::string entryFileName = runtimeSignature.runtimeName;
+  entryFileName.append("_");
+  entryFileName.append(std::to_string(runtimeSignature.version));
+  if (prepareTag) {
+    entryFileName.append("_");
+    entryFileName.append(prepareTag);
+  }
+
+  // Make a valid file name.
+  std::replace_if(
+      entryFileName.begin(), entryFileName.end(), [](char c) { return !isalnum(static_cast<unsigned char>(c)); }, '_');
+
+  char scriptVersion[17];
+  snprintf(scriptVersion, sizeof(scriptVersion), "%016llx", static_cast<unsigned long long>(scriptSignature.version));
+  entryFileName.append("_");
+  entryFileName.append(scriptVersion);
+  entryFileName.append(PreparedScriptExtension);
+
+  return entryFileName;
+}
+
+std::shared_ptr<const jsi::Buffer> ContentAddressedPreparedScriptStore::tryGetPreparedScript(
+    const jsi::ScriptSignature &scriptSignature,
+    const jsi::JSRuntimeSignature &runtimeSignature,
+    const char *prepareTag) noexcept {
+  // The entries are addressed by the script version. Without the version we cannot tell which script they belong to.
+  if (scriptSignature.version == 0) {
+    return nullptr;
+  }
+
+  try {
+    fs::path directory = fs::u8path(storeDirectory_) / PreparedScriptsDirectory;
+    fs::path entryPath = directory / getEntryFileName(scriptSignature, runtimeSignature, prepareTag);
+
+    std::error_code ec;
+    if (!fs::exists(entryPath, ec)) {
+      return nullptr;
+    }
+
+    std::shared_ptr<const jsi::Buffer> buffer = Microsoft::JSI::MakeMemoryMappedBuffer(entryPath.c_str());
+
+    const ContentAddressedEntryHeader *header = reinterpret_cast<const ContentAddressedEntryHeader *>(buffer->data());
+    const uint8_t *preparedScriptData = buffer->data() + sizeof(ContentAddressedEntryHeader);
+    size_t preparedScriptSize = buffer->size() - sizeof(ContentAddressedEntryHeader);
+
+    bool isValid = buffer->size() >= sizeof(ContentAddressedEntryHeader) &&
+        memcmp(header->magic, ContentAddressedMagic, sizeof(header->magic)) == 0 &&
+        header->scriptVersion == scriptSignature.version && header->runtimeVersion == runtimeSignature.version &&
+        header->sizeInBytes == preparedScriptSize &&
+        header->checksum == ComputeContentHash(preparedScriptData, preparedScriptSize);
+
+    if (!isValid) {
+      // The entry is torn or corrupted. Delete it to let the caller persist a new one.
+      buffer.reset();
+      fs::remove(entryPath, ec);
+      return nullptr;
+    }
+
+    // The last write time orders the entries for eviction.
+    fs::last_write_time(entryPath, fs::file_time_type::clock::now(), ec);
+
+    return std::make_shared<BufferViewBuffer>(
+        std::move(buffer), sizeof(ContentAddressedEntryHeader), preparedScriptSize);
+  } catch (const std::exception &) {
+    return nullptr;
+  }
+}
+
+void ContentAddressedPreparedScriptStore::persistPreparedScript(
+    std::shared_ptr<const jsi::Buffer> preparedScript,
+    const jsi::ScriptSignature &scriptSignature,
+    const jsi::JSRuntimeSignature &runtimeSignature,
+    const char *prepareTag) noexcept {
+  if (scriptSignature.version == 0 || !preparedScript) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock{mutex_};
+  try {
+    fs::path directory = fs::u8path(storeDirectory_) / PreparedScriptsDirectory;
+    std::error_code ec;
+    fs::create_directories(directory, ec);
+    if (ec) {
+      return;
+    }
+
+    ContentAddressedEntryHeader header;
+    memcpy(header.magic, ContentAddressedMagic, sizeof(header.magic));
+    header.scriptVersion = scriptSignature.version;
+    header.runtimeVersion = runtimeSignature.version;
+    header.sizeInBytes = preparedScript->size();
+    header.checksum = ComputeContentHash(preparedScript->data(), preparedScript->size());
+
+    // Write to a temporary file and rename it, so that the readers never see a partially written entry.
+    fs::path entryPath = directory / getEntryFileName(scriptSignature, runtimeSignature, prepareTag);
+    fs::path tempPath = entryPath;
+    tempPath += ".tmp";
+
+    std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+    if (!file) {
+      return;
+    }
+
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char *>(preparedScript->data()), preparedScript->size());
+    file.close();
+
+    if (!file) {
+      fs::remove(tempPath, ec);
+      return;
+    }
+
+    fs::rename(tempPath, entryPath, ec);
+    if (ec) {
+      fs::remove(tempPath, ec);
+      return;
+    }
+
+    evictEntries(entryPath);
+  } catch (const std::exception &) {
+  }
+}
+
+void ContentAddressedPreparedScriptStore::evictEntries(const fs::path &keptEntryPath) noexcept {
+  struct EntryInfo {
+    fs::path Path;
+    uint64_t Size;
+    fs::file_time_type LastUsedTime;
+  };
+
+  try {
+    std::vector<EntryInfo> entries;
+    uint64_t totalSize = 0;
+
+    std::error_code ec;
+    for (fs::directory_iterator it{keptEntryPath.parent_path(), ec}, end; !ec && it != end; it.increment(ec)) {
+      if (it->path().extension() != PreparedScriptExtension || it->path() == keptEntryPath) {
+        continue;
+      }
+
+      uint64_t size = it->file_size(ec);
+      if (ec) {
+        ec.clear();
+        continue;
+      }
+
+      entries.push_back({it->path(), size, it->last_write_time(ec)});
+      totalSize += size;
+    }
+
+    totalSize += fs::file_size(keptEntryPath, ec);
+    if (totalSize <= diskBudget_) {
+      return;
+    }
+
+    std::sort(entries.begin(), entries.end(), [](const EntryInfo &left, const EntryInfo &right) {
+      return left.LastUsedTime < right.LastUsedTime;
+    });
+
+    // Entries mapped by running instances cannot be deleted. They are evicted by a later call.
+    for (const EntryInfo &entry : entries) {
+      if (fs::remove(entry.Path, ec)) {
+        totalSize -= entry.Size;
+        if (totalSize <= diskBudget_) {
+          break;
+        }
+      }
+    }
+  } catch (const std::exception &) {
+  }
+}
+
 } // namespace react
 } // namespace facebook
@@ -7,7 +7,9 @@
 #include <jsi/jsi.h>
 
 #include <algorithm>
+#include <filesystem>
 #include <fstream>
+#include <mutex>
 #include <tuple>
 #include <vector>
 
@@ -30,10 +32,15 @@ class LocalFileSimpleBufferStore : public BufferStore {
   std::string storeDirectory_;
 };
 
+// Fast non-cryptographic 64 bit hash (xxHash64) of the buffer content. It never returns 0, which is reserved for an
+// unknown script version.
+uint64_t ComputeContentHash(const uint8_t *data, size_t size) noexcept;
+
 struct ScriptVersionProvider {
   virtual facebook::jsi::ScriptVersion_t getVersion(const std::string &url) noexcept = 0;
 };
 
+// Uses the content hash of the local file as the script version.
 class LocalFileSimpleScriptVersionProvider : public ScriptVersionProvider {
  public:
   facebook::jsi::ScriptVersion_t getVersion(const std::string &url) noexcept override;
@@ -72,9 +79,46 @@ class BasePreparedScriptStoreImpl : public facebook::jsi::PreparedScriptStore {
   std::shared_ptr<BufferStore> bufferStore_;
 };
 
+// Prepared script store where the entries are addressed by the script version, expected to be the script content hash,
+// together with the runtime signature and the prepare tag. Each entry has a header with the checksum of the prepared
+// script that is validated before the entry is returned, so a torn or corrupted entry is never evaluated. The entries
+// are memory mapped instead of copied to the heap. When the entries grow over the disk budget, the least recently
+// used entries are deleted.
+class ContentAddressedPreparedScriptStore : public facebook::jsi::PreparedScriptStore {
+ public:
+  static constexpr uint64_t DefaultDiskBudget = 64 * 1024 * 1024;
+
+  // The store directory is a UTF-8 path. The entries are kept in its subdirectory.
+  ContentAddressedPreparedScriptStore(const std::string &storeDirectory, uint64_t diskBudget = DefaultDiskBudget);
+
+  std::shared_ptr<const facebook::jsi::Buffer> tryGetPreparedScript(
+      const facebook::jsi::ScriptSignature &scriptSignature,
+      const facebook::jsi::JSRuntimeSignature &runtimeSignature,
+      const char *prepareTag) noexcept override;
+
+  void persistPreparedScript(
+      std::shared_ptr<const facebook::jsi::Buffer> preparedScript,
+      const facebook::jsi::ScriptSignature &scriptSignature,
+      const facebook::jsi::JSRuntimeSignature &runtimeSignature,
+      const char *prepareTag) noexcept override;
+
+ private:
+  std::string getEntryFileName(
+      const facebook::jsi::ScriptSignature &scriptSignature,
+      const facebook::jsi::JSRuntimeSignature &runtimeSignature,
+      const char *prepareTag);
+
+  // Deletes the least recently used entries, except the kept one, until the entries fit into the disk budget.
+  void evictEntries(const std::filesystem::path &keptEntryPath) noexcept;
+
+  std::string storeDirectory_;
+  uint64_t diskBudget_;
+  std::mutex mutex_;
+};
+
 // Dead simple script store implementation assuming that the script url is a
-// local filesystam path and assuming the script version is the script size, but
-// with extension point to provide custom version provider.
+// local filesystam path and assuming the script version is the script content
+// hash, but with extension point to provide custom version provider.
 class BaseScriptStoreImpl : public facebook::jsi::ScriptStore {
  public:
   facebook::jsi::VersionedBuffer getVersionedScript(const std::string &url) noexcept override;
@@ -52,6 +52,8 @@ ChakraRuntimeArgs ChakraRuntimeHolder::RuntimeArgsFromDevSettings(
 
   runtimeArgs.enableJITCompilation = devSettings->useJITCompilation;
 
+  runtimeArgs.enableBackgroundScriptPreparation = devSettings->useBackgroundScriptPreparation;
+
   runtimeArgs.memoryTracker = devSettings->memoryTracker;
 
   return runtimeArgs;
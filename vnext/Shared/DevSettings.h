@@ -57,6 +57,13 @@ struct DevSettings {
   /// For direct debugging, break on the next line of JavaScript executed
   bool debuggerBreakOnNextLine{false};
 
+  /// For the runtimes with a prepared script store, generate the missing
+  /// prepared scripts (bytecode) in background instead of before the script
+  /// evaluation. The first run evaluates the script from source, and the
+  /// following runs use the prepared script. Chakra in the desktop instance
+  /// uses a prepared script store only when this flag is set.
+  bool useBackgroundScriptPreparation{false};
+
   /// Enable function nativePerformanceNow.
   /// Method nativePerformanceNow() returns high resolution time info.
   /// It is not safe to expose to Custom Function. Add this flag so we can turn
@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 
 #include "ChakraRuntime.h"
+#include "ChakraRuntimeFactory.h"
 
 #include "Unicode.h"
 #include "Utilities.h"
@@ -9,7 +10,10 @@
 #include <MemoryTracker.h>
 #include <cxxreact/MessageQueueThread.h>
 
+#include <atomic>
+#include <chrono>
 #include <cstring>
+#include <functional>
 #include <limits>
 #include <mutex>
 #include <sstream>
@@ -36,6 +40,42 @@ struct HostFunctionWrapper final {
   ChakraRuntime &m_runtime;
 };
 
+struct PreparedScriptCounters {
+  std::atomic<uint64_t> hitCount{0};
+  std::atomic<uint64_t> missCount{0};
+  std::atomic<uint64_t> generatedCount{0};
+  std::atomic<uint64_t> failedCount{0};
+  std::atomic<uint64_t> generationMicroseconds{0};
+} s_preparedScriptCounters;
+
+// Scripts being prepared in background, so that the runtimes evaluating the same script prepare it only once.
+std::mutex s_pendingPreparationsMutex;
+std::unordered_set<std::string> s_pendingPreparations;
+
+// Runs the work on a thread pool thread with the low callback priority, so that it does not compete with the app
+// startup work.
+bool SubmitLowPriorityWork(std::function<void()> &&work) noexcept {
+  auto context = std::make_unique<std::function<void()>>(std::move(work));
+
+  TP_CALLBACK_ENVIRON callbackEnvironment;
+  InitializeThreadpoolEnvironment(&callbackEnvironment);
+  SetThreadpoolCallbackPriority(&callbackEnvironment, TP_CALLBACK_PRIORITY_LOW);
+  bool isSubmitted = TrySubmitThreadpoolCallback(
+      [](PTP_CALLBACK_INSTANCE /*instance*/, void *context) {
+        std::unique_ptr<std::function<void()>> work{static_cast<std::function<void()> *>(context)};
+        (*work)();
+      },
+      context.get(),
+      &callbackEnvironment);
+  DestroyThreadpoolEnvironment(&callbackEnvironment);
+
+  if (isSubmitted) {
+    context.release();
+  }
+
+  return isSubmitted;
+}
+
 } // namespace
 
 ChakraRuntime::ChakraRuntime(ChakraRuntimeArgs &&args) noexcept : m_args{std::move(args)} {
@@ -126,7 +166,7 @@ facebook::jsi::Value ChakraRuntime::evaluateJavaScript(
     const std::string &sourceURL) {
   // Simple evaluate if scriptStore not available as it's risky to utilize the
   // byte codes without checking the script version.
-  if (!runtimeArgs().scriptStore) {
+  if (!runtimeArgs().scriptStore || !runtimeArgs().preparedScriptStore) {
     if (!buffer)
       throw facebook::jsi::JSINativeException("Script buffer is empty!");
     return evaluateJavaScriptSimple(*buffer, sourceURL);
@@ -163,13 +203,20 @@ facebook::jsi::Value ChakraRuntime::evaluateJavaScript(
 
   std::shared_ptr<const facebook::jsi::Buffer> sharedPreparedScript;
   if (preparedScript) {
+    ++s_preparedScriptCounters.hitCount;
     sharedPreparedScript = std::shared_ptr<const facebook::jsi::Buffer>(std::move(preparedScript));
+  } else if (runtimeArgs().enableBackgroundScriptPreparation) {
+    // Keep the prepared script generation off the critical path. The next run evaluates the persisted prepared script.
+    ++s_preparedScriptCounters.missCount;
+    schedulePreparedScriptGeneration(sharedScriptBuffer, scriptSignature, runtimeSignature);
+    return evaluateJavaScriptSimple(*sharedScriptBuffer, sourceURL);
   } else {
+    ++s_preparedScriptCounters.missCount;
     auto genPreparedScript = generatePreparedScript(sourceURL, *sharedScriptBuffer);
-    if (!genPreparedScript)
-      std::terminate(); // Cache generation can't fail unless something really
-                        // wrong. but we should get rid of this abort before
-                        // shipping.
+    if (!genPreparedScript) {
+      // The script cannot be serialized, e.g. because of a syntax error, which the simple evaluation reports.
+      return evaluateJavaScriptSimple(*sharedScriptBuffer, sourceURL);
+    }
 
     sharedPreparedScript = std::shared_ptr<const facebook::jsi::Buffer>(std::move(genPreparedScript));
     runtimeArgs().preparedScriptStore->persistPreparedScript(
@@ -193,6 +240,74 @@ facebook::jsi::Value ChakraRuntime::evaluateJavaScript(
   return evaluateJavaScriptSimple(*sharedScriptBuffer, sourceURL);
 }
 
+void ChakraRuntime::schedulePreparedScriptGeneration(
+    std::shared_ptr<const facebook::jsi::Buffer> scriptBuffer,
+    const facebook::jsi::ScriptSignature &scriptSignature,
+    const facebook::jsi::JSRuntimeSignature &runtimeSignature) noexcept {
+  std::string preparationKey = scriptSignature.url + '@' + std::to_string(scriptSignature.version);
+  {
+    std::lock_guard<std::mutex> lock{s_pendingPreparationsMutex};
+    if (!s_pendingPreparations.insert(preparationKey).second) {
+      return;
+    }
+  }
+
+  bool isSubmitted = SubmitLowPriorityWork([scriptBuffer = std::move(scriptBuffer),
+                                            scriptSignature,
+                                            runtimeSignature,
+                                            preparedScriptStore = runtimeArgs().preparedScriptStore,
+                                            logger = runtimeArgs().loggingCallback,
+                                            preparationKey]() {
+    auto start = std::chrono::steady_clock::now();
+
+    // The serialization needs a current context, so we create a runtime which lives only for the generation.
+    std::unique_ptr<const facebook::jsi::Buffer> preparedScript;
+    JsRuntimeHandle runtime{JS_INVALID_RUNTIME_HANDLE};
+    if (JsCreateRuntime(
+            static_cast<JsRuntimeAttributes>(
+                JsRuntimeAttributeDisableBackgroundWork | JsRuntimeAttributeDisableNativeCodeGeneration),
+            nullptr,
+            &runtime) == JsNoError) {
+      JsContextRef context{JS_INVALID_REFERENCE};
+      if (JsCreateContext(runtime, &context) == JsNoError && JsSetCurrentContext(context) == JsNoError) {
+        preparedScript = generatePreparedScript(scriptSignature.url, *scriptBuffer);
+        JsSetCurrentContext(JS_INVALID_REFERENCE);
+      }
+
+      JsDisposeRuntime(runtime);
+    }
+
+    auto generationMicroseconds = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+    s_preparedScriptCounters.generationMicroseconds += generationMicroseconds;
+
+    if (preparedScript) {
+      // Count the generation before persisting it, so that the observers of the store see the updated counter.
+      ++s_preparedScriptCounters.generatedCount;
+      preparedScriptStore->persistPreparedScript(std::move(preparedScript), scriptSignature, runtimeSignature, nullptr);
+      if (logger) {
+        std::string message = "Prepared script for " + scriptSignature.url + " generated in " +
+            std::to_string(generationMicroseconds / 1000) + "ms.";
+        logger(message.c_str(), LogLevel::Info);
+      }
+    } else {
+      ++s_preparedScriptCounters.failedCount;
+      if (logger) {
+        std::string message = "Failed to generate the prepared script for " + scriptSignature.url + ".";
+        logger(message.c_str(), LogLevel::Warning);
+      }
+    }
+
+    std::lock_guard<std::mutex> lock{s_pendingPreparationsMutex};
+    s_pendingPreparations.erase(preparationKey);
+  });
+
+  if (!isSubmitted) {
+    std::lock_guard<std::mutex> lock{s_pendingPreparationsMutex};
+    s_pendingPreparations.erase(preparationKey);
+  }
+}
+
 struct ChakraPreparedJavaScript final : facebook::jsi::PreparedJavaScript {
   ChakraPreparedJavaScript(
       std::string sourceUrl,
@@ -999,4 +1114,14 @@ std::unique_ptr<facebook::jsi::Runtime> makeChakraRuntime(ChakraRuntimeArgs &&ar
   return std::make_unique<ChakraRuntime>(std::move(args));
 }
 
+PreparedScriptStats getPreparedScriptStats() noexcept {
+  PreparedScriptStats stats;
+  stats.hitCount = s_preparedScriptCounters.hitCount;
+  stats.missCount = s_preparedScriptCounters.missCount;
+  stats.generatedCount = s_preparedScriptCounters.generatedCount;
+  stats.failedCount = s_preparedScriptCounters.failedCount;
+  stats.generationMicroseconds = s_preparedScriptCounters.generationMicroseconds;
+  return stats;
+}
+
 } // namespace Microsoft::JSI
@@ -350,9 +350,14 @@ class ChakraRuntime : public facebook::jsi::Runtime, ChakraApi, ChakraApi::IExce
   }
 
   // Miscellaneous
-  std::unique_ptr<const facebook::jsi::Buffer> generatePreparedScript(
+  // Generates the prepared script in the current context.
+  static std::unique_ptr<const facebook::jsi::Buffer> generatePreparedScript(
       const std::string &sourceURL,
       const facebook::jsi::Buffer &sourceBuffer) noexcept;
+  void schedulePreparedScriptGeneration(
+      std::shared_ptr<const facebook::jsi::Buffer> scriptBuffer,
+      const facebook::jsi::ScriptSignature &scriptSignature,
+      const facebook::jsi::JSRuntimeSignature &runtimeSignature) noexcept;
   facebook::jsi::Value evaluateJavaScriptSimple(const facebook::jsi::Buffer &buffer, const std::string &sourceURL);
   bool evaluateSerializedScript(
       const facebook::jsi::Buffer &scriptBuffer,
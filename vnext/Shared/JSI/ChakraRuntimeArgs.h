@@ -44,7 +44,12 @@ struct ChakraRuntimeArgs {
   // Script store which manages script and prepared script storage and
   // versioning.
   std::unique_ptr<facebook::jsi::ScriptStore> scriptStore;
-  std::unique_ptr<facebook::jsi::PreparedScriptStore> preparedScriptStore;
+  std::shared_ptr<facebook::jsi::PreparedScriptStore> preparedScriptStore;
+
+  // When the prepared script store has no entry for an evaluated script, evaluate the script from source and generate
+  // the prepared script on a low priority background thread. Otherwise, the prepared script is generated before the
+  // evaluation on the JS thread.
+  bool enableBackgroundScriptPreparation{false};
 };
 
 } // namespace Microsoft::JSI
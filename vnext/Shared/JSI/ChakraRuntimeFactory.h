@@ -5,10 +5,23 @@
 
 #include <jsi/jsi.h>
 
+#include <cstdint>
+
 namespace Microsoft::JSI {
 
 struct ChakraRuntimeArgs;
 
 std::unique_ptr<facebook::jsi::Runtime> makeChakraRuntime(ChakraRuntimeArgs &&args) noexcept;
 
+// Process-wide counters of the prepared script store use by the Chakra runtimes.
+struct PreparedScriptStats {
+  uint64_t hitCount{0}; // scripts evaluated from the stored prepared scripts
+  uint64_t missCount{0}; // scripts without a stored prepared script
+  uint64_t generatedCount{0}; // prepared scripts generated and persisted in background
+  uint64_t failedCount{0}; // background generations that failed
+  uint64_t generationMicroseconds{0}; // total time of the background generations
+};
+
+PreparedScriptStats getPreparedScriptStats() noexcept;
+
 } // namespace Microsoft::JSI
@@ -7,6 +7,8 @@
 #include <werapi.h>
 #include <windows.h>
 
+#include <string>
+
 namespace {
 
 class MemoryMappedBuffer : public facebook::jsi::Buffer {
@@ -34,18 +36,23 @@ MemoryMappedBuffer::MemoryMappedBuffer(const wchar_t *const filename, uint32_t o
     throw facebook::jsi::JSINativeException("MemoryMappedBuffer constructor is called with nullptr filename.");
   }
 
+  // The mapping keeps the file open with this share mode until the buffer is destroyed. FILE_SHARE_DELETE lets an
+  // updater rename, delete, or replace the file while it is mapped. Writing to the file in place is still denied,
+  // because it would change the mapped data.
+  constexpr DWORD shareMode = FILE_SHARE_READ | FILE_SHARE_DELETE;
+
   // Because we still need to support Windows 7, and APIs such as CreateFile2
   // and CreateFileMappingFromApp are only available on Windows 8+, we currently
   // use APIs such as CreateFileW and CreateFileMapping for Win32.
 #if (defined(WINRT))
   std::unique_ptr<void, decltype(&CloseHandle)> fileHandle{
-      CreateFile2(filename, GENERIC_READ, FILE_SHARE_READ, OPEN_EXISTING, nullptr /* pCreateExParams */), &CloseHandle};
+      CreateFile2(filename, GENERIC_READ, shareMode, OPEN_EXISTING, nullptr /* pCreateExParams */), &CloseHandle};
 #else
   std::unique_ptr<void, decltype(&CloseHandle)> fileHandle{
       CreateFileW(
           filename,
           GENERIC_READ,
-          FILE_SHARE_READ,
+          shareMode,
           nullptr /* lpSecurityAttributes */,
           OPEN_EXISTING,
           FILE_ATTRIBUTE_NORMAL,
@@ -124,6 +131,47 @@ const uint8_t *MemoryMappedBuffer::data() const {
   return static_cast<const uint8_t *>(m_fileData.get()) + m_offset;
 }
 
+uint32_t GetPageSize() noexcept {
+  SYSTEM_INFO systemInfo;
+  GetSystemInfo(&systemInfo);
+  return systemInfo.dwPageSize;
+}
+
+class MemoryMappedBigString : public facebook::react::JSBigString {
+ public:
+  MemoryMappedBigString(const wchar_t *const filename);
+
+  bool isAscii() const override;
+  const char *c_str() const override;
+  size_t size() const override;
+
+ private:
+  MemoryMappedBuffer m_buffer;
+  std::string m_nullTerminatedCopy;
+};
+
+MemoryMappedBigString::MemoryMappedBigString(const wchar_t *const filename) : m_buffer{filename, 0} {
+  // The view is zero-filled from the end of the file to the end of its last page, so c_str() can return the mapped
+  // data as is. A file that ends on a page boundary has no room for the null terminator and is copied instead.
+  static const uint32_t s_pageSize = GetPageSize();
+  if (m_buffer.size() % s_pageSize == 0) {
+    m_nullTerminatedCopy.assign(reinterpret_cast<const char *>(m_buffer.data()), m_buffer.size());
+  }
+}
+
+bool MemoryMappedBigString::isAscii() const {
+  return false;
+}
+
+const char *MemoryMappedBigString::c_str() const {
+  return m_nullTerminatedCopy.empty() ? reinterpret_cast<const char *>(m_buffer.data())
+                                      : m_nullTerminatedCopy.c_str();
+}
+
+size_t MemoryMappedBigString::size() const {
+  return m_buffer.size();
+}
+
 } // anonymous namespace
 
 namespace Microsoft::JSI {
@@ -132,4 +180,8 @@ std::shared_ptr<facebook::jsi::Buffer> MakeMemoryMappedBuffer(const wchar_t *con
   return std::make_shared<MemoryMappedBuffer>(filename, offset);
 }
 
+std::unique_ptr<const facebook::react::JSBigString> MakeMemoryMappedBigString(const wchar_t *const filename) {
+  return std::make_unique<MemoryMappedBigString>(filename);
+}
+
 } // namespace Microsoft::JSI
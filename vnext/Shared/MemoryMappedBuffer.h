@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <cxxreact/JSBigString.h>
 #include <jsi/jsi.h>
 
 #include <memory>
@@ -11,6 +12,13 @@ namespace Microsoft::JSI {
 
 // We only support files whose size can fit within an uint32_t. Memory
 // mapping an empty or a larger file fails.
+// The file stays open until the buffer is destroyed. It can be renamed, deleted, or replaced by another file in the
+// meantime, but it cannot be opened for writing.
 std::shared_ptr<facebook::jsi::Buffer> MakeMemoryMappedBuffer(const wchar_t *const filename, uint32_t offset = 0);
 
+// Maps a script file, e.g. a JS bundle, as a read-only JSBigString. The script pages are shared with the file cache
+// and loaded on first access instead of being copied to the heap. The same restrictions as for
+// MakeMemoryMappedBuffer apply.
+std::unique_ptr<const facebook::react::JSBigString> MakeMemoryMappedBigString(const wchar_t *const filename);
+
 } // namespace Microsoft::JSI
@@ -6,6 +6,8 @@
 #include "AsyncStorageModuleWin32.h"
 #include "AsyncStorageModuleWin32Config.h"
 
+#include <AsyncStorage/JsonMerge.h>
+
 #include <cstdio>
 
 /// Implements AsyncStorageModule using winsqlite3.dll (requires Windows version 10.0.10586)
@@ -20,6 +22,11 @@ std::string &AsyncStorageDBPath() {
   return asyncStorageDBPath;
 }
 
+size_t &AsyncStorageValueCacheBudget() {
+  static size_t asyncStorageValueCacheBudget{1024 * 1024};
+  return asyncStorageValueCacheBudget;
+}
+
 void InvokeError(const CxxModule::Callback &callback, const char *message) {
   callback({folly::dynamic::object("message", message)});
 }
@@ -149,6 +156,10 @@ class Sqlite3Transaction final {
       return false;
     }
     auto result = Exec(m_db, *m_callback, "COMMIT");
+    if (!result) {
+      // A failed COMMIT, e.g. with SQLITE_BUSY, leaves the transaction open. The error is already reported.
+      sqlite3_exec(m_db, "ROLLBACK", nullptr, nullptr, nullptr);
+    }
     m_db = nullptr;
     m_callback = nullptr;
     return result;
@@ -194,6 +205,12 @@ Statement PrepareStatement(sqlite3 *db, const CxxModule::Callback &callback, con
   return {pStmt, &sqlite3_finalize};
 }
 
+// Releases a cached statement: clears its bindings and resets it, so it can be reused.
+int SQLITE_APICALL ResetStatement(sqlite3_stmt *stmt) {
+  sqlite3_clear_bindings(stmt);
+  return sqlite3_reset(stmt);
+}
+
 // Binds the index-th variable in this prepared statement to str.
 bool BindString(
     sqlite3 *db,
@@ -209,7 +226,7 @@ bool BindString(
 namespace facebook {
 namespace react {
 
-AsyncStorageModuleWin32::AsyncStorageModuleWin32() {
+AsyncStorageModuleWin32::AsyncStorageModuleWin32() : m_values{AsyncStorageValueCacheBudget()} {
   if (sqlite3_open_v2(
           AsyncStorageDBPath().c_str(),
           &m_db,
@@ -236,6 +253,10 @@ AsyncStorageModuleWin32::AsyncStorageModuleWin32() {
         m_db,
         "CREATE TABLE IF NOT EXISTS AsyncLocalStorage(key TEXT PRIMARY KEY, value TEXT NOT NULL); PRAGMA user_version=1");
   }
+
+  // With the write-ahead log a commit appends to the log instead of rewriting the pages
+  // in the database file, and readers do not block the writer.
+  Exec(m_db, "PRAGMA journal_mode=WAL");
 }
 
 AsyncStorageModuleWin32::~AsyncStorageModuleWin32() {
@@ -252,6 +273,8 @@ AsyncStorageModuleWin32::~AsyncStorageModuleWin32() {
       m_cv.wait(m_lock, [this]() { return m_action == nullptr; });
     }
   }
+  // The connection cannot be closed while it has prepared statements.
+  m_statements.clear();
   sqlite3_close(m_db);
 }
 
@@ -263,10 +286,15 @@ std::map<std::string, dynamic> AsyncStorageModuleWin32::getConstants() {
   return {};
 }
 
+AsyncStorageModuleWin32::ValueCacheStats AsyncStorageModuleWin32::GetValueCacheStats() const noexcept {
+  return m_values.stats();
+}
+
 std::vector<CxxModule::Method> AsyncStorageModuleWin32::getMethods() {
   return {
       Method("multiGet", this, &AsyncStorageModuleWin32::multiGet),
       Method("multiSet", this, &AsyncStorageModuleWin32::multiSet),
+      Method("multiMerge", this, &AsyncStorageModuleWin32::multiMerge),
       Method("multiRemove", this, &AsyncStorageModuleWin32::multiRemove),
       Method("clear", this, &AsyncStorageModuleWin32::clear),
       Method("getAllKeys", this, &AsyncStorageModuleWin32::getAllKeys)};
@@ -288,6 +316,14 @@ void AsyncStorageModuleWin32::multiSet(folly::dynamic args, Callback jsCallback)
   }
   AddTask(DBTask::Type::multiSet, std::move(kvps), std::move(jsCallback));
 }
+void AsyncStorageModuleWin32::multiMerge(folly::dynamic args, Callback jsCallback) {
+  auto &kvps = args[0];
+  if (kvps.size() == 0) {
+    jsCallback({});
+    return;
+  }
+  AddTask(DBTask::Type::multiMerge, std::move(kvps), std::move(jsCallback));
+}
 void AsyncStorageModuleWin32::multiRemove(folly::dynamic args, Callback jsCallback) {
   auto &keys = args[0];
   if (keys.size() == 0) {
@@ -339,10 +375,20 @@ winrt::Windows::Foundation::IAsyncAction AsyncStorageModuleWin32::RunTasks() {
       db = m_db;
     }
 
-    for (auto &task : tasks) {
-      task(db);
-      if (cancellationToken())
-        break;
+    // Consecutive write tasks are committed together. Read tasks run between the commits,
+    // so they observe only the committed writes of the preceding tasks.
+    for (size_t i = 0; i < tasks.size() && !cancellationToken();) {
+      size_t groupEnd = i;
+      while (groupEnd < tasks.size() && tasks[groupEnd].isWrite())
+        groupEnd++;
+
+      if (groupEnd - i > 1) {
+        RunWriteTasks(db, &tasks[i], &tasks[0] + groupEnd);
+        i = groupEnd;
+      } else {
+        tasks[i](db, m_statements, m_values);
+        i++;
+      }
     }
   }
   winrt::slim_lock_guard guard(m_lock);
@@ -350,19 +396,158 @@ winrt::Windows::Foundation::IAsyncAction AsyncStorageModuleWin32::RunTasks() {
   m_cv.notify_all();
 }
 
-void AsyncStorageModuleWin32::DBTask::operator()(sqlite3 *db) {
+// Group commit: runs the write tasks in one transaction, so they pay for one commit instead of one each.
+// Each task is applied in its own savepoint. A failed task is rolled back and reports its error, and
+// the other tasks report their success or the commit error when the transaction is committed.
+void AsyncStorageModuleWin32::RunWriteTasks(sqlite3 *db, DBTask *first, DBTask *last) {
+  std::vector<DBTask *> pendingTasks;
+  for (auto task = first; task != last; ++task) {
+    pendingTasks.push_back(task);
+  }
+
+  Callback transactionCallback = [&pendingTasks](std::vector<folly::dynamic> args) {
+    for (auto task : pendingTasks) {
+      task->callback()(args);
+    }
+  };
+
+  Sqlite3Transaction transaction(db, transactionCallback);
+  if (!transaction) {
+    return;
+  }
+
+  pendingTasks.clear();
+  for (auto task = first; task != last; ++task) {
+    if (task->apply(db, m_statements)) {
+      pendingTasks.push_back(task);
+    }
+  }
+
+  if (!transaction.Commit()) {
+    return;
+  }
+
+  for (auto task : pendingTasks) {
+    task->complete(m_values);
+  }
+}
+
+AsyncStorageModuleWin32::StatementCache::Statement AsyncStorageModuleWin32::StatementCache::get(
+    sqlite3 *db,
+    const Callback &callback,
+    Kind kind,
+    int argCount) {
+  auto key = std::make_pair(kind, argCount);
+  auto it = m_statements.find(key);
+  if (it == m_statements.end()) {
+    std::string sql;
+    switch (kind) {
+      case Kind::multiGet:
+        sql = MakeSQLiteParameterizedStatement("SELECT key, value FROM AsyncLocalStorage WHERE key IN ", argCount);
+        break;
+      case Kind::multiSet:
+        sql = "INSERT OR REPLACE INTO AsyncLocalStorage VALUES(?, ?)";
+        break;
+      case Kind::multiRemove:
+        sql = MakeSQLiteParameterizedStatement("DELETE FROM AsyncLocalStorage WHERE key IN ", argCount);
+        break;
+    }
+
+    auto pStmt = PrepareStatement(db, callback, sql.data());
+    if (!pStmt || m_statements.size() >= MaxSize) {
+      return pStmt; // not cached, so the caller finalizes it
+    }
+    it = m_statements.emplace(key, std::move(pStmt)).first;
+  }
+
+  return {it->second.get(), &ResetStatement};
+}
+
+void AsyncStorageModuleWin32::StatementCache::clear() noexcept {
+  m_statements.clear();
+}
+
+bool AsyncStorageModuleWin32::ValueCache::tryGet(const std::string &key, std::optional<std::string> &value) {
+  auto it = m_index.find(key);
+  if (it == m_index.end()) {
+    m_missCount.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+
+  m_hitCount.fetch_add(1, std::memory_order_relaxed);
+  m_entries.splice(m_entries.begin(), m_entries, it->second);
+  value = it->second->Value;
+  return true;
+}
+
+void AsyncStorageModuleWin32::ValueCache::put(const std::string &key, std::optional<std::string> value) {
+  erase(key);
+
+  // Values that take a big part of the budget would evict too many hot entries.
+  Entry entry{key, std::move(value)};
+  auto size = entrySize(entry);
+  if (size > m_budget / 8) {
+    return;
+  }
+
+  while (m_size + size > m_budget && !m_entries.empty()) {
+    evict(std::prev(m_entries.end()));
+    m_evictionCount.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  m_entries.push_front(std::move(entry));
+  m_index.emplace(m_entries.front().Key, m_entries.begin());
+  m_size += size;
+}
+
+void AsyncStorageModuleWin32::ValueCache::erase(const std::string &key) {
+  auto it = m_index.find(key);
+  if (it != m_index.end()) {
+    evict(it->second);
+  }
+}
+
+void AsyncStorageModuleWin32::ValueCache::clear() noexcept {
+  m_index.clear();
+  m_entries.clear();
+  m_size = 0;
+}
+
+AsyncStorageModuleWin32::ValueCacheStats AsyncStorageModuleWin32::ValueCache::stats() const noexcept {
+  ValueCacheStats stats;
+  stats.HitCount = m_hitCount.load(std::memory_order_relaxed);
+  stats.MissCount = m_missCount.load(std::memory_order_relaxed);
+  stats.EvictionCount = m_evictionCount.load(std::memory_order_relaxed);
+  return stats;
+}
+
+// The size includes an estimate of the list node and index overhead.
+size_t AsyncStorageModuleWin32::ValueCache::entrySize(const Entry &entry) noexcept {
+  return sizeof(Entry) + 64 + entry.Key.size() + (entry.Value ? entry.Value->size() : 0);
+}
+
+void AsyncStorageModuleWin32::ValueCache::evict(std::list<Entry>::iterator it) noexcept {
+  m_size -= entrySize(*it);
+  m_index.erase(it->Key);
+  m_entries.erase(it);
+}
+
+void AsyncStorageModuleWin32::DBTask::operator()(sqlite3 *db, StatementCache &statements, ValueCache &values) {
   switch (m_type) {
     case Type::multiGet:
-      multiGet(db);
+      multiGet(db, statements, values);
       break;
     case Type::multiSet:
-      multiSet(db);
+      multiSet(db, statements, values);
+      break;
+    case Type::multiMerge:
+      multiMerge(db, statements, values);
       break;
     case Type::multiRemove:
-      multiRemove(db);
+      multiRemove(db, statements, values);
       break;
     case Type::clear:
-      clear(db);
+      clear(db, values);
       break;
     case Type::getAllKeys:
       getAllKeys(db);
@@ -370,22 +555,107 @@ void AsyncStorageModuleWin32::DBTask::operator()(sqlite3 *db) {
   }
 }
 
-void AsyncStorageModuleWin32::DBTask::multiGet(sqlite3 *db) {
+bool AsyncStorageModuleWin32::DBTask::isWrite() const {
+  return m_type == Type::multiSet || m_type == Type::multiMerge || m_type == Type::multiRemove ||
+      m_type == Type::clear;
+}
+
+// Applies the write task in a savepoint of the current transaction. On error, rolls back
+// the savepoint and reports the error to the task callback.
+bool AsyncStorageModuleWin32::DBTask::apply(sqlite3 *db, StatementCache &statements) {
+  if (!Exec(db, m_callback, "SAVEPOINT DBTask")) {
+    return false;
+  }
+
+  bool applied = false;
+  switch (m_type) {
+    case Type::multiSet:
+      applied = applyMultiSet(db, statements);
+      break;
+    case Type::multiMerge:
+      applied = applyMultiMerge(db, statements);
+      break;
+    case Type::multiRemove:
+      applied = applyMultiRemove(db, statements);
+      break;
+    case Type::clear:
+      applied = applyClear(db);
+      break;
+    default:
+      InvokeError(m_callback, "Not a write task");
+      break;
+  }
+
+  if (applied && Exec(db, m_callback, "RELEASE DBTask")) {
+    return true;
+  }
+
+  // The error is already reported.
+  sqlite3_exec(db, "ROLLBACK TO DBTask; RELEASE DBTask", nullptr, nullptr, nullptr);
+  return false;
+}
+
+// Write-through: the committed changes are applied to the value cache.
+void AsyncStorageModuleWin32::DBTask::complete(ValueCache &values) {
+  switch (m_type) {
+    case Type::multiSet:
+      for (auto &&arg : m_args) {
+        values.put(arg[0].getString(), arg[1].getString());
+      }
+      break;
+    case Type::multiMerge:
+      // The merged values are not kept by the task. They are read from the database when needed.
+      for (auto &&arg : m_args) {
+        values.erase(arg[0].getString());
+      }
+      break;
+    case Type::multiRemove:
+      for (auto &&key : m_args) {
+        values.put(key.getString(), std::nullopt);
+      }
+      break;
+    case Type::clear:
+      values.clear();
+      break;
+    default:
+      break;
+  }
+  m_callback({});
+}
+
+void AsyncStorageModuleWin32::DBTask::multiGet(sqlite3 *db, StatementCache &statements, ValueCache &values) {
   folly::dynamic result = folly::dynamic::array;
   if (!CheckArgs(db, m_args, m_callback)) {
     return;
   }
 
-  auto argCount = static_cast<int>(m_args.size());
-  auto sql = MakeSQLiteParameterizedStatement("SELECT key, value FROM AsyncLocalStorage WHERE key IN ", argCount);
-  auto pStmt = PrepareStatement(db, m_callback, sql.data());
+  // Only the keys that are not cached are read from the database.
+  std::vector<const std::string *> missedKeys;
+  std::optional<std::string> cachedValue;
+  for (auto &&arg : m_args) {
+    auto &key = arg.getString();
+    if (!values.tryGet(key, cachedValue)) {
+      missedKeys.push_back(&key);
+    } else if (cachedValue) {
+      result.push_back(folly::dynamic::array(key, std::move(*cachedValue)));
+    }
+  }
+  if (missedKeys.empty()) {
+    m_callback({{}, result});
+    return;
+  }
+
+  auto argCount = static_cast<int>(missedKeys.size());
+  auto pStmt = statements.get(db, m_callback, StatementCache::Kind::multiGet, argCount);
   if (!pStmt) {
     return;
   }
   for (int i = 0; i < argCount; i++) {
-    if (!BindString(db, m_callback, pStmt, i + 1, m_args[i].getString()))
+    if (!BindString(db, m_callback, pStmt, i + 1, *missedKeys[i]))
       return;
   }
+
+  std::vector<std::pair<std::string, std::string>> rows;
   for (auto stepResult = sqlite3_step(pStmt.get()); stepResult != SQLITE_DONE; stepResult = sqlite3_step(pStmt.get())) {
     if (stepResult != SQLITE_ROW) {
       InvokeError(m_callback, sqlite3_errmsg(db));
@@ -402,69 +672,164 @@ void AsyncStorageModuleWin32::DBTask::multiGet(sqlite3 *db) {
       InvokeError(m_callback, sqlite3_errmsg(db));
       return;
     }
+    rows.emplace_back(key, value);
     result.push_back(folly::dynamic::array(key, value));
   }
+
+  // The keys that are not found in the database are cached as missing.
+  for (auto key : missedKeys) {
+    values.put(*key, std::nullopt);
+  }
+  for (auto &row : rows) {
+    values.put(row.first, std::move(row.second));
+  }
   m_callback({{}, result});
 }
 
-void AsyncStorageModuleWin32::DBTask::multiSet(sqlite3 *db) {
+void AsyncStorageModuleWin32::DBTask::multiSet(sqlite3 *db, StatementCache &statements, ValueCache &values) {
   Sqlite3Transaction transaction(db, m_callback);
   if (!transaction) {
     return;
   }
-  auto pStmt = PrepareStatement(db, m_callback, "INSERT OR REPLACE INTO AsyncLocalStorage VALUES(?, ?)");
-  if (!pStmt) {
+  if (!applyMultiSet(db, statements)) {
+    return;
+  }
+  if (!transaction.Commit()) {
     return;
   }
+  complete(values);
+}
+
+bool AsyncStorageModuleWin32::DBTask::applyMultiSet(sqlite3 *db, StatementCache &statements) {
+  auto pStmt = statements.get(db, m_callback, StatementCache::Kind::multiSet, 2);
+  if (!pStmt) {
+    return false;
+  }
   for (auto &&arg : m_args) {
     if (!BindString(db, m_callback, pStmt, 1, arg[0].getString()) ||
         !BindString(db, m_callback, pStmt, 2, arg[1].getString())) {
-      return;
+      return false;
     }
     auto rc = sqlite3_step(pStmt.get());
     if (rc != SQLITE_DONE && !CheckSQLiteResult(db, m_callback, rc)) {
-      return;
+      return false;
     }
     if (!CheckSQLiteResult(db, m_callback, sqlite3_reset(pStmt.get()))) {
-      return;
+      return false;
     }
   }
+  return true;
+}
+
+void AsyncStorageModuleWin32::DBTask::multiMerge(sqlite3 *db, StatementCache &statements, ValueCache &values) {
+  Sqlite3Transaction transaction(db, m_callback);
+  if (!transaction) {
+    return;
+  }
+  if (!applyMultiMerge(db, statements)) {
+    return;
+  }
   if (!transaction.Commit()) {
     return;
   }
-  m_callback({});
+  complete(values);
+}
+
+// Reads the current values, merges the patches into them, and writes the merged values back
+// in the caller's transaction.
+bool AsyncStorageModuleWin32::DBTask::applyMultiMerge(sqlite3 *db, StatementCache &statements) {
+  auto selectStmt = statements.get(db, m_callback, StatementCache::Kind::multiGet, 1);
+  if (!selectStmt) {
+    return false;
+  }
+  auto insertStmt = statements.get(db, m_callback, StatementCache::Kind::multiSet, 2);
+  if (!insertStmt) {
+    return false;
+  }
+  for (auto &&arg : m_args) {
+    auto &key = arg[0].getString();
+    auto &patch = arg[1].getString();
+    if (!BindString(db, m_callback, selectStmt, 1, key)) {
+      return false;
+    }
+
+    std::string mergedValue;
+    auto rc = sqlite3_step(selectStmt.get());
+    if (rc == SQLITE_ROW) {
+      auto value = reinterpret_cast<const char *>(sqlite3_column_text(selectStmt.get(), 1));
+      if (!value) {
+        InvokeError(m_callback, sqlite3_errmsg(db));
+        return false;
+      }
+      try {
+        mergedValue = JsonMerge::mergeJson(value, patch);
+      } catch (const std::exception &e) {
+        InvokeError(m_callback, e.what());
+        return false;
+      }
+    } else if (rc == SQLITE_DONE) {
+      mergedValue = patch;
+    } else {
+      InvokeError(m_callback, sqlite3_errmsg(db));
+      return false;
+    }
+    if (!CheckSQLiteResult(db, m_callback, sqlite3_reset(selectStmt.get()))) {
+      return false;
+    }
+
+    if (!BindString(db, m_callback, insertStmt, 1, key) || !BindString(db, m_callback, insertStmt, 2, mergedValue)) {
+      return false;
+    }
+    rc = sqlite3_step(insertStmt.get());
+    if (rc != SQLITE_DONE && !CheckSQLiteResult(db, m_callback, rc)) {
+      return false;
+    }
+    if (!CheckSQLiteResult(db, m_callback, sqlite3_reset(insertStmt.get()))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void AsyncStorageModuleWin32::DBTask::multiRemove(sqlite3 *db, StatementCache &statements, ValueCache &values) {
+  if (applyMultiRemove(db, statements)) {
+    complete(values);
+  }
 }
 
-void AsyncStorageModuleWin32::DBTask::multiRemove(sqlite3 *db) {
+bool AsyncStorageModuleWin32::DBTask::applyMultiRemove(sqlite3 *db, StatementCache &statements) {
   if (!CheckArgs(db, m_args, m_callback)) {
-    return;
+    return false;
   }
 
   auto argCount = static_cast<int>(m_args.size());
-  auto sql = MakeSQLiteParameterizedStatement("DELETE FROM AsyncLocalStorage WHERE key IN ", argCount);
-  auto pStmt = PrepareStatement(db, m_callback, sql.data());
+  auto pStmt = statements.get(db, m_callback, StatementCache::Kind::multiRemove, argCount);
   if (!pStmt) {
-    return;
+    return false;
   }
   for (int i = 0; i < argCount; i++) {
     if (!BindString(db, m_callback, pStmt, i + 1, m_args[i].getString()))
-      return;
+      return false;
   }
   for (auto stepResult = sqlite3_step(pStmt.get()); stepResult != SQLITE_DONE; stepResult = sqlite3_step(pStmt.get())) {
     if (stepResult != SQLITE_ROW) {
       InvokeError(m_callback, sqlite3_errmsg(db));
-      return;
+      return false;
     }
   }
-  m_callback({});
+  return true;
 }
 
-void AsyncStorageModuleWin32::DBTask::clear(sqlite3 *db) {
-  if (Exec(db, m_callback, "DELETE FROM AsyncLocalStorage")) {
-    m_callback({});
+void AsyncStorageModuleWin32::DBTask::clear(sqlite3 *db, ValueCache &values) {
+  if (applyClear(db)) {
+    complete(values);
   }
 }
 
+bool AsyncStorageModuleWin32::DBTask::applyClear(sqlite3 *db) {
+  return Exec(db, m_callback, "DELETE FROM AsyncLocalStorage");
+}
+
 void AsyncStorageModuleWin32::DBTask::getAllKeys(sqlite3 *db) {
   folly::dynamic result = folly::dynamic::array;
   auto getAllKeysCallback = [&](int cCol, char **rgszColText, char **) {
@@ -492,5 +857,9 @@ REACTWINDOWS_API_(void) SetAsyncStorageDBPath(std::string &&dbPath) {
   AsyncStorageDBPath() = std::move(dbPath);
 }
 
+REACTWINDOWS_API_(void) SetAsyncStorageValueCacheBudget(size_t budget) {
+  AsyncStorageValueCacheBudget() = budget;
+}
+
 } // namespace windows
 } // namespace react
@@ -10,7 +10,13 @@
 
 #include <winrt/Windows.Foundation.h>
 #include <winsqlite/winsqlite3.h>
+#include <atomic>
+#include <list>
+#include <map>
 #include <memory>
+#include <optional>
+#include <string_view>
+#include <unordered_map>
 
 namespace facebook {
 namespace react {
@@ -23,39 +29,116 @@ class AsyncStorageModuleWin32 : public facebook::xplat::module::CxxModule {
   std::map<std::string, dynamic> getConstants() override;
   std::vector<facebook::xplat::module::CxxModule::Method> getMethods() override;
 
+  struct ValueCacheStats {
+    uint64_t HitCount{0}; // multiGet keys returned from the cache
+    uint64_t MissCount{0}; // multiGet keys read from the database
+    uint64_t EvictionCount{0}; // entries evicted to stay in the budget
+  };
+
+  // Can be called from any thread.
+  ValueCacheStats GetValueCacheStats() const noexcept;
+
  private:
+  // Bounded LRU cache of the values in front of the database. It lets multiGet return the hot keys
+  // without a database query. Keys known to be missing are cached too. The writes update the cache
+  // after they are committed. The cache is used only by the RunTasks coroutine, except for the stats.
+  class ValueCache {
+   public:
+    explicit ValueCache(size_t budget) noexcept : m_budget{budget} {}
+
+    // Returns true if the key is cached. The value is empty if the key is known to be missing.
+    bool tryGet(const std::string &key, std::optional<std::string> &value);
+    void put(const std::string &key, std::optional<std::string> value);
+    void erase(const std::string &key);
+    void clear() noexcept;
+    ValueCacheStats stats() const noexcept;
+
+   private:
+    struct Entry {
+      std::string Key;
+      std::optional<std::string> Value;
+    };
+
+    static size_t entrySize(const Entry &entry) noexcept;
+    void evict(std::list<Entry>::iterator it) noexcept;
+
+    const size_t m_budget;
+    size_t m_size{0};
+    std::list<Entry> m_entries; // the most recently used entries go first
+    std::unordered_map<std::string_view, std::list<Entry>::iterator> m_index; // the keys point to Entry::Key
+    std::atomic<uint64_t> m_hitCount{0};
+    std::atomic<uint64_t> m_missCount{0};
+    std::atomic<uint64_t> m_evictionCount{0};
+  };
+
+  // Prepared statements of the connection. The multiGet and multiRemove statements
+  // have a variable for each key, so they are cached for each argument count.
+  class StatementCache {
+   public:
+    using Statement = std::unique_ptr<sqlite3_stmt, decltype(&sqlite3_finalize)>;
+    enum class Kind { multiGet, multiSet, multiRemove };
+
+    // Returns a statement that is reset instead of being finalized when it is released.
+    Statement get(sqlite3 *db, const Callback &callback, Kind kind, int argCount);
+    void clear() noexcept;
+
+   private:
+    static const size_t MaxSize = 64;
+    std::map<std::pair<Kind, int>, Statement> m_statements;
+  };
+
   class DBTask {
    public:
-    enum class Type { multiGet, multiSet, multiRemove, clear, getAllKeys };
+    enum class Type { multiGet, multiSet, multiMerge, multiRemove, clear, getAllKeys };
     DBTask(Type type, folly::dynamic &&args, Callback &&callback)
         : m_type{type}, m_args{std::move(args)}, m_callback{std::move(callback)} {}
     DBTask(const DBTask &) = delete;
     DBTask(DBTask &&) = default;
     DBTask &operator=(const DBTask &) = delete;
     DBTask &operator=(DBTask &&) = default;
-    void operator()(sqlite3 *db);
+    void operator()(sqlite3 *db, StatementCache &statements, ValueCache &values);
+
+    // Write tasks can be applied in a transaction shared with other tasks.
+    // apply() reports errors to the task callback, and complete() updates the value cache
+    // and reports the success after the commit.
+    bool isWrite() const;
+    bool apply(sqlite3 *db, StatementCache &statements);
+    void complete(ValueCache &values);
+    const Callback &callback() const {
+      return m_callback;
+    }
 
    private:
     Type m_type;
     folly::dynamic m_args;
     Callback m_callback;
 
-    void multiGet(sqlite3 *db);
-    void multiSet(sqlite3 *db);
-    void multiRemove(sqlite3 *db);
-    void clear(sqlite3 *db);
+    void multiGet(sqlite3 *db, StatementCache &statements, ValueCache &values);
+    void multiSet(sqlite3 *db, StatementCache &statements, ValueCache &values);
+    void multiMerge(sqlite3 *db, StatementCache &statements, ValueCache &values);
+    void multiRemove(sqlite3 *db, StatementCache &statements, ValueCache &values);
+    void clear(sqlite3 *db, ValueCache &values);
     void getAllKeys(sqlite3 *db);
+
+    bool applyMultiSet(sqlite3 *db, StatementCache &statements);
+    bool applyMultiMerge(sqlite3 *db, StatementCache &statements);
+    bool applyMultiRemove(sqlite3 *db, StatementCache &statements);
+    bool applyClear(sqlite3 *db);
   };
   winrt::slim_mutex m_lock;
   winrt::slim_condition_variable m_cv;
   winrt::Windows::Foundation::IAsyncAction m_action{nullptr};
   std::vector<DBTask> m_tasks;
   sqlite3 *m_db;
+  StatementCache m_statements; // used only by the RunTasks coroutine
+  ValueCache m_values;
 
   // params - array<std::string> Keys , Callback(error, returnValue)
   void multiGet(folly::dynamic args, Callback jsCallback);
   // params - array<array<std::string>> KeyValuePairs , Callback(error)
   void multiSet(folly::dynamic args, Callback jsCallback);
+  // params - array<array<std::string>> KeyValuePairs , Callback(error)
+  void multiMerge(folly::dynamic args, Callback jsCallback);
   // params - array<std::string> Keys , Callback(error)
   void multiRemove(folly::dynamic args, Callback jsCallback);
   // params - args is unused, Callback(error)
@@ -68,6 +151,7 @@ class AsyncStorageModuleWin32 : public facebook::xplat::module::CxxModule {
     AddTask(type, folly::dynamic{}, std::move(jsCallback));
   }
   winrt::Windows::Foundation::IAsyncAction RunTasks();
+  void RunWriteTasks(sqlite3 *db, DBTask *first, DBTask *last);
 
   static std::string m_dbPath;
 };
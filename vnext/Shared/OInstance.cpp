@@ -43,16 +43,17 @@
 #include <Shlwapi.h>
 #include <WebSocketJSExecutorFactory.h>
 #include "PackagerConnection.h"
+#include "tracing/traceCategories.h"
 
 #if defined(USE_HERMES)
 #include "HermesRuntimeHolder.h"
 #endif
 #if defined(USE_V8)
-#include "BaseScriptStoreImpl.h"
 #include "V8JSIRuntimeHolder.h"
 #endif
 #include <ReactCommon/CallInvoker.h>
 #include <ReactCommon/TurboModuleBinding.h>
+#include "BaseScriptStoreImpl.h"
 #include "ChakraRuntimeHolder.h"
 
 #if (defined(_MSC_VER) && !defined(WINRT))
@@ -349,6 +350,23 @@ InstanceImpl::InstanceImpl(
           m_innerInstance->getJSCallInvoker());
     } else {
       assert(m_devSettings->jsiEngineOverride != JSIEngineOverride::Default);
+
+      // V8 and Chakra share the same prepared script store. Its entries are keyed by the runtime signature and by
+      // the content hash of the bundle file, which is the script version of BaseScriptStoreImpl.
+      // Chakra uses the store only when useBackgroundScriptPreparation is set, so that it never generates the
+      // prepared script on the startup path. Hermes cannot generate byte code at run time, so it does not use it.
+      std::unique_ptr<facebook::jsi::ScriptStore> scriptStore = nullptr;
+      std::unique_ptr<facebook::jsi::PreparedScriptStore> preparedScriptStore = nullptr;
+
+      bool usePreparedScriptStore = m_devSettings->jsiEngineOverride == JSIEngineOverride::V8 ||
+          (m_devSettings->jsiEngineOverride != JSIEngineOverride::Hermes &&
+           m_devSettings->useBackgroundScriptPreparation);
+      char tempPath[MAX_PATH];
+      if (usePreparedScriptStore && GetTempPathA(MAX_PATH, tempPath)) {
+        scriptStore = std::make_unique<facebook::react::BaseScriptStoreImpl>();
+        preparedScriptStore = std::make_unique<facebook::react::ContentAddressedPreparedScriptStore>(tempPath);
+      }
+
       switch (m_devSettings->jsiEngineOverride) {
         case JSIEngineOverride::Hermes:
 #if defined(USE_HERMES)
@@ -361,14 +379,6 @@ InstanceImpl::InstanceImpl(
 #endif
         case JSIEngineOverride::V8: {
 #if defined(USE_V8)
-          std::unique_ptr<facebook::jsi::ScriptStore> scriptStore = nullptr;
-          std::unique_ptr<facebook::jsi::PreparedScriptStore> preparedScriptStore = nullptr;
-
-          char tempPath[MAX_PATH];
-          if (GetTempPathA(MAX_PATH, tempPath)) {
-            preparedScriptStore = std::make_unique<facebook::react::BasePreparedScriptStoreImpl>(tempPath);
-          }
-
           m_devSettings->jsiRuntimeHolder = std::make_shared<facebook::react::V8JSIRuntimeHolder>(
               m_devSettings, m_jsThread, std::move(scriptStore), std::move(preparedScriptStore));
           break;
@@ -380,8 +390,8 @@ InstanceImpl::InstanceImpl(
         case JSIEngineOverride::Chakra:
         case JSIEngineOverride::ChakraCore:
         default: // TODO: Add other engines once supported
-          m_devSettings->jsiRuntimeHolder =
-              std::make_shared<Microsoft::JSI::ChakraRuntimeHolder>(m_devSettings, m_jsThread, nullptr, nullptr);
+          m_devSettings->jsiRuntimeHolder = std::make_shared<Microsoft::JSI::ChakraRuntimeHolder>(
+              m_devSettings, m_jsThread, std::move(scriptStore), std::move(preparedScriptStore));
           break;
       }
       jsef = std::make_shared<OJSIExecutorFactory>(
@@ -472,10 +482,12 @@ void InstanceImpl::loadBundleInternal(std::string &&jsBundleRelativePath, bool s
 #else
       std::string bundlePath = (fs::path(m_devSettings->bundleRootPath) / (jsBundleRelativePath + ".bundle")).string();
 
-      auto bundleString = std::make_unique<::react::uwp::StorageFileBigString>(bundlePath);
+      auto bundleString = ::react::uwp::LocalBundleReader::LoadBundleBigString(bundlePath);
       m_innerInstance->loadScriptFromString(std::move(bundleString), jsBundleRelativePath, synchronously);
 #endif
     }
+
+    RegisterForTraceCategoriesIfNecessary();
 #if defined(_CHAKRACORE_H_)
   } catch (const facebook::react::ChakraJSException &e) {
     m_devSettings->errorCallback(std::string{e.what()} + "\r\n" + e.getStack());
@@ -485,7 +497,27 @@ void InstanceImpl::loadBundleInternal(std::string &&jsBundleRelativePath, bool s
   }
 }
 
+void InstanceImpl::RegisterForTraceCategoriesIfNecessary() {
+#ifdef ENABLE_JS_SYSTRACE_TO_ETW
+  // The JS trace hooks are called only while Systrace.js is enabled. The bundle registers the Systrace module, so we
+  // start switching it with the JS trace category after the bundle load is queued.
+  if (m_traceCategoriesListenerId == 0) {
+    m_traceCategoriesListenerId = tracing::addTraceCategoriesListener(
+        [weakInstance = std::weak_ptr<Instance>(m_innerInstance)](uint64_t enabledCategories) noexcept {
+          if (auto instance = weakInstance.lock()) {
+            bool isEnabled = (enabledCategories & tracing::JSTraceCategory) != 0;
+            instance->callJSFunction("Systrace", "setEnabled", folly::dynamic::array(isEnabled));
+          }
+        });
+  }
+#endif
+}
+
 InstanceImpl::~InstanceImpl() {
+  if (m_traceCategoriesListenerId != 0) {
+    tracing::removeTraceCategoriesListener(m_traceCategoriesListenerId);
+  }
+
   m_nativeQueue->quitSynchronous();
 }
 
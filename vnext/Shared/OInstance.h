@@ -89,6 +89,7 @@ class InstanceImpl final : public InstanceWrapper, private ::std::enable_shared_
 
   std::vector<std::unique_ptr<NativeModule>> GetDefaultNativeModules(std::shared_ptr<MessageQueueThread> nativeQueue);
   void RegisterForReloadIfNecessary() noexcept;
+  void RegisterForTraceCategoriesIfNecessary();
   void loadBundleInternal(std::string &&jsBundleRelativePath, bool synchronously);
   void SetInError() noexcept;
 
@@ -104,6 +105,7 @@ class InstanceImpl final : public InstanceWrapper, private ::std::enable_shared_
   std::shared_ptr<IDevSupportManager> m_devManager;
   std::shared_ptr<DevSettings> m_devSettings;
   bool m_isInError{false};
+  uint32_t m_traceCategoriesListenerId{0};
 };
 
 } // namespace react
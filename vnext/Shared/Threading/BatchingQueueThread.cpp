@@ -9,8 +9,10 @@
 namespace react::uwp {
 
 BatchingQueueThread::BatchingQueueThread(
-    std::shared_ptr<facebook::react::MessageQueueThread> const &queueThread) noexcept
-    : m_queueThread{queueThread} {}
+    std::shared_ptr<facebook::react::MessageQueueThread> const &queueThread,
+    std::string_view instrumentationName) noexcept
+    : m_queueThread{queueThread},
+      m_stats{instrumentationName.empty() ? nullptr : Mso::DispatchQueue::MakeStatsRecorder(instrumentationName)} {}
 
 BatchingQueueThread::~BatchingQueueThread() noexcept {}
 
@@ -19,6 +21,9 @@ void BatchingQueueThread::runOnQueue(std::function<void()> &&func) noexcept {
 
   EnsureQueue();
   m_taskQueue->emplace_back(std::move(func));
+  if (m_stats) {
+    m_stats->RecordPost(m_taskQueue->size());
+  }
 
 //#define TRACK_UI_CALLS
 #ifdef TRACK_UI_CALLS
@@ -41,18 +46,53 @@ void BatchingQueueThread::ThreadCheck() noexcept {
 
 void BatchingQueueThread::EnsureQueue() noexcept {
   if (!m_taskQueue) {
-    m_taskQueue = std::make_shared<WorkItemQueue>();
-    m_taskQueue->reserve(2048);
+    {
+      std::scoped_lock lock{m_spareQueue->Mutex};
+      m_taskQueue = std::move(m_spareQueue->Queue);
+    }
+
+    if (!m_taskQueue) {
+      m_taskQueue = std::make_shared<WorkItemQueue>();
+      m_taskQueue->reserve(2048);
+    }
   }
 }
 
+/*static*/ void BatchingQueueThread::RecycleQueue(
+    SpareWorkItemQueue &spareQueue,
+    std::shared_ptr<WorkItemQueue> const &taskQueue) noexcept {
+  // All tasks are already released. The clear() keeps the vector capacity.
+  taskQueue->clear();
+  std::scoped_lock lock{spareQueue.Mutex};
+  spareQueue.Queue = taskQueue;
+}
+
 void BatchingQueueThread::PostBatch() noexcept {
   if (m_taskQueue) {
-    m_queueThread->runOnQueue([taskQueue{std::move(m_taskQueue)}]() noexcept {
+    if (m_stats) {
+      m_queueThread->runOnQueue([taskQueue{std::move(m_taskQueue)},
+                                 spareQueue = m_spareQueue,
+                                 stats = m_stats,
+                                 postTime = std::chrono::steady_clock::now()]() noexcept {
+        for (auto &task : *taskQueue) {
+          auto startTime = std::chrono::steady_clock::now();
+          task();
+          task = nullptr;
+          stats->RecordInvoke(startTime - postTime, std::chrono::steady_clock::now() - startTime);
+        }
+
+        RecycleQueue(*spareQueue, taskQueue);
+      });
+      return;
+    }
+
+    m_queueThread->runOnQueue([taskQueue{std::move(m_taskQueue)}, spareQueue = m_spareQueue]() noexcept {
       for (auto &task : *taskQueue) {
         task();
         task = nullptr;
       }
+
+      RecycleQueue(*spareQueue, taskQueue);
     });
   }
 }
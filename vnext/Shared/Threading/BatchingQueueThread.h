@@ -4,13 +4,19 @@
 #pragma once
 
 #include <Shared/BatchingMessageQueueThread.h>
+#include <dispatchQueue/dispatchQueue.h>
+#include <string_view>
 #include <thread>
 
 namespace react::uwp {
 
 // Executes the function on the provided UI Dispatcher
+// If the instrumentation name is provided, then it reports task statistics along with the instrumented dispatch
+// queues. The task wait time is measured from posting the batch that contains the task.
 struct BatchingQueueThread final : facebook::react::BatchingMessageQueueThread {
-  BatchingQueueThread(std::shared_ptr<facebook::react::MessageQueueThread> const &queueThread) noexcept;
+  BatchingQueueThread(
+      std::shared_ptr<facebook::react::MessageQueueThread> const &queueThread,
+      std::string_view instrumentationName = {}) noexcept;
   ~BatchingQueueThread() noexcept override;
 
   BatchingQueueThread() = delete;
@@ -29,11 +35,22 @@ struct BatchingQueueThread final : facebook::react::BatchingMessageQueueThread {
   void ThreadCheck() noexcept;
   void PostBatch() noexcept;
 
+  using WorkItemQueue = std::vector<std::function<void()>>;
+
+  // The last executed work item queue. We reuse its buffer for the next batch instead of allocating a new one.
+  struct SpareWorkItemQueue {
+    std::mutex Mutex;
+    std::shared_ptr<WorkItemQueue> Queue;
+  };
+
+  static void RecycleQueue(SpareWorkItemQueue &spareQueue, std::shared_ptr<WorkItemQueue> const &taskQueue) noexcept;
+
  private:
   std::shared_ptr<facebook::react::MessageQueueThread> m_queueThread;
+  Mso::CntPtr<Mso::IDispatchQueueStatsRecorder> m_stats;
 
-  using WorkItemQueue = std::vector<std::function<void()>>;
   std::shared_ptr<WorkItemQueue> m_taskQueue;
+  std::shared_ptr<SpareWorkItemQueue> m_spareQueue{std::make_shared<SpareWorkItemQueue>()};
   std::mutex m_mutex;
 
 #if DEBUG
@@ -16,11 +16,16 @@ namespace Mso::React {
 MessageDispatchQueue::MessageDispatchQueue(
     Mso::DispatchQueue const &dispatchQueue,
     Mso::Functor<void(const Mso::ErrorCode &)> &&errorHandler,
-    Mso::Promise<void> &&whenQuit) noexcept
+    Mso::Promise<void> &&whenQuit,
+    std::string_view instrumentationName) noexcept
     : m_dispatchQueue{dispatchQueue},
       m_stopped{false},
       m_errorHandler{std::move(errorHandler)},
-      m_whenQuit{std::move(whenQuit)} {}
+      m_whenQuit{std::move(whenQuit)} {
+  if (!instrumentationName.empty()) {
+    m_dispatchQueue.EnableInstrumentation(instrumentationName);
+  }
+}
 
 MessageDispatchQueue::~MessageDispatchQueue() noexcept {}
 
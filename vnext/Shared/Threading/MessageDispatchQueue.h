@@ -7,14 +7,22 @@
 #include <functional/FunctorRef.h>
 #include <future/Future.h>
 #include <memory>
+#include <string_view>
 
 namespace Mso::React {
 
+// Stable names of the React instance queues in the dispatch queue instrumentation.
+constexpr std::string_view JSQueueInstrumentationName{"JSQueue"};
+constexpr std::string_view NativeQueueInstrumentationName{"NativeQueue"};
+constexpr std::string_view UIQueueInstrumentationName{"UIQueue"};
+constexpr std::string_view UIBatchingQueueInstrumentationName{"UIBatchingQueue"};
+
 struct MessageDispatchQueue : facebook::react::MessageQueueThread, std::enable_shared_from_this<MessageDispatchQueue> {
   MessageDispatchQueue(
       Mso::DispatchQueue const &dispatchQueue,
       Mso::Functor<void(const Mso::ErrorCode &)> &&errorHandler,
-      Mso::Promise<void> &&whenQuit = nullptr) noexcept;
+      Mso::Promise<void> &&whenQuit = nullptr,
+      std::string_view instrumentationName = {}) noexcept;
 
   ~MessageDispatchQueue() noexcept override;
 
@@ -8,7 +8,8 @@
 namespace react::uwp {
 
 std::shared_ptr<facebook::react::MessageQueueThread> MakeJSQueueThread() noexcept {
-  return std::make_shared<Mso::React::MessageDispatchQueue>(Mso::DispatchQueue::MakeLooperQueue(), nullptr, nullptr);
+  return std::make_shared<Mso::React::MessageDispatchQueue>(
+      Mso::DispatchQueue::MakeLooperQueue(Mso::DispatchQueueOptions::LockFreePost), nullptr, nullptr);
 }
 
 std::shared_ptr<facebook::react::MessageQueueThread> MakeUIQueueThread() noexcept {
@@ -19,8 +20,9 @@ std::shared_ptr<facebook::react::MessageQueueThread> MakeUIQueueThread() noexcep
 }
 
 std::shared_ptr<facebook::react::BatchingMessageQueueThread> MakeBatchingQueueThread(
-    std::shared_ptr<facebook::react::MessageQueueThread> const &queueThread) noexcept {
-  return std::make_shared<BatchingQueueThread>(queueThread);
+    std::shared_ptr<facebook::react::MessageQueueThread> const &queueThread,
+    std::string_view instrumentationName) noexcept {
+  return std::make_shared<BatchingQueueThread>(queueThread, instrumentationName);
 }
 
 } // namespace react::uwp
@@ -5,6 +5,7 @@
 
 #include <BatchingMessageQueueThread.h>
 #include <cxxreact/MessageQueueThread.h>
+#include <string_view>
 
 namespace react::uwp {
 
@@ -12,7 +13,9 @@ std::shared_ptr<facebook::react::MessageQueueThread> MakeJSQueueThread() noexcep
 
 std::shared_ptr<facebook::react::MessageQueueThread> MakeUIQueueThread() noexcept;
 
+// The batching queue reports task statistics under the instrumentation name if it is not empty.
 std::shared_ptr<facebook::react::BatchingMessageQueueThread> MakeBatchingQueueThread(
-    std::shared_ptr<facebook::react::MessageQueueThread> const &queueThread) noexcept;
+    std::shared_ptr<facebook::react::MessageQueueThread> const &queueThread,
+    std::string_view instrumentationName = {}) noexcept;
 
 } // namespace react::uwp
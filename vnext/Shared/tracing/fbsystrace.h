@@ -11,6 +11,7 @@
 #include <string>
 #include <type_traits>
 #include <unordered_map>
+#include "traceCategories.h"
 
 #define TRACE_TAG_REACT_CXX_BRIDGE 1 << 10
 #define TRACE_TAG_REACT_APPS 1 << 11
@@ -59,15 +60,23 @@ class FbSystraceSection {
   FbSystraceSection(uint64_t tag, std::string &&profileName, RestArg &&... rest)
       : tag_(tag), profile_name_(std::move(profileName)) {
     id_ = s_id_counter++;
-    init(std::forward<RestArg>(rest)...);
+
+    // Sections of the disabled categories do not convert their arguments.
+    if (facebook::react::tracing::isTraceCategoryEnabled(tag_)) {
+      is_enabled_ = true;
+      init(std::forward<RestArg>(rest)...);
+    }
   }
 
   ~FbSystraceSection() {
-    end_section();
+    if (is_enabled_) {
+      end_section();
+    }
   }
 
  private:
   void init() {
+    start_ = std::chrono::high_resolution_clock::now();
     begin_section();
   }
 
@@ -90,15 +99,13 @@ class FbSystraceSection {
 
   std::string profile_name_;
   uint8_t index_{0};
+  bool is_enabled_{false};
 
-  std::chrono::high_resolution_clock::time_point start_{std::chrono::high_resolution_clock::now()};
+  std::chrono::high_resolution_clock::time_point start_;
 };
 
 struct FbSystraceAsyncFlow {
   static void begin(uint64_t tag, const char *name, int cookie);
   static void end(uint64_t tag, const char *name, int cookie);
-
-  static std::mutex s_tracker_mutex_;
-  static std::unordered_map<int, std::chrono::high_resolution_clock::time_point> s_tracker_;
 };
 } // namespace fbsystrace
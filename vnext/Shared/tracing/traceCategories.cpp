@@ -0,0 +1,134 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+
+#include "tracing/traceCategories.h"
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace facebook {
+namespace react {
+namespace tracing {
+
+namespace {
+
+constexpr size_t TraceConsumerCount = 2;
+
+struct TraceCategoriesState {
+  static TraceCategoriesState &instance() noexcept {
+    // It is never destroyed because trace points may be hit during the process shutdown.
+    static TraceCategoriesState *state{new TraceCategoriesState()};
+    return *state;
+  }
+
+  struct ListenerEntry {
+    explicit ListenerEntry(TraceCategoriesListener &&listener) noexcept : Listener{std::move(listener)} {}
+
+    TraceCategoriesListener Listener;
+    std::atomic<bool> IsRemoved{false};
+  };
+
+  // Mutex guards the fields below. The listeners are called outside of it, so that they can add or remove listeners.
+  std::mutex Mutex;
+  uint64_t ConsumerCategories[TraceConsumerCount]{};
+  std::map<uint32_t, std::shared_ptr<ListenerEntry>> Listeners;
+  uint32_t NextListenerId{1};
+
+  // Serializes the listener calls, so that removeTraceCategoriesListener can wait for the calls in progress.
+  // It is recursive because a listener may remove itself.
+  std::recursive_mutex NotifyMutex;
+};
+
+std::atomic<uint64_t> s_enabledCategories{0};
+
+void notifyListeners(
+    TraceCategoriesState &state,
+    const std::vector<std::shared_ptr<TraceCategoriesState::ListenerEntry>> &listeners) noexcept {
+  std::lock_guard<std::recursive_mutex> lock{state.NotifyMutex};
+  for (auto const &entry : listeners) {
+    if (!entry->IsRemoved.load(std::memory_order_acquire)) {
+      // The categories could be changed again after we released the state.Mutex. Deliver the latest ones.
+      entry->Listener(s_enabledCategories.load(std::memory_order_relaxed));
+    }
+  }
+}
+
+} // namespace
+
+void setTraceCategories(TraceConsumer consumer, uint64_t categories) noexcept {
+  TraceCategoriesState &state = TraceCategoriesState::instance();
+  std::vector<std::shared_ptr<TraceCategoriesState::ListenerEntry>> listeners;
+  {
+    std::lock_guard<std::mutex> lock{state.Mutex};
+    state.ConsumerCategories[static_cast<size_t>(consumer)] = categories;
+
+    uint64_t enabledCategories = 0;
+    for (uint64_t consumerCategories : state.ConsumerCategories) {
+      enabledCategories |= consumerCategories;
+    }
+
+    if (s_enabledCategories.exchange(enabledCategories, std::memory_order_relaxed) == enabledCategories) {
+      return;
+    }
+
+    try {
+      listeners.reserve(state.Listeners.size());
+      for (auto const &entry : state.Listeners) {
+        listeners.push_back(entry.second);
+      }
+    } catch (const std::bad_alloc &) {
+      return; // The categories are changed, but the listeners are not notified.
+    }
+  }
+
+  notifyListeners(state, listeners);
+}
+
+uint64_t getEnabledTraceCategories() noexcept {
+  return s_enabledCategories.load(std::memory_order_relaxed);
+}
+
+bool isTraceCategoryEnabled(uint64_t tag) noexcept {
+  return (s_enabledCategories.load(std::memory_order_relaxed) & tag) != 0;
+}
+
+uint32_t addTraceCategoriesListener(TraceCategoriesListener &&listener) {
+  TraceCategoriesState &state = TraceCategoriesState::instance();
+  auto entry = std::make_shared<TraceCategoriesState::ListenerEntry>(std::move(listener));
+  uint32_t listenerId;
+  {
+    std::lock_guard<std::mutex> lock{state.Mutex};
+    listenerId = state.NextListenerId++;
+    state.Listeners.emplace(listenerId, entry);
+  }
+
+  // Deliver the current categories, so that the listener does not miss the changes done before it was added.
+  notifyListeners(state, {entry});
+  return listenerId;
+}
+
+void removeTraceCategoriesListener(uint32_t listenerId) noexcept {
+  TraceCategoriesState &state = TraceCategoriesState::instance();
+  {
+    std::lock_guard<std::mutex> lock{state.Mutex};
+    auto it = state.Listeners.find(listenerId);
+    if (it == state.Listeners.end()) {
+      return;
+    }
+
+    it->second->IsRemoved.store(true, std::memory_order_release);
+    state.Listeners.erase(it);
+  }
+
+  // Wait for the listener calls in progress in other threads.
+  std::lock_guard<std::recursive_mutex> lock{state.NotifyMutex};
+}
+
+} // namespace tracing
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,49 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <stdint.h>
+#include <functional>
+
+// Runtime switch for the trace points.
+//
+// A trace category is a trace tag bit, e.g. TRACE_TAG_REACT_CXX_BRIDGE. Each trace consumer enables the categories it
+// listens to, and a category is enabled while any consumer enables it. Checking a category is a single atomic load,
+// so the trace points of the disabled categories return before they convert or copy their arguments.
+
+namespace facebook {
+namespace react {
+namespace tracing {
+
+constexpr uint64_t AllTraceCategories = ~uint64_t{0};
+
+// The tag that Systrace.js passes to the JS trace hooks.
+constexpr uint64_t JSTraceCategory = uint64_t{1} << 17;
+
+enum class TraceConsumer : uint8_t {
+  EventTracing, // ETW session that enabled the TraceLogging provider
+  Recorder, // in-process trace recorder
+};
+
+// Replaces the categories enabled by the consumer.
+void setTraceCategories(TraceConsumer consumer, uint64_t categories) noexcept;
+
+// Returns the categories enabled by any consumer.
+uint64_t getEnabledTraceCategories() noexcept;
+
+bool isTraceCategoryEnabled(uint64_t tag) noexcept;
+
+// The listener is called with the enabled categories when it is added and each time they change. It is called in the
+// thread that adds it or changes the categories, and it must not throw or change the categories.
+// The listener calls are serialized, and no locks that guard the categories are held while it is called.
+using TraceCategoriesListener = std::function<void(uint64_t enabledCategories)>;
+
+uint32_t addTraceCategoriesListener(TraceCategoriesListener &&listener);
+
+// After it returns, the listener is not called anymore.
+void removeTraceCategoriesListener(uint32_t listenerId) noexcept;
+
+} // namespace tracing
+} // namespace react
+} // namespace facebook
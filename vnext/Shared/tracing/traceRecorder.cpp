@@ -0,0 +1,379 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+
+#include "tracing/traceRecorder.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace facebook {
+namespace react {
+namespace tracing {
+
+namespace {
+
+static_assert((TraceBufferCapacity & (TraceBufferCapacity - 1)) == 0, "TraceBufferCapacity must be a power of 2");
+
+struct TraceEventRecord {
+  uint64_t Timestamp; // nanoseconds since the recorder epoch
+  uint64_t Tag;
+  uint64_t Id;
+  int64_t Value;
+  TraceNameId NameId;
+  TracePhase Phase;
+  uint8_t ArgCount;
+  uint8_t ArgSizes[MaxTraceEventArgs];
+  char ArgData[MaxTraceEventArgsSize];
+};
+
+// Ring buffer with a single writer, the owner thread, and a single reader, the flush under the registry lock.
+class ThreadTraceBuffer {
+ public:
+  explicit ThreadTraceBuffer(uint32_t threadId)
+      : m_threadId{threadId}, m_records{new TraceEventRecord[TraceBufferCapacity]} {}
+
+  // Returns nullptr if the buffer is full. The record is published by commit().
+  TraceEventRecord *reserve() noexcept {
+    uint64_t writeIndex = m_writeIndex.load(std::memory_order_relaxed);
+    if (writeIndex - m_readIndex.load(std::memory_order_acquire) == TraceBufferCapacity) {
+      m_droppedCount.store(m_droppedCount.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+      return nullptr;
+    }
+
+    return &m_records[writeIndex & (TraceBufferCapacity - 1)];
+  }
+
+  void commit() noexcept {
+    m_writeIndex.store(m_writeIndex.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+  }
+
+  template <class TVisitor>
+  void consume(TVisitor &&visitor) {
+    uint64_t readIndex = m_readIndex.load(std::memory_order_relaxed);
+    uint64_t writeIndex = m_writeIndex.load(std::memory_order_acquire);
+    for (uint64_t index = readIndex; index != writeIndex; ++index) {
+      visitor(m_records[index & (TraceBufferCapacity - 1)]);
+    }
+
+    m_readIndex.store(writeIndex, std::memory_order_release);
+  }
+
+  uint32_t threadId() const noexcept {
+    return m_threadId;
+  }
+
+  uint64_t recordedCount() const noexcept {
+    return m_writeIndex.load(std::memory_order_relaxed);
+  }
+
+  uint64_t droppedCount() const noexcept {
+    return m_droppedCount.load(std::memory_order_relaxed);
+  }
+
+ private:
+  const uint32_t m_threadId;
+  std::unique_ptr<TraceEventRecord[]> m_records;
+  std::atomic<uint64_t> m_writeIndex{0};
+  std::atomic<uint64_t> m_readIndex{0};
+  std::atomic<uint64_t> m_droppedCount{0};
+};
+
+// Process-wide list of the thread buffers and the interned names.
+// It is never destroyed because threads may record events during the process shutdown.
+struct TraceRegistry {
+  static TraceRegistry &instance() noexcept {
+    static TraceRegistry *registry{new TraceRegistry()};
+    return *registry;
+  }
+
+  std::mutex Mutex;
+  std::vector<std::shared_ptr<ThreadTraceBuffer>> Buffers;
+  uint32_t NextThreadId{1};
+
+  // The deque does not move the names, so the map keys and the thread caches can point to them.
+  std::deque<std::string> Names;
+  std::unordered_map<std::string_view, TraceNameId> NameIds;
+
+  // Buffers of the exited threads are kept until their events are flushed.
+  uint64_t RetiredRecordedCount{0};
+  uint64_t RetiredDroppedCount{0};
+};
+
+std::atomic<uint64_t> s_recordedCategories{0};
+const std::chrono::steady_clock::time_point s_epoch{std::chrono::steady_clock::now()};
+
+thread_local std::shared_ptr<ThreadTraceBuffer> tls_traceBuffer;
+thread_local std::unordered_map<std::string_view, TraceNameId> tls_nameIds;
+
+ThreadTraceBuffer *getThreadTraceBuffer() noexcept {
+  if (!tls_traceBuffer) {
+    try {
+      TraceRegistry &registry = TraceRegistry::instance();
+      std::lock_guard<std::mutex> lock{registry.Mutex};
+      tls_traceBuffer = std::make_shared<ThreadTraceBuffer>(registry.NextThreadId++);
+      registry.Buffers.push_back(tls_traceBuffer);
+    } catch (const std::bad_alloc &) {
+      return nullptr;
+    }
+  }
+
+  return tls_traceBuffer.get();
+}
+
+const char *getTagCategory(uint64_t tag) noexcept {
+  switch (tag) {
+    case 1 << 10:
+      return "react_cxx_bridge";
+    case 1 << 11:
+      return "react_apps";
+    case JSTraceCategory:
+      return "react_js";
+    default:
+      return "react";
+  }
+}
+
+void appendJsonString(std::string &json, std::string_view value) {
+  json += '"';
+  for (char c : value) {
+    switch (c) {
+      case '"':
+        json += "\\\"";
+        break;
+      case '\\':
+        json += "\\\\";
+        break;
+      case '\n':
+        json += "\\n";
+        break;
+      case '\r':
+        json += "\\r";
+        break;
+      case '\t':
+        json += "\\t";
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          char escaped[8];
+          snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+          json += escaped;
+        } else {
+          json += c;
+        }
+        break;
+    }
+  }
+  json += '"';
+}
+
+void appendJsonEvent(
+    std::string &json,
+    const TraceEventRecord &record,
+    uint32_t threadId,
+    const std::deque<std::string> &names) {
+  char buffer[128];
+  json += "{\"name\":";
+  appendJsonString(json, record.NameId < names.size() ? names[record.NameId] : std::string_view{});
+  json += ",\"cat\":\"";
+  json += getTagCategory(record.Tag);
+  json += "\",\"ph\":\"";
+  json += static_cast<char>(record.Phase);
+  snprintf(
+      buffer,
+      sizeof(buffer),
+      "\",\"ts\":%.3f,\"pid\":1,\"tid\":%u",
+      static_cast<double>(record.Timestamp) / 1000.0,
+      threadId);
+  json += buffer;
+
+  switch (record.Phase) {
+    case TracePhase::AsyncBegin:
+    case TracePhase::AsyncEnd:
+    case TracePhase::FlowBegin:
+    case TracePhase::FlowEnd:
+      snprintf(buffer, sizeof(buffer), ",\"id\":\"0x%llx\"", static_cast<unsigned long long>(record.Id));
+      json += buffer;
+      if (record.Phase == TracePhase::FlowEnd) {
+        json += ",\"bp\":\"e\"";
+      }
+      break;
+    default:
+      break;
+  }
+
+  // The counter value is the first argument of the counter events.
+  bool isCounter = record.Phase == TracePhase::Counter;
+  if (isCounter || record.ArgCount > 0) {
+    json += ",\"args\":{";
+    if (isCounter) {
+      snprintf(buffer, sizeof(buffer), "\"value\":%lld", static_cast<long long>(record.Value));
+      json += buffer;
+    }
+
+    const char *argData = record.ArgData;
+    for (uint8_t i = 0; i < record.ArgCount; i += 2) {
+      if (i > 0 || isCounter) {
+        json += ',';
+      }
+
+      std::string_view argName{argData, record.ArgSizes[i]};
+      argData += record.ArgSizes[i];
+      std::string_view argValue;
+      if (i + 1 < record.ArgCount) {
+        argValue = std::string_view{argData, record.ArgSizes[i + 1]};
+        argData += record.ArgSizes[i + 1];
+      }
+
+      appendJsonString(json, argName);
+      json += ':';
+      appendJsonString(json, argValue);
+    }
+    json += '}';
+  }
+
+  json += '}';
+}
+
+} // namespace
+
+TraceNameId internTraceName(std::string_view name) noexcept {
+  auto it = tls_nameIds.find(name);
+  if (it != tls_nameIds.end()) {
+    return it->second;
+  }
+
+  try {
+    TraceRegistry &registry = TraceRegistry::instance();
+    TraceNameId nameId;
+    std::string_view internedName;
+    {
+      std::lock_guard<std::mutex> lock{registry.Mutex};
+      auto globalIt = registry.NameIds.find(name);
+      if (globalIt == registry.NameIds.end()) {
+        registry.Names.emplace_back(name);
+        globalIt = registry.NameIds.emplace(registry.Names.back(), static_cast<TraceNameId>(registry.Names.size() - 1))
+                       .first;
+      }
+
+      internedName = globalIt->first;
+      nameId = globalIt->second;
+    }
+
+    tls_nameIds.emplace(internedName, nameId);
+    return nameId;
+  } catch (const std::bad_alloc &) {
+    return InvalidTraceNameId;
+  }
+}
+
+void startTraceRecording(uint64_t categories) noexcept {
+  s_recordedCategories.store(categories, std::memory_order_relaxed);
+  setTraceCategories(TraceConsumer::Recorder, categories);
+}
+
+void stopTraceRecording() noexcept {
+  s_recordedCategories.store(0, std::memory_order_relaxed);
+  setTraceCategories(TraceConsumer::Recorder, 0);
+}
+
+bool isTraceRecording() noexcept {
+  return s_recordedCategories.load(std::memory_order_relaxed) != 0;
+}
+
+void recordTraceEvent(
+    TracePhase phase,
+    uint64_t tag,
+    TraceNameId nameId,
+    uint64_t id,
+    int64_t value,
+    const std::string_view *args,
+    size_t argCount) noexcept {
+  if ((s_recordedCategories.load(std::memory_order_relaxed) & tag) == 0) {
+    return;
+  }
+
+  ThreadTraceBuffer *buffer = getThreadTraceBuffer();
+  TraceEventRecord *record = buffer ? buffer->reserve() : nullptr;
+  if (!record) {
+    return;
+  }
+
+  record->Timestamp = static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - s_epoch).count());
+  record->Tag = tag;
+  record->Id = id;
+  record->Value = value;
+  record->NameId = nameId;
+  record->Phase = phase;
+
+  // Copy the arguments to the slots. The arguments that do not fit are truncated.
+  argCount = std::min(argCount, MaxTraceEventArgs);
+  size_t argDataSize = 0;
+  for (size_t i = 0; i < argCount; ++i) {
+    size_t argSize = std::min({args[i].size(), MaxTraceEventArgsSize - argDataSize, size_t{UINT8_MAX}});
+    memcpy(record->ArgData + argDataSize, args[i].data(), argSize);
+    record->ArgSizes[i] = static_cast<uint8_t>(argSize);
+    argDataSize += argSize;
+  }
+  record->ArgCount = static_cast<uint8_t>(argCount);
+
+  buffer->commit();
+}
+
+std::string flushTraceEventsAsJson() {
+  TraceRegistry &registry = TraceRegistry::instance();
+  std::lock_guard<std::mutex> lock{registry.Mutex};
+
+  std::string json{"{\"displayTimeUnit\":\"ms\",\"traceEvents\":["};
+  bool isFirstEvent = true;
+  for (auto &buffer : registry.Buffers) {
+    buffer->consume([&](const TraceEventRecord &record) {
+      if (!isFirstEvent) {
+        json += ",\n";
+      }
+      isFirstEvent = false;
+      appendJsonEvent(json, record, buffer->threadId(), registry.Names);
+    });
+  }
+  json += "]}";
+
+  // The registry holds the only reference to the buffers of the exited threads.
+  auto exitedBegin = std::partition(registry.Buffers.begin(), registry.Buffers.end(), [](auto const &buffer) {
+    return buffer.use_count() > 1;
+  });
+  for (auto it = exitedBegin; it != registry.Buffers.end(); ++it) {
+    registry.RetiredRecordedCount += (*it)->recordedCount();
+    registry.RetiredDroppedCount += (*it)->droppedCount();
+  }
+  registry.Buffers.erase(exitedBegin, registry.Buffers.end());
+
+  return json;
+}
+
+TraceRecorderStats getTraceRecorderStats() noexcept {
+  TraceRegistry &registry = TraceRegistry::instance();
+  std::lock_guard<std::mutex> lock{registry.Mutex};
+
+  TraceRecorderStats stats;
+  stats.RecordedCount = registry.RetiredRecordedCount;
+  stats.DroppedCount = registry.RetiredDroppedCount;
+  for (auto const &buffer : registry.Buffers) {
+    stats.RecordedCount += buffer->recordedCount();
+    stats.DroppedCount += buffer->droppedCount();
+  }
+
+  return stats;
+}
+
+} // namespace tracing
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,80 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <stdint.h>
+#include <string>
+#include <string_view>
+#include "traceCategories.h"
+
+// In-process trace recorder that does not depend on the platform tracing.
+//
+// Each thread records its events to its own ring buffer without locks. Event names are interned,
+// and every event has preallocated argument slots, so recording an event does not allocate.
+// The events of the selected categories are recorded between startTraceRecording and stopTraceRecording calls, and
+// flushTraceEventsAsJson moves them out as Chrome trace event JSON that can be opened by
+// chrome://tracing and by the Perfetto UI.
+
+namespace facebook {
+namespace react {
+namespace tracing {
+
+// Phases of the Chrome trace event format.
+enum class TracePhase : char {
+  Begin = 'B',
+  End = 'E',
+  AsyncBegin = 'b',
+  AsyncEnd = 'e',
+  FlowBegin = 's',
+  FlowEnd = 'f',
+  Counter = 'C',
+};
+
+using TraceNameId = uint32_t;
+
+// The id returned when the name cannot be interned. The events with this id are recorded with an empty name.
+constexpr TraceNameId InvalidTraceNameId = UINT32_MAX;
+
+// The biggest number of arguments of an event: names and values in pairs.
+constexpr size_t MaxTraceEventArgs = 8;
+
+// The argument slots of an event share this many bytes. Longer arguments are truncated.
+constexpr size_t MaxTraceEventArgsSize = 96;
+
+// The number of events a thread buffer keeps between flushes. New events are dropped when it is full.
+constexpr size_t TraceBufferCapacity = 16 * 1024;
+
+struct TraceRecorderStats {
+  uint64_t RecordedCount{0}; // events written to the thread buffers
+  uint64_t DroppedCount{0}; // events dropped because a thread buffer was full
+};
+
+// Returns the id of the interned name, or InvalidTraceNameId if the name cannot be interned.
+// It takes a lock only when the calling thread sees the name first time.
+TraceNameId internTraceName(std::string_view name) noexcept;
+
+// Enables the categories for the Recorder consumer and starts recording their events.
+void startTraceRecording(uint64_t categories = AllTraceCategories) noexcept;
+void stopTraceRecording() noexcept;
+bool isTraceRecording() noexcept;
+
+// Records the event to the thread buffer if its tag is in the recorded categories.
+// The id is the async section or flow cookie, and value is the counter value.
+void recordTraceEvent(
+    TracePhase phase,
+    uint64_t tag,
+    TraceNameId nameId,
+    uint64_t id = 0,
+    int64_t value = 0,
+    const std::string_view *args = nullptr,
+    size_t argCount = 0) noexcept;
+
+// Moves the recorded events out of the thread buffers and returns them as Chrome trace event JSON.
+std::string flushTraceEventsAsJson();
+
+TraceRecorderStats getTraceRecorderStats() noexcept;
+
+} // namespace tracing
+} // namespace react
+} // namespace facebook
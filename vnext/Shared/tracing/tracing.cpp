@@ -6,9 +6,12 @@
 #include <TraceLoggingProvider.h>
 #include <jsi/jsi.h>
 #include "tracing/fbsystrace.h"
+#include "tracing/traceCategories.h"
+#include "tracing/traceRecorder.h"
 
 #include <array>
 #include <string>
+#include <vector>
 
 // Define the GUID to use in TraceLoggingProviderRegister
 // {910FB9A1-75DD-4CF4-BEEC-DA21341F20C8}
@@ -23,14 +26,14 @@ namespace fbsystrace {
 
 /*static */ uint64_t FbSystraceSection::s_id_counter = 0;
 
-/*static */ std::unordered_map<int, std::chrono::high_resolution_clock::time_point> FbSystraceAsyncFlow::s_tracker_;
-/*static */ std::mutex FbSystraceAsyncFlow::s_tracker_mutex_;
-
-std::mutex g_pages_mutex;
 /*static*/ void FbSystraceAsyncFlow::begin(uint64_t tag, const char *name, int cookie) {
-  {
-    std::scoped_lock lock{s_tracker_mutex_};
-    s_tracker_[cookie] = std::chrono::high_resolution_clock::now();
+  using namespace facebook::react::tracing;
+  if (!isTraceCategoryEnabled(tag)) {
+    return;
+  }
+
+  if (isTraceRecording()) {
+    recordTraceEvent(TracePhase::FlowBegin, tag, internTraceName(name), static_cast<uint64_t>(cookie));
   }
 
   TraceLoggingWrite(
@@ -43,19 +46,13 @@ std::mutex g_pages_mutex;
 }
 
 /*static */ void FbSystraceAsyncFlow::end(uint64_t tag, const char *name, int cookie) {
-  double duration = -1;
-  {
-    std::scoped_lock lock{s_tracker_mutex_};
-    auto search = s_tracker_.find(cookie);
-
-    if (search != s_tracker_.end()) {
-      duration = std::chrono::duration_cast<std::chrono::duration<double>>(
-                     std::chrono::high_resolution_clock::now() - search->second)
-                     .count();
-
-      // Flow has ended. Clear the cookie tracker.
-      s_tracker_.erase(cookie);
-    }
+  using namespace facebook::react::tracing;
+  if (!isTraceCategoryEnabled(tag)) {
+    return;
+  }
+
+  if (isTraceRecording()) {
+    recordTraceEvent(TracePhase::FlowEnd, tag, internTraceName(name), static_cast<uint64_t>(cookie));
   }
 
   TraceLoggingWrite(
@@ -77,12 +74,99 @@ namespace facebook {
 namespace react {
 namespace tracing {
 
+namespace {
+
+// Enables the trace categories while an ETW session listens to the provider. The session may choose the categories
+// with the keywords: the keyword bits match the trace tags. Without keywords all categories are enabled.
+void NTAPI OnTraceLoggingProviderEnabled(
+    LPCGUID /*sourceId*/,
+    ULONG isEnabled,
+    UCHAR /*level*/,
+    ULONGLONG matchAnyKeyword,
+    ULONGLONG /*matchAllKeyword*/,
+    PEVENT_FILTER_DESCRIPTOR /*filterData*/,
+    PVOID /*callbackContext*/) noexcept {
+  if (isEnabled == EVENT_CONTROL_CODE_ENABLE_PROVIDER) {
+    setTraceCategories(TraceConsumer::EventTracing, matchAnyKeyword ? matchAnyKeyword : AllTraceCategories);
+  } else if (isEnabled == EVENT_CONTROL_CODE_DISABLE_PROVIDER) {
+    setTraceCategories(TraceConsumer::EventTracing, 0);
+  }
+}
+
+const std::string UnknownProfileName{"unknown"};
+const std::string EmptyArgs;
+const std::string UnhandledArgs{"<unhandled>"};
+const std::string UndefinedArgs{"<undefined>"};
+
+// Keeps the UTF-8 strings of the recently used JS profile names and section arguments, so that the hooks convert a
+// JS string only when it is not cached, and reuse the same strings and their interned trace names. The JS strings are
+// compared in the runtime without converting them. The cache is owned by the hook functions, so the JS strings are
+// released with the runtime.
+class JSTraceNameCache {
+ public:
+  const std::string &getName(jsi::Runtime &runtime, const jsi::Value &jsName) {
+    jsi::String jsString = jsName.getString(runtime);
+
+    // The hooks are usually called with the same names in a row, so the last found entry is checked first.
+    if (m_lastFoundIndex < m_entries.size() &&
+        jsi::String::strictEquals(runtime, m_entries[m_lastFoundIndex].JSName, jsString)) {
+      return m_entries[m_lastFoundIndex].Name;
+    }
+
+    for (size_t i = 0; i < m_entries.size(); ++i) {
+      if (jsi::String::strictEquals(runtime, m_entries[i].JSName, jsString)) {
+        m_lastFoundIndex = i;
+        return m_entries[i].Name;
+      }
+    }
+
+    std::string name = jsString.utf8(runtime);
+    if (m_entries.size() < Capacity) {
+      m_lastFoundIndex = m_entries.size();
+      return m_entries.emplace_back(Entry{std::move(jsString), std::move(name)}).Name;
+    }
+
+    m_lastFoundIndex = m_nextEvictedIndex;
+    m_nextEvictedIndex = (m_nextEvictedIndex + 1) % Capacity;
+    Entry &evicted = m_entries[m_lastFoundIndex];
+    evicted = Entry{std::move(jsString), std::move(name)};
+    return evicted.Name;
+  }
+
+ private:
+  struct Entry {
+    jsi::String JSName;
+    std::string Name;
+  };
+
+  static constexpr size_t Capacity = 16;
+
+  std::vector<Entry> m_entries;
+  size_t m_nextEvictedIndex{0};
+  size_t m_lastFoundIndex{0};
+};
+
+} // namespace
+
 void trace_begin_section(
     uint64_t id,
     uint64_t tag,
     const std::string &profile_name,
     std::array<std::string, SYSTRACE_SECTION_MAX_ARGS> &&args,
     uint8_t size) {
+  if (!isTraceCategoryEnabled(tag)) {
+    return;
+  }
+
+  if (isTraceRecording()) {
+    std::array<std::string_view, SYSTRACE_SECTION_MAX_ARGS> argViews;
+    for (uint8_t i = 0; i < size; ++i) {
+      argViews[i] = args[i];
+    }
+
+    recordTraceEvent(TracePhase::Begin, tag, internTraceName(profile_name), id, 0, argViews.data(), size);
+  }
+
   TraceLoggingWrite(
       g_hTraceLoggingProvider,
       "SystraceNativeSection",
@@ -100,6 +184,14 @@ void trace_begin_section(
 }
 
 void trace_end_section(uint64_t id, uint64_t tag, const std::string &profile_name, double duration) {
+  if (!isTraceCategoryEnabled(tag)) {
+    return;
+  }
+
+  if (isTraceRecording()) {
+    recordTraceEvent(TracePhase::End, tag, internTraceName(profile_name), id);
+  }
+
   TraceLoggingWrite(
       g_hTraceLoggingProvider,
       "SystraceNativeSection",
@@ -110,6 +202,11 @@ void trace_end_section(uint64_t id, uint64_t tag, const std::string &profile_nam
 }
 
 void syncSectionBeginJSHook(uint64_t tag, const std::string &profile_name, const std::string &args) {
+  if (isTraceRecording()) {
+    std::string_view argViews[] = {"args", args};
+    recordTraceEvent(TracePhase::Begin, tag, internTraceName(profile_name), 0, 0, argViews, 2);
+  }
+
   TraceLoggingWrite(
       g_hTraceLoggingProvider,
       "SystraceJSSection",
@@ -120,11 +217,19 @@ void syncSectionBeginJSHook(uint64_t tag, const std::string &profile_name, const
 }
 
 void syncSectionEndJSHook(uint64_t tag) {
+  if (isTraceRecording()) {
+    recordTraceEvent(TracePhase::End, tag, internTraceName({}));
+  }
+
   TraceLoggingWrite(
       g_hTraceLoggingProvider, "SystraceJSSection", TraceLoggingString("end", "op"), TraceLoggingUInt64(tag, "tag"));
 }
 
 void asyncSectionBeginJSHook(uint64_t tag, const std::string &profile_name, int cookie) {
+  if (isTraceRecording()) {
+    recordTraceEvent(TracePhase::AsyncBegin, tag, internTraceName(profile_name), static_cast<uint64_t>(cookie));
+  }
+
   TraceLoggingWrite(
       g_hTraceLoggingProvider,
       "SystraceJSAsyncSection",
@@ -135,6 +240,10 @@ void asyncSectionBeginJSHook(uint64_t tag, const std::string &profile_name, int
 }
 
 void asyncSectionEndJSHook(uint64_t tag, const std::string &profile_name, int cookie) {
+  if (isTraceRecording()) {
+    recordTraceEvent(TracePhase::AsyncEnd, tag, internTraceName(profile_name), static_cast<uint64_t>(cookie));
+  }
+
   TraceLoggingWrite(
       g_hTraceLoggingProvider,
       "SystraceJSAsyncSection",
@@ -145,6 +254,10 @@ void asyncSectionEndJSHook(uint64_t tag, const std::string &profile_name, int co
 }
 
 void asyncFlowBeginJSHook(uint64_t tag, const std::string &profile_name, int cookie) {
+  if (isTraceRecording()) {
+    recordTraceEvent(TracePhase::FlowBegin, tag, internTraceName(profile_name), static_cast<uint64_t>(cookie));
+  }
+
   TraceLoggingWrite(
       g_hTraceLoggingProvider,
       "SystraceJSAsyncFlow",
@@ -155,6 +268,10 @@ void asyncFlowBeginJSHook(uint64_t tag, const std::string &profile_name, int coo
 }
 
 void asyncFlowEndJSHook(uint64_t tag, const std::string &profile_name, int cookie) {
+  if (isTraceRecording()) {
+    recordTraceEvent(TracePhase::FlowEnd, tag, internTraceName(profile_name), static_cast<uint64_t>(cookie));
+  }
+
   TraceLoggingWrite(
       g_hTraceLoggingProvider,
       "SystraceJSAsyncFlow",
@@ -165,6 +282,10 @@ void asyncFlowEndJSHook(uint64_t tag, const std::string &profile_name, int cooki
 }
 
 void counterJSHook(uint64_t tag, const std::string &profile_name, int value) {
+  if (isTraceRecording()) {
+    recordTraceEvent(TracePhase::Counter, tag, internTraceName(profile_name), 0, value);
+  }
+
   TraceLoggingWrite(
       g_hTraceLoggingProvider,
       "SystraceCounter",
@@ -174,10 +295,14 @@ void counterJSHook(uint64_t tag, const std::string &profile_name, int value) {
 }
 
 void initializeJSHooks(jsi::Runtime &runtime) {
-  // TODO:: Assess the performance impact of hooking up the JS trace events. Especially when the tracing is not enabled.
-  // If significant, this should be put under flag based on devsettings
+  // Systrace.js does not call the hooks until it is enabled, either here at the startup or later by the
+  // Systrace.setEnabled calls when the JS category is switched. The hooks check the category before they convert the
+  // arguments, so the calls that race with disabling the category return after a single atomic load.
+  runtime.global().setProperty(runtime, "__RCTProfileIsProfiling", isTraceCategoryEnabled(JSTraceCategory));
 
-  runtime.global().setProperty(runtime, "__RCTProfileIsProfiling", true);
+  auto nameCache = std::make_shared<JSTraceNameCache>();
+  // A separate cache, so that caching the arguments cannot evict the profile name of the same event.
+  auto argsCache = std::make_shared<JSTraceNameCache>();
 
   runtime.global().setProperty(
       runtime,
@@ -186,27 +311,31 @@ void initializeJSHooks(jsi::Runtime &runtime) {
           runtime,
           jsi::PropNameID::forAscii(runtime, "nativeTraceBeginSection"),
           3,
-          [](jsi::Runtime &runtime, const jsi::Value &, const jsi::Value *jsargs, size_t count) -> jsi::Value {
+          [nameCache, argsCache](
+              jsi::Runtime &runtime, const jsi::Value &, const jsi::Value *jsargs, size_t count) -> jsi::Value {
             if (count >= 1) {
               uint64_t tag = static_cast<uint64_t>(jsargs[0].getNumber());
-
-              std::string profile_name = "unknown";
-              if (count >= 2) {
-                profile_name = jsargs[1].getString(runtime).utf8(runtime);
+              if (!isTraceCategoryEnabled(tag)) {
+                return jsi::Value::undefined();
               }
 
-              std::string args;
+              const std::string &profile_name =
+                  count >= 2 ? nameCache->getName(runtime, jsargs[1]) : UnknownProfileName;
+
+              // The arguments usually repeat with the names, so they are cached instead of being converted for
+              // every event. The ETW event needs them right away, so the conversion cannot be deferred.
+              const std::string *args = &EmptyArgs;
               if (count >= 3) {
                 const jsi::Value &val = jsargs[2];
                 if (val.isString())
-                  args = val.getString(runtime).utf8(runtime);
+                  args = &argsCache->getName(runtime, val);
                 else if (!val.isUndefined())
-                  args = "<unhandled>";
+                  args = &UnhandledArgs;
                 else
-                  args = "<undefined>";
+                  args = &UndefinedArgs;
               }
 
-              syncSectionBeginJSHook(tag, profile_name, args);
+              syncSectionBeginJSHook(tag, profile_name, *args);
             } else {
               throw std::runtime_error("nativeTraceBeginSection called without any arguments.");
             }
@@ -223,6 +352,9 @@ void initializeJSHooks(jsi::Runtime &runtime) {
           [](jsi::Runtime &runtime, const jsi::Value &, const jsi::Value *args, size_t count) -> jsi::Value {
             if (count >= 1) {
               uint64_t tag = static_cast<uint64_t>(args[0].getNumber());
+              if (!isTraceCategoryEnabled(tag)) {
+                return jsi::Value::undefined();
+              }
               syncSectionEndJSHook(tag);
             } else {
               throw std::runtime_error("nativeTraceEndSection called without any arguments.");
@@ -237,15 +369,15 @@ void initializeJSHooks(jsi::Runtime &runtime) {
           runtime,
           jsi::PropNameID::forAscii(runtime, "nativeTraceBeginAsyncSection"),
           2,
-          [](jsi::Runtime &runtime, const jsi::Value &, const jsi::Value *args, size_t count) -> jsi::Value {
+          [nameCache](jsi::Runtime &runtime, const jsi::Value &, const jsi::Value *args, size_t count) -> jsi::Value {
             if (count >= 1) {
               uint64_t tag = static_cast<uint64_t>(args[0].getNumber());
-
-              std::string profile_name = "unknown";
-              if (count >= 2) {
-                profile_name = args[1].getString(runtime).utf8(runtime);
+              if (!isTraceCategoryEnabled(tag)) {
+                return jsi::Value::undefined();
               }
 
+              const std::string &profile_name = count >= 2 ? nameCache->getName(runtime, args[1]) : UnknownProfileName;
+
               int cookie = -1;
               if (count >= 3 && args[2].isNumber()) {
                 cookie = static_cast<int>(args[2].asNumber());
@@ -266,15 +398,15 @@ void initializeJSHooks(jsi::Runtime &runtime) {
           runtime,
           jsi::PropNameID::forAscii(runtime, "nativeTraceEndAsyncSection"),
           2,
-          [](jsi::Runtime &runtime, const jsi::Value &, const jsi::Value *args, size_t count) -> jsi::Value {
+          [nameCache](jsi::Runtime &runtime, const jsi::Value &, const jsi::Value *args, size_t count) -> jsi::Value {
             if (count >= 1) {
               uint64_t tag = static_cast<uint64_t>(args[0].getNumber());
-
-              std::string profile_name = "unknown";
-              if (count >= 2) {
-                profile_name = args[1].getString(runtime).utf8(runtime);
+              if (!isTraceCategoryEnabled(tag)) {
+                return jsi::Value::undefined();
               }
 
+              const std::string &profile_name = count >= 2 ? nameCache->getName(runtime, args[1]) : UnknownProfileName;
+
               int cookie = -1;
               if (count >= 3 && args[2].isNumber()) {
                 cookie = static_cast<int>(args[2].asNumber());
@@ -294,15 +426,15 @@ void initializeJSHooks(jsi::Runtime &runtime) {
           runtime,
           jsi::PropNameID::forAscii(runtime, "nativeTraceBeginAsyncFlow"),
           2,
-          [](jsi::Runtime &runtime, const jsi::Value &, const jsi::Value *args, size_t count) -> jsi::Value {
+          [nameCache](jsi::Runtime &runtime, const jsi::Value &, const jsi::Value *args, size_t count) -> jsi::Value {
             if (count >= 1) {
               uint64_t tag = static_cast<uint64_t>(args[0].getNumber());
-
-              std::string profile_name = "unknown";
-              if (count >= 2) {
-                profile_name = args[1].getString(runtime).utf8(runtime);
+              if (!isTraceCategoryEnabled(tag)) {
+                return jsi::Value::undefined();
               }
 
+              const std::string &profile_name = count >= 2 ? nameCache->getName(runtime, args[1]) : UnknownProfileName;
+
               int cookie = -1;
               if (count >= 3 && args[2].isNumber()) {
                 cookie = static_cast<int>(args[2].asNumber());
@@ -322,15 +454,15 @@ void initializeJSHooks(jsi::Runtime &runtime) {
           runtime,
           jsi::PropNameID::forAscii(runtime, "nativeTraceEndAsyncFlow"),
           2,
-          [](jsi::Runtime &runtime, const jsi::Value &, const jsi::Value *args, size_t count) -> jsi::Value {
+          [nameCache](jsi::Runtime &runtime, const jsi::Value &, const jsi::Value *args, size_t count) -> jsi::Value {
             if (count >= 1) {
               uint64_t tag = static_cast<uint64_t>(args[0].getNumber());
-
-              std::string profile_name = "unknown";
-              if (count >= 2) {
-                profile_name = args[1].getString(runtime).utf8(runtime);
+              if (!isTraceCategoryEnabled(tag)) {
+                return jsi::Value::undefined();
               }
 
+              const std::string &profile_name = count >= 2 ? nameCache->getName(runtime, args[1]) : UnknownProfileName;
+
               int cookie = -1;
               if (count >= 3 && args[2].isNumber()) {
                 cookie = static_cast<int>(args[2].asNumber());
@@ -351,15 +483,15 @@ void initializeJSHooks(jsi::Runtime &runtime) {
           runtime,
           jsi::PropNameID::forAscii(runtime, "nativeTraceCounter"),
           2,
-          [](jsi::Runtime &runtime, const jsi::Value &, const jsi::Value *args, size_t count) -> jsi::Value {
+          [nameCache](jsi::Runtime &runtime, const jsi::Value &, const jsi::Value *args, size_t count) -> jsi::Value {
             if (count >= 1) {
               uint64_t tag = static_cast<uint64_t>(args[0].getNumber());
-
-              std::string profile_name = "unknown";
-              if (count >= 2) {
-                profile_name = args[1].getString(runtime).utf8(runtime);
+              if (!isTraceCategoryEnabled(tag)) {
+                return jsi::Value::undefined();
               }
 
+              const std::string &profile_name = count >= 2 ? nameCache->getName(runtime, args[1]) : UnknownProfileName;
+
               int value = -1;
               if (count >= 3 && args[2].isNumber()) {
                 value = static_cast<int>(args[2].asNumber());
@@ -378,7 +510,7 @@ void initializeETW() {
   // Register the provider
   static bool etwInitialized = false;
   if (!etwInitialized) {
-    TraceLoggingRegister(g_hTraceLoggingProvider);
+    TraceLoggingRegisterEx(g_hTraceLoggingProvider, OnTraceLoggingProviderEnabled, nullptr);
     etwInitialized = true;
   }
 }
@@ -11,5 +11,9 @@ namespace windows {
 
 REACTWINDOWS_API_(void) SetAsyncStorageDBPath(std::string &&path);
 
+// Sets the memory budget in bytes of the value cache in front of the database. Zero disables the cache.
+// It applies to the modules created after the call.
+REACTWINDOWS_API_(void) SetAsyncStorageValueCacheBudget(size_t budget);
+
 }
 } // namespace react